@@ -0,0 +1,58 @@
+#
+#  Copyright (C) 2025 Intel Corporation
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+
+# CamHalTest.cmake
+#
+# camhal_add_test(<name> SOURCES <src>... [LIBS <lib>...])
+#   Build a test executable against the static libcamhal and register it to ctest.
+#   The test passes when the executable returns 0.
+#
+# camhal_add_benchmark(<name> SOURCES <src>... [LIBS <lib>...])
+#   Same, but not registered to ctest, because the numbers depend on the machine.
+#
+# Both are used after the libcamhal target is added, they use the include
+# directories, definitions and link libraries of the last IPU version.
+
+include(CMakeParseArguments)
+
+function(camhal_add_executable NAME)
+    cmake_parse_arguments(ARG "" "" "SOURCES;LIBS" ${ARGN})
+
+    # Relative paths in TARGET_INCLUDE are relative to the top source directory
+    set(TEST_INCLUDE "")
+    foreach(DIR ${TARGET_INCLUDE})
+        if (IS_ABSOLUTE ${DIR})
+            set(TEST_INCLUDE ${TEST_INCLUDE} ${DIR})
+        else()
+            set(TEST_INCLUDE ${TEST_INCLUDE} ${PROJECT_SOURCE_DIR}/${DIR})
+        endif()
+    endforeach()
+
+    add_executable(${NAME} ${ARG_SOURCES})
+    target_include_directories(${NAME} PRIVATE ${TEST_INCLUDE})
+    target_compile_definitions(${NAME} PRIVATE ${TARGET_DEFINITIONS})
+    target_link_libraries(${NAME} PRIVATE ${CAMHAL_STATIC_TARGET} ${ARG_LIBS}
+                          ${LIBCAMHAL_LINK_LIBS} ${TARGET_LINK_LIBS})
+endfunction()
+
+function(camhal_add_test NAME)
+    camhal_add_executable(${NAME} ${ARGN})
+    add_test(NAME ${NAME} COMMAND ${NAME})
+endfunction()
+
+function(camhal_add_benchmark NAME)
+    camhal_add_executable(${NAME} ${ARGN})
+endfunction()
@@ -55,7 +55,7 @@ class PrivacyControl : public Thread {
     void updateMetadataResult(ControlList& metadata);
 
  public:
-    Signal<EventData> frameEvents;
+    Signal<const EventData&> frameEvents;
 
  private:
     virtual void run() override;
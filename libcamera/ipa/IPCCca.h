@@ -43,6 +43,8 @@ struct intel_cca_set_stats_data {
     int cameraId;
     int tuningMode;
 
+    // Handle of the shared memory of the params, -1 means they are in inParams
+    int32_t inParamsHandle;
     cca::cca_stats_params inParams;
 };
 
@@ -61,8 +63,11 @@ struct intel_cca_run_aiq_data {
     int tuningMode;
 
     uint64_t frameId;
+    // Handles of the shared memory of the params and results, -1 means they are inline
+    int32_t inParamsHandle;
     cca::cca_aiq_params inParams;
 
+    int32_t resultsHandle;
     cca::cca_aiq_results results;
 };
 
@@ -33,6 +33,41 @@ namespace icamera {
 std::vector<IntelCca::CCAHandle> IntelCca::sCcaInstance;
 Mutex IntelCca::sLock;
 
+void* CcaShmMem::allocate(const std::string& name, int size) {
+    release();
+
+    mMem.mName = name;
+    mMem.mSize = size;
+    mShared = (mAlgoClient != nullptr) &&
+              mAlgoClient->allocShmMem(mMem.mName, mMem.mSize, &mMem.mAddr, mMem.mHandle);
+    if (mShared) {
+        memset(mMem.mAddr, 0, size);
+    } else {
+        LOGW("@%s, no shared memory for %s, use heap memory", __func__, name.c_str());
+        mMem.mAddr = calloc(1, size);
+    }
+
+    return mMem.mAddr;
+}
+
+void CcaShmMem::release() {
+    if (mMem.mAddr == nullptr) return;
+
+    if (mShared) {
+        mAlgoClient->freeShmMem(mMem.mName, mMem.mAddr, mMem.mHandle);
+    } else {
+        free(mMem.mAddr);
+    }
+    mMem.mAddr = nullptr;
+    mShared = false;
+}
+
+// The handle of the shared memory starting at addr, -1 if addr isn't in the shared memory
+static int32_t getInPlaceHandle(const void* addr) {
+    const uint32_t handle = mAlgoClient->getShmMemHandle(const_cast<void*>(addr));
+    return (handle == 0U) ? -1 : static_cast<int32_t>(handle);
+}
+
 IntelCca* IntelCca::getInstance(int cameraId, TuningMode mode) {
     AutoMutex lock(sLock);
     for (auto& it : sCcaInstance) {
@@ -195,6 +230,7 @@ ia_err IntelCca::configAic(const cca::cca_aic_config& aicConf,
                            const cca::cca_aic_kernel_offset& kernelOffset, uint32_t* offsetPtr,
                            cca::cca_aic_terminal_config& termConfig, int32_t aicId,
                            const int32_t* statsBufToTermIds) {
+    AutoMutex lock(mAicControlLock);
     LOG2(" %s ", __func__);
     intel_cca_aic_control_data* aicControl =
         static_cast<intel_cca_aic_control_data*>(mMemAICControl.mAddr);
@@ -215,6 +251,7 @@ ia_err IntelCca::configAic(const cca::cca_aic_config& aicConf,
 }
 
 ia_err IntelCca::registerAicBuf(const cca::cca_aic_terminal_config& termConfig, int32_t aicId) {
+    AutoMutex lock(mAicControlLock);
     intel_cca_aic_control_data* aicControl =
         static_cast<intel_cca_aic_control_data*>(mMemAICControl.mAddr);
     aicControl->aicId = aicId;
@@ -228,6 +265,7 @@ ia_err IntelCca::registerAicBuf(const cca::cca_aic_terminal_config& termConfig,
 }
 
 ia_err IntelCca::getAicBuf(cca::cca_aic_terminal_config& termConfig, int32_t aicId) {
+    AutoMutex lock(mAicControlLock);
     intel_cca_aic_control_data* aicControl =
         static_cast<intel_cca_aic_control_data*>(mMemAICControl.mAddr);
     aicControl->aicId = aicId;
@@ -244,6 +282,7 @@ ia_err IntelCca::getAicBuf(cca::cca_aic_terminal_config& termConfig, int32_t aic
 
 ia_err IntelCca::decodeStats(int32_t groupId, int64_t sequence, int32_t aicId,
                              cca::cca_out_stats* outStats) {
+    AutoMutex lock(mDecodeStatsLock);
     intel_cca_decode_stats_data* decodeStats =
         static_cast<intel_cca_decode_stats_data*>(mMemDecodeStats.mAddr);
 
@@ -272,6 +311,7 @@ ia_err IntelCca::decodeStats(int32_t groupId, int64_t sequence, int32_t aicId,
 
 ia_err IntelCca::runAIC(uint64_t frameId, const cca::cca_pal_input_params* params, uint8_t bitmap,
                         int32_t aicId) {
+    AutoMutex lock(mAicLock);
     intel_cca_run_aic_data* aicParams = static_cast<intel_cca_run_aic_data*>(mMemAIC.mAddr);
     aicParams->frameId = frameId;
     aicParams->inParamsHandle = mAlgoClient->getShmMemHandle((void*)params);
@@ -285,6 +325,7 @@ ia_err IntelCca::runAIC(uint64_t frameId, const cca::cca_pal_input_params* param
 
 ia_err IntelCca::updateConfigurationResolutions(const cca::cca_aic_config& aicConf,
                                                 int32_t aicId, bool isKeyResChanged) {
+    AutoMutex lock(mAicControlLock);
     intel_cca_aic_control_data* aicControl =
         static_cast<intel_cca_aic_control_data*>(mMemAICControl.mAddr);
 
@@ -308,7 +349,10 @@ ia_err IntelCca::setStatsParams(const cca::cca_stats_params& params) {
     intel_cca_set_stats_data* statsParams = static_cast<intel_cca_set_stats_data*>(mMemStats.mAddr);
     statsParams->cameraId = mCameraId;
     statsParams->tuningMode = mTuningMode;
-    statsParams->inParams = params;
+    statsParams->inParamsHandle = getInPlaceHandle(&params);
+    if (statsParams->inParamsHandle < 0) {
+        statsParams->inParams = params;
+    }
 
     int ret = mAlgoClient->setStats(mCameraId, mTuningMode, mMemStats.mHandle);
 
@@ -347,12 +391,18 @@ ia_err IntelCca::runAIQ(uint64_t frameId, const cca::cca_aiq_params& params,
     aiqParams->cameraId = mCameraId;
     aiqParams->tuningMode = mTuningMode;
     aiqParams->frameId = frameId;
-    aiqParams->inParams = params;
+    aiqParams->inParamsHandle = getInPlaceHandle(&params);
+    if (aiqParams->inParamsHandle < 0) {
+        aiqParams->inParams = params;
+    }
+    aiqParams->resultsHandle = getInPlaceHandle(results);
 
     int ret = mAlgoClient->runAiq(mCameraId, mTuningMode, mMemAIQ.mHandle);
     if (ret != 0) return ia_err_general;
 
-    *results = aiqParams->results;
+    if (aiqParams->resultsHandle < 0) {
+        *results = aiqParams->results;
+    }
 
     return ia_err_none;
 }
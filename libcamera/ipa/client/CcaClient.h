@@ -26,6 +26,7 @@
 
 #include "CameraTypes.h"
 #include "iutils/Thread.h"
+#include "iutils/Utils.h"
 
 #include "IPCCca.h"
 
@@ -46,6 +47,41 @@ typedef struct ShmMem {
     bool allocated;
 } ShmMem;
 
+/**
+ * \class CcaShmMem
+ *
+ * Shared memory of the IPA server owned by the users of IntelCca. When the params or the
+ * results of IntelCca are placed in it, only its handle is sent and the server works on
+ * them in place, instead of copying them to and from the shared memory of IntelCca.
+ * It falls back to the heap memory if the shared memory isn't available.
+ */
+class CcaShmMem {
+ public:
+    CcaShmMem() : mShared(false) {}
+    ~CcaShmMem() { release(); }
+
+    void* allocate(const std::string& name, int size);
+    void release();
+    void* addr() const { return mMem.mAddr; }
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(CcaShmMem);
+
+    ShmMemInfo mMem;
+    bool mShared;
+};
+
+template <typename T>
+class CcaShmStruct {
+ public:
+    void allocate(const std::string& name) { mMem.allocate(name, sizeof(T)); }
+    T* get() const { return static_cast<T*>(mMem.addr()); }
+    T* operator->() const { return get(); }
+
+ private:
+    CcaShmMem mMem;
+};
+
 class IntelCca {
  public:
     static IntelCca* getInstance(int cameraId, TuningMode mode);
@@ -54,6 +90,7 @@ class IntelCca {
     ia_err init(const cca::cca_init_params& initParams);
     ia_err reinitAic(uint32_t aicId);
 
+    // The params and the results placed in CcaShmMem are not copied, see CcaShmMem
     ia_err setStatsParams(const cca::cca_stats_params& params);
 
     ia_err runAEC(uint64_t frameId, const cca::cca_ae_input_params& params,
@@ -118,6 +155,11 @@ class IntelCca {
     ShmMemInfo mMemDeinit;
     ShmMemInfo mMemDecodeStats;
 
+    // The AIC calls of the streams may run concurrently, guard their shared memories
+    Mutex mAicLock;  // for mMemAIC
+    Mutex mAicControlLock;  // for mMemAICControl
+    Mutex mDecodeStatsLock;  // for mMemDecodeStats
+
     std::vector<ShmMem> mMems;
 
     std::unordered_map<void*, ShmMemInfo> mMemsOuter;
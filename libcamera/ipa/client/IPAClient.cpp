@@ -220,6 +220,7 @@ void IPAClient::freeShmMem(const std::string& name, void* addr, uint32_t handle)
 
         mIPAMemory.freeBuffer(name, buffer, addr);
         mFrameBufferMap.erase(addr);
+        mShmMap.erase(addr);
 
         return;
     }
@@ -162,7 +162,17 @@ int CcaWorker::setStats(uint8_t* pData) {
 
     intel_cca_set_stats_data* params = reinterpret_cast<intel_cca_set_stats_data*>(pData);
 
-    ia_err ret = mCca->setStatsParams(params->inParams);
+    const cca::cca_stats_params* inParams = &params->inParams;
+    if (params->inParamsHandle >= 0) {
+        inParams = static_cast<cca::cca_stats_params*>(
+            mIPACallback->getBuffer(params->inParamsHandle));
+        if (!inParams) {
+            LOG(IPAIPU, Error) << "failed to get stats params";
+            return static_cast<int>(ia_err_argument);
+        }
+    }
+
+    ia_err ret = mCca->setStatsParams(*inParams);
 
     return static_cast<int>(ret);
 }
@@ -182,7 +192,27 @@ int CcaWorker::runAIQ(uint8_t* pData) {
 
     intel_cca_run_aiq_data* params = reinterpret_cast<intel_cca_run_aiq_data*>(pData);
 
-    ia_err ret = mCca->runAIQ(params->frameId, params->inParams, &params->results);
+    const cca::cca_aiq_params* inParams = &params->inParams;
+    if (params->inParamsHandle >= 0) {
+        inParams = static_cast<cca::cca_aiq_params*>(
+            mIPACallback->getBuffer(params->inParamsHandle));
+        if (!inParams) {
+            LOG(IPAIPU, Error) << "failed to get aiq params";
+            return static_cast<int>(ia_err_argument);
+        }
+    }
+
+    cca::cca_aiq_results* results = &params->results;
+    if (params->resultsHandle >= 0) {
+        results = static_cast<cca::cca_aiq_results*>(
+            mIPACallback->getBuffer(params->resultsHandle));
+        if (!results) {
+            LOG(IPAIPU, Error) << "failed to get aiq results";
+            return static_cast<int>(ia_err_argument);
+        }
+    }
+
+    ia_err ret = mCca->runAIQ(params->frameId, *inParams, results);
 
     return static_cast<int>(ret);
 }
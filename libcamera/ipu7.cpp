@@ -153,7 +153,7 @@ class IPU7CameraData : public Camera::Private, public icamera::EventListener {
     void bindListeners();
     void unbindListeners();
     int handleQueueBuffer(int bufferNum, camera_buffer_t** ubuffer, int64_t sequence);
-    void handleEvent(EventData eventData);
+    void handleEvent(const EventData& eventData) override;
 
  private:
     // Pipeline elements
@@ -1239,7 +1239,7 @@ void IPU7CameraData::deleteStreams() {
     mStreamNum = 0;
 }
 
-void IPU7CameraData::handleEvent(EventData eventData) {
+void IPU7CameraData::handleEvent(const EventData& eventData) {
     switch (eventData.type) {
         case EVENT_PROCESS_REQUEST: {
             const EventRequestData& request = eventData.data.request;
@@ -63,6 +63,26 @@ void IntelCca::releaseInstance(int cameraId, TuningMode mode) {
     }
 }
 
+#ifdef MODULE_TEST
+void IntelCca::updateInstance(int cameraId, TuningMode mode, IntelCca* instance) {
+    LOG2("<id%d>@%s, tuningMode:%d", cameraId, __func__, mode);
+
+    releaseInstance(cameraId, mode);
+    AutoMutex lock(sLock);
+    for (auto &it : sCcaInstance) {
+        if (cameraId == it.cameraId) {
+            it.ccaHandle[mode] = instance;
+            return;
+        }
+    }
+
+    IntelCca::CCAHandle handle = {};
+    handle.cameraId = cameraId;
+    handle.ccaHandle[mode] = instance;
+    sCcaInstance.push_back(handle);
+}
+#endif
+
 IntelCca::IntelCca(int cameraId, TuningMode mode) :
     mCameraId(cameraId),
     mTuningMode(mode) {
@@ -188,6 +208,7 @@ ia_err IntelCca::configAic(const cca::cca_aic_config& aicConf,
                            const cca::cca_aic_kernel_offset& kernelOffset, uint32_t* offsetPtr,
                            cca::cca_aic_terminal_config& termConfig, int32_t aicId,
                            const int32_t* statsBufToTermIds) {
+    AutoMutex lock(mAicControlLock);
     const ia_err ret = getIntelCCA()->configAIC(aicConf, kernelOffset, termConfig, aicId,
                                           statsBufToTermIds);
     LOG2("@%s, ret:%d", __func__, ret);
@@ -196,6 +217,7 @@ ia_err IntelCca::configAic(const cca::cca_aic_config& aicConf,
 }
 
 ia_err IntelCca::registerAicBuf(const cca::cca_aic_terminal_config& termConfig, int32_t aicId) {
+    AutoMutex lock(mAicControlLock);
     const ia_err ret = getIntelCCA()->registerAICBuf(termConfig, aicId);
     LOG2("@%s, ret:%d", __func__, ret);
 
@@ -203,6 +225,7 @@ ia_err IntelCca::registerAicBuf(const cca::cca_aic_terminal_config& termConfig,
 }
 
 ia_err IntelCca::getAicBuf(cca::cca_aic_terminal_config& termConfig, int32_t aicId) {
+    AutoMutex lock(mAicControlLock);
     const ia_err ret = getIntelCCA()->getAICBuf(termConfig, aicId);
     LOG2("@%s, ret:%d", __func__, ret);
 
@@ -211,6 +234,7 @@ ia_err IntelCca::getAicBuf(cca::cca_aic_terminal_config& termConfig, int32_t aic
 
 ia_err IntelCca::decodeStats(int32_t groupId, int64_t sequence, int32_t aicId,
                              cca::cca_out_stats* outStats) {
+    AutoMutex lock(mDecodeStatsLock);
     const ia_err ret = getIntelCCA()->decodeStats(groupId, sequence, aicId);
     LOG2("@%s, ret:%d", __func__, ret);
 
@@ -238,6 +262,7 @@ ia_err IntelCca::decodeStats(int32_t groupId, int64_t sequence, int32_t aicId,
 
 ia_err IntelCca::runAIC(uint64_t frameId, const cca::cca_pal_input_params* params,
                          uint8_t bitmap, int32_t aicId) {
+    AutoMutex lock(mAicLock);
     cca::cca_multi_pal_output output = {};
     const ia_err ret = getIntelCCA()->runAIC(frameId, *params, output, bitmap, aicId);
     LOG2("@%s, ret:%d", __func__, ret);
@@ -247,6 +272,7 @@ ia_err IntelCca::runAIC(uint64_t frameId, const cca::cca_pal_input_params* param
 
 ia_err IntelCca::updateConfigurationResolutions(const cca::cca_aic_config& aicConf,
                                                 int32_t aicId, bool isKeyResChanged) {
+    AutoMutex lock(mAicControlLock);
     const ia_err ret =
         getIntelCCA()->updateConfigurationResolutions(aicConf, aicId, isKeyResChanged);
     LOG2("@%s, ret:%d ", __func__, ret);
@@ -35,9 +35,13 @@ class IntelCca {
 
     static IntelCca* getInstance(int cameraId, TuningMode mode);
     static void releaseInstance(int cameraId, TuningMode mode);
+#ifdef MODULE_TEST
+    // Replace the instance of cameraId and mode, it is deleted by releaseInstance()
+    static void updateInstance(int cameraId, TuningMode mode, IntelCca* instance);
+#endif
 
     ia_err init(const cca::cca_init_params& initParams);
-    ia_err reinitAic(const int32_t aicId);
+    virtual ia_err reinitAic(const int32_t aicId);
 
     ia_err setStatsParams(const cca::cca_stats_params& params);
 
@@ -53,24 +57,25 @@ class IntelCca {
     ia_err getMKN(ia_mkn_trg type, cca::cca_mkn* mkn);
     ia_err getAiqd(cca::cca_aiqd* aiqd);
 
-    void* allocMem(int streamId, const std::string& name, int index, int size);
-    void freeMem(void* addr);
+    virtual void* allocMem(int streamId, const std::string& name, int index, int size);
+    virtual void freeMem(void* addr);
 
     void deinit();
 
-    ia_err configAic(const cca::cca_aic_config& aicConf,
-                     const cca::cca_aic_kernel_offset& kernelOffset, uint32_t* offsetPtr,
-                     cca::cca_aic_terminal_config& termConfig, int32_t aicId,
-                     const int32_t* statsBufToTermIds);
-    ia_err registerAicBuf(const cca::cca_aic_terminal_config& termConfig, int32_t aicId);
-    ia_err getAicBuf(cca::cca_aic_terminal_config& termConfig, int32_t aicId);
-    ia_err decodeStats(int32_t groupId, int64_t sequence, int32_t aicId,
-                       cca::cca_out_stats* outStats);
-    ia_err runAIC (uint64_t frameId, const cca::cca_pal_input_params* params,
-                   uint8_t bitmap, int32_t aicId);
-
-    ia_err updateConfigurationResolutions(const cca::cca_aic_config& aicConf,
-                                          int32_t aicId, bool isKeyResChanged);
+    // The AIC calls are virtual for the mock CCA of the tests, see updateInstance()
+    virtual ia_err configAic(const cca::cca_aic_config& aicConf,
+                             const cca::cca_aic_kernel_offset& kernelOffset, uint32_t* offsetPtr,
+                             cca::cca_aic_terminal_config& termConfig, int32_t aicId,
+                             const int32_t* statsBufToTermIds);
+    virtual ia_err registerAicBuf(const cca::cca_aic_terminal_config& termConfig, int32_t aicId);
+    virtual ia_err getAicBuf(cca::cca_aic_terminal_config& termConfig, int32_t aicId);
+    virtual ia_err decodeStats(int32_t groupId, int64_t sequence, int32_t aicId,
+                               cca::cca_out_stats* outStats);
+    virtual ia_err runAIC (uint64_t frameId, const cca::cca_pal_input_params* params,
+                           uint8_t bitmap, int32_t aicId);
+
+    virtual ia_err updateConfigurationResolutions(const cca::cca_aic_config& aicConf,
+                                                  int32_t aicId, bool isKeyResChanged);
 
  private:
     cca::IntelCCA* getIntelCCA();
@@ -87,5 +92,10 @@ class IntelCca {
     static Mutex sLock;
 
     cca::IntelCCA* mIntelCCA;
+
+    // The streams call the AIC APIs concurrently, serialize the same kind of calls
+    Mutex mAicLock;  // for runAIC
+    Mutex mAicControlLock;  // for the AIC config and buffer calls
+    Mutex mDecodeStatsLock;  // for decodeStats and its latest stats query
 };
 } /* namespace icamera */
@@ -125,6 +125,7 @@ public:
 protected:
     StaticGraphStatus updateRunKernelPassThrough(StaticGraphRunKernel* runKernel, uint32_t width, uint32_t height);
     StaticGraphStatus updateRunKernelResolutionHistory(StaticGraphRunKernel* runKernel, StaticGraphRunKernel* prevRunKernel, bool updateResolution = true);
+    StaticGraphKernelResCrop getResolutionHistoryCrop(StaticGraphRunKernel* prevRunKernel);
 
     IStaticGraphConfig* _staticGraph;
     double _widthIn2OutScale = 1;
@@ -158,6 +159,8 @@ private:
     StaticGraphStatus updateRunKernelFinalCropper(StaticGraphRunKernel* runKernel, uint32_t inputWidth, uint32_t inputHeight,
         uint32_t outputWidth, uint32_t outputHeight);
     StaticGraphStatus updateCroppingScaler(StaticGraphRunKernel* downscalerRunKernel, StaticGraphRunKernel* upscalerRunKernel);
+    StaticGraphStatus updateResolutionHistoryOfKernelsForUpdate(StaticGraphRunKernel* cropperRunKernel);
+    void getUpscalerSteps(uint32_t outputWidth, uint32_t outputHeight, uint32_t& stepW, uint32_t& stepH);
 
     RunKernelCoords _downscalerRunKernelCoord;
     RunKernelCoords _upscalerRunKernelCoord;
@@ -165,6 +168,16 @@ private:
     RunKernelCoords _outputRunKernelCoord;
     std::vector<RunKernelCoords> _kernelsForUpdate;
 
+    // Upscaler steps (see updateRunKernelUpScaler) of the output resolutions seen so far
+    struct UpscalerSteps
+    {
+        uint32_t width;
+        uint32_t height;
+        uint32_t stepW;
+        uint32_t stepH;
+    };
+    std::vector<UpscalerSteps> _upscalerSteps;
+
     StaticGraphKernelResCrop _originalCropOfFinalCropper = { 0,0,0,0 };
     StaticGraphKernelResCrop _originalCropInputToScaler = {0,0,0,0};
     StaticGraphKernelResCrop _originalCropScalerToOutput = { 0,0,0,0 };
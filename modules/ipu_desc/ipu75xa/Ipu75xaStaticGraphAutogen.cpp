@@ -10393,7 +10393,7 @@ StaticGraphStatus StaticGraph100000::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100000::~StaticGraph100000()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100000::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -10773,7 +10773,7 @@ StaticGraphStatus StaticGraph100001::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100001::~StaticGraph100001()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100001::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -11088,7 +11088,7 @@ StaticGraphStatus StaticGraph100002::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100002::~StaticGraph100002()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100002::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -11449,7 +11449,7 @@ StaticGraphStatus StaticGraph100003::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100003::~StaticGraph100003()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100003::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -11827,7 +11827,7 @@ StaticGraphStatus StaticGraph100005::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100005::~StaticGraph100005()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100005::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -12414,7 +12414,7 @@ StaticGraphStatus StaticGraph100006::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100006::~StaticGraph100006()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100006::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -12839,7 +12839,7 @@ StaticGraphStatus StaticGraph100007::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100007::~StaticGraph100007()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100007::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -13271,7 +13271,7 @@ StaticGraphStatus StaticGraph100008::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100008::~StaticGraph100008()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100008::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -13708,7 +13708,7 @@ StaticGraphStatus StaticGraph100015::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100015::~StaticGraph100015()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100015::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -13871,7 +13871,7 @@ StaticGraphStatus StaticGraph100016::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100016::~StaticGraph100016()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100016::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -14098,7 +14098,7 @@ StaticGraphStatus StaticGraph100025::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100025::~StaticGraph100025()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100025::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -14262,7 +14262,7 @@ StaticGraphStatus StaticGraph100026::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100026::~StaticGraph100026()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100027
@@ -14459,7 +14459,7 @@ StaticGraphStatus StaticGraph100027::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100027::~StaticGraph100027()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100027::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -14719,7 +14719,7 @@ StaticGraphStatus StaticGraph100028::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100028::~StaticGraph100028()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100028::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -15043,7 +15043,7 @@ StaticGraphStatus StaticGraph100029::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100029::~StaticGraph100029()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100029::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -15359,7 +15359,7 @@ StaticGraphStatus StaticGraph100030::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100030::~StaticGraph100030()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100030::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -15706,7 +15706,7 @@ StaticGraphStatus StaticGraph100031::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100031::~StaticGraph100031()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100031::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -16097,7 +16097,7 @@ StaticGraphStatus StaticGraph100032::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100032::~StaticGraph100032()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100032::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -16477,7 +16477,7 @@ StaticGraphStatus StaticGraph100033::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100033::~StaticGraph100033()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100033::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -16897,7 +16897,7 @@ StaticGraphStatus StaticGraph100034::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100034::~StaticGraph100034()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100034::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -17088,7 +17088,7 @@ StaticGraphStatus StaticGraph100035::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100035::~StaticGraph100035()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100036
@@ -17188,7 +17188,7 @@ StaticGraphStatus StaticGraph100036::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100036::~StaticGraph100036()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100037
@@ -17486,7 +17486,7 @@ StaticGraphStatus StaticGraph100037::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100037::~StaticGraph100037()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100037::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -17862,7 +17862,7 @@ StaticGraphStatus StaticGraph100038::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100038::~StaticGraph100038()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100038::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -18520,7 +18520,7 @@ StaticGraphStatus StaticGraph100039::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100039::~StaticGraph100039()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100039::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -19148,7 +19148,7 @@ StaticGraphStatus StaticGraph100040::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100040::~StaticGraph100040()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100040::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -19569,7 +19569,7 @@ StaticGraphStatus StaticGraph100041::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100041::~StaticGraph100041()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100041::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -19955,7 +19955,7 @@ StaticGraphStatus StaticGraph100042::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100042::~StaticGraph100042()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100042::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -20360,7 +20360,7 @@ StaticGraphStatus StaticGraph100044::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100044::~StaticGraph100044()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100044::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -20735,7 +20735,7 @@ StaticGraphStatus StaticGraph100050::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100050::~StaticGraph100050()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100050::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -21110,7 +21110,7 @@ StaticGraphStatus StaticGraph100051::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100051::~StaticGraph100051()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100051::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -21460,7 +21460,7 @@ StaticGraphStatus StaticGraph100052::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100052::~StaticGraph100052()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100052::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -21851,7 +21851,7 @@ StaticGraphStatus StaticGraph100053::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100053::~StaticGraph100053()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100053::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -22231,7 +22231,7 @@ StaticGraphStatus StaticGraph100054::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100054::~StaticGraph100054()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100054::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -22651,7 +22651,7 @@ StaticGraphStatus StaticGraph100055::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100055::~StaticGraph100055()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100055::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -23040,7 +23040,7 @@ StaticGraphStatus StaticGraph100056::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100056::~StaticGraph100056()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100056::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -23461,7 +23461,7 @@ StaticGraphStatus StaticGraph100057::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100057::~StaticGraph100057()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100057::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -26,6 +26,7 @@
 */
 
 #include "Ipu75xaStaticGraphReaderAutogen.h"
+#include <algorithm>
 #include <cstring>
 
 StaticGraphStatus StaticGraphReader::Init(StaticReaderBinaryData& binaryGraphSettings) {
@@ -77,9 +78,69 @@ StaticGraphStatus StaticGraphReader::Init(StaticReaderBinaryData& binaryGraphSet
     currOffset += sizeof(SensorMode)*_binaryHeader.numberOfSensorModes;
     _configurationData = currOffset;
 
+    BuildHeaderIndex();
+
     return StaticGraphStatus::SG_OK;
 }
 
+namespace {
+struct SettingsKeyLess {
+    const GraphConfigurationHeader* headers;
+    bool operator()(uint32_t a, uint32_t b) const {
+        return memcmp(&headers[a].settingsKey, &headers[b].settingsKey, sizeof(GraphConfigurationKey)) < 0;
+    }
+    bool operator()(uint32_t a, const GraphConfigurationKey& key) const {
+        return memcmp(&headers[a].settingsKey, &key, sizeof(GraphConfigurationKey)) < 0;
+    }
+    bool operator()(const GraphConfigurationKey& key, uint32_t b) const {
+        return memcmp(&key, &headers[b].settingsKey, sizeof(GraphConfigurationKey)) < 0;
+    }
+};
+
+struct DataOffsetLess {
+    const GraphConfigurationHeader* headers;
+    bool operator()(uint32_t a, uint32_t b) const {
+        return headers[a].resConfigDataOffset < headers[b].resConfigDataOffset;
+    }
+};
+}  // namespace
+
+void StaticGraphReader::BuildHeaderIndex()
+{
+    _settingsKeyIndex.resize(_binaryHeader.numberOfResolutions);
+    for (uint32_t i = 0; i < _binaryHeader.numberOfResolutions; i++)
+    {
+        _settingsKeyIndex[i] = i;
+    }
+    _dataOffsetIndex = _settingsKeyIndex;
+
+    // Stable, the headers of the same key keep the binary order
+    std::stable_sort(_settingsKeyIndex.begin(), _settingsKeyIndex.end(), SettingsKeyLess{_graphConfigurationHeaders});
+    std::stable_sort(_dataOffsetIndex.begin(), _dataOffsetIndex.end(), DataOffsetLess{_graphConfigurationHeaders});
+}
+
+StaticGraphReader::HeaderIndexRange StaticGraphReader::GetHeadersBySettingsKey(const GraphConfigurationKey& settingsKey) const
+{
+    auto range = std::equal_range(_settingsKeyIndex.begin(), _settingsKeyIndex.end(), settingsKey,
+                                  SettingsKeyLess{_graphConfigurationHeaders});
+    return HeaderIndexRange{range.first, range.second};
+}
+
+StaticGraphReader::HeaderIndexRange StaticGraphReader::GetHeadersByDataOffset(int32_t resConfigDataOffset) const
+{
+    const GraphConfigurationHeader* headers = _graphConfigurationHeaders;
+    auto first = std::lower_bound(_dataOffsetIndex.begin(), _dataOffsetIndex.end(), resConfigDataOffset,
+                                  [headers](uint32_t index, int32_t offset) {
+                                      return headers[index].resConfigDataOffset < offset;
+                                  });
+    auto last = first;
+    while (last != _dataOffsetIndex.end() && headers[*last].resConfigDataOffset == resConfigDataOffset)
+    {
+        ++last;
+    }
+    return HeaderIndexRange{first, last};
+}
+
 std::pair<int, const GraphConfigurationHeader*> StaticGraphReader::GetGraphConfigurationHeaders() const 
 {
     return std::make_pair(_binaryHeader.numberOfResolutions, _graphConfigurationHeaders);
@@ -103,7 +164,7 @@ StaticGraphStatus StaticGraphReader::GetStaticGraphConfig(GraphConfigurationKey&
     GraphConfigurationHeader** selectedGraphConfigurationHeaders = new GraphConfigurationHeader*[_zoomKeyResolutions.numberOfZoomKeyOptions+1];
     uint32_t selectedConfigurationsCount = 0;
 
-    for (uint32_t i=0; i < _binaryHeader.numberOfResolutions; i++)
+    for (const uint32_t i : GetHeadersBySettingsKey(settingsKey))
     {
         if (memcmp ( &_graphConfigurationHeaders[i].settingsKey,
             &settingsKey,
@@ -164,7 +225,7 @@ StaticGraphStatus StaticGraphReader::GetStaticGraphConfig(GraphConfigurationKey&
 
     GraphConfigurationHeader* baseGraphConfigurationHeader = nullptr;
 
-    for (uint32_t i = 0; i < _binaryHeader.numberOfResolutions; i++)
+    for (const uint32_t i : GetHeadersByDataOffset(selectedGraphConfigurationHeader->resConfigDataOffset))
     {
         if (_graphConfigurationHeaders[i].resConfigDataOffset == selectedGraphConfigurationHeader->resConfigDataOffset)
         {
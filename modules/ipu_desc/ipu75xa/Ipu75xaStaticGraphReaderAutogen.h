@@ -29,6 +29,7 @@
 #define STATIC_GRAPH_READER_H
 
 #include <utility>
+#include <vector>
 #include "Ipu75xaStaticGraphBinaryAutogen.h"
 #include "Ipu75xaStaticGraphAutogen.h"
 
@@ -84,6 +85,16 @@ public:
     std::pair<int, const GraphConfigurationHeader*> GetGraphConfigurationHeaders() const;
     static const uint32_t staticGraphCommonHashCode = 847164584; // autogenerated
 private:
+    // Header indices of the same settings key or configuration data, in the binary order
+    struct HeaderIndexRange {
+        std::vector<uint32_t>::const_iterator first;
+        std::vector<uint32_t>::const_iterator last;
+        std::vector<uint32_t>::const_iterator begin() const { return first; }
+        std::vector<uint32_t>::const_iterator end() const { return last; }
+    };
+    void BuildHeaderIndex();
+    HeaderIndexRange GetHeadersBySettingsKey(const GraphConfigurationKey& settingsKey) const;
+    HeaderIndexRange GetHeadersByDataOffset(int32_t resConfigDataOffset) const;
     void GetSinkMappingConfiguration(GraphConfigurationHeader* baseGraphConfigurationHeader, VirtualSinkMapping* baseSinkMappingConfiguration,
                                      GraphConfigurationHeader* selectedGraphConfigurationHeader, VirtualSinkMapping* selectedSinkMappingConfiguration);
     BinaryHeader _binaryHeader;
@@ -91,6 +102,9 @@ private:
     SensorMode* _sensorModes = nullptr;
     int8_t* _configurationData = nullptr;
     ZoomKeyResolutions _zoomKeyResolutions;
+    // Sorted once in Init() so that the lookups don't scan all the headers
+    std::vector<uint32_t> _settingsKeyIndex;
+    std::vector<uint32_t> _dataOffsetIndex;
 };
 
 #endif
\ No newline at end of file
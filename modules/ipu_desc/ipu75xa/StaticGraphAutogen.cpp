@@ -10150,7 +10150,7 @@ StaticGraphStatus StaticGraph100000::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100000::~StaticGraph100000() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100000::configInnerNodes(
@@ -10536,7 +10536,7 @@ StaticGraphStatus StaticGraph100001::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100001::~StaticGraph100001() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100001::configInnerNodes(
@@ -10882,7 +10882,7 @@ StaticGraphStatus StaticGraph100002::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100002::~StaticGraph100002() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100002::configInnerNodes(
@@ -11259,7 +11259,7 @@ StaticGraphStatus StaticGraph100003::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100003::~StaticGraph100003() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100003::configInnerNodes(
@@ -11671,7 +11671,7 @@ StaticGraphStatus StaticGraph100005::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100005::~StaticGraph100005() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100005::configInnerNodes(
@@ -12303,7 +12303,7 @@ StaticGraphStatus StaticGraph100006::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100006::~StaticGraph100006() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100006::configInnerNodes(
@@ -12809,7 +12809,7 @@ StaticGraphStatus StaticGraph100007::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100007::~StaticGraph100007() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100007::configInnerNodes(
@@ -13267,7 +13267,7 @@ StaticGraphStatus StaticGraph100008::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100008::~StaticGraph100008() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100008::configInnerNodes(
@@ -13736,7 +13736,7 @@ StaticGraphStatus StaticGraph100015::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100015::~StaticGraph100015() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100015::configInnerNodes(
@@ -13897,7 +13897,7 @@ StaticGraphStatus StaticGraph100016::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100016::~StaticGraph100016() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100016::configInnerNodes(
@@ -14120,7 +14120,7 @@ StaticGraphStatus StaticGraph100025::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100025::~StaticGraph100025() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100025::configInnerNodes(
@@ -14287,7 +14287,7 @@ StaticGraphStatus StaticGraph100026::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100026::~StaticGraph100026() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100027
@@ -14488,7 +14488,7 @@ StaticGraphStatus StaticGraph100027::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100027::~StaticGraph100027() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100027::configInnerNodes(
@@ -14756,7 +14756,7 @@ StaticGraphStatus StaticGraph100028::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100028::~StaticGraph100028() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100028::configInnerNodes(
@@ -15090,7 +15090,7 @@ StaticGraphStatus StaticGraph100029::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100029::~StaticGraph100029() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100029::configInnerNodes(
@@ -15426,7 +15426,7 @@ StaticGraphStatus StaticGraph100030::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100030::~StaticGraph100030() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100030::configInnerNodes(
@@ -15797,7 +15797,7 @@ StaticGraphStatus StaticGraph100031::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100031::~StaticGraph100031() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100031::configInnerNodes(
@@ -16204,7 +16204,7 @@ StaticGraphStatus StaticGraph100032::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100032::~StaticGraph100032() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100032::configInnerNodes(
@@ -16614,7 +16614,7 @@ StaticGraphStatus StaticGraph100033::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100033::~StaticGraph100033() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100033::configInnerNodes(
@@ -17052,7 +17052,7 @@ StaticGraphStatus StaticGraph100034::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100034::~StaticGraph100034() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100034::configInnerNodes(
@@ -17265,7 +17265,7 @@ StaticGraphStatus StaticGraph100035::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100035::~StaticGraph100035() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100036
@@ -17366,7 +17366,7 @@ StaticGraphStatus StaticGraph100036::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100036::~StaticGraph100036() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100037
@@ -17670,7 +17670,7 @@ StaticGraphStatus StaticGraph100037::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100037::~StaticGraph100037() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100037::configInnerNodes(
@@ -18081,7 +18081,7 @@ StaticGraphStatus StaticGraph100038::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100038::~StaticGraph100038() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100038::configInnerNodes(
@@ -18800,7 +18800,7 @@ StaticGraphStatus StaticGraph100039::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100039::~StaticGraph100039() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100039::configInnerNodes(
@@ -19559,7 +19559,7 @@ StaticGraphStatus StaticGraph100040::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100040::~StaticGraph100040() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100040::configInnerNodes(
@@ -20019,7 +20019,7 @@ StaticGraphStatus StaticGraph100041::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100041::~StaticGraph100041() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100041::configInnerNodes(
@@ -20442,7 +20442,7 @@ StaticGraphStatus StaticGraph100042::updateConfiguration(uint32_t selectedIndex)
 
 StaticGraph100042::~StaticGraph100042() {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100042::configInnerNodes(
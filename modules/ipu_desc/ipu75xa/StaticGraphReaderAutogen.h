@@ -17,6 +17,7 @@
 #ifndef STATIC_GRAPH_READER_H
 #define STATIC_GRAPH_READER_H
 
+#include <vector>
 #include "StaticGraphBinaryAutogen.h"
 #include "StaticGraphAutogen.h"
 
@@ -66,6 +67,16 @@ class StaticGraphReader {
                                            IStaticGraphConfig** graph);
     static const uint32_t staticGraphCommonHashCode = 361789904;  // autogenerated
  private:
+    // Header indices of the same settings key or configuration data, in the binary order
+    struct HeaderIndexRange {
+        std::vector<uint32_t>::const_iterator first;
+        std::vector<uint32_t>::const_iterator last;
+        std::vector<uint32_t>::const_iterator begin() const { return first; }
+        std::vector<uint32_t>::const_iterator end() const { return last; }
+    };
+    void BuildHeaderIndex();
+    HeaderIndexRange GetHeadersBySettingsKey(const GraphConfigurationKey& settingsKey) const;
+    HeaderIndexRange GetHeadersByDataOffset(int32_t resConfigDataOffset) const;
     void GetSinkMappingConfiguration(GraphConfigurationHeader* baseGraphConfigurationHeader,
                                      VirtualSinkMapping* baseSinkMappingConfiguration,
                                      GraphConfigurationHeader* selectedGraphConfigurationHeader,
@@ -75,6 +86,9 @@ class StaticGraphReader {
     SensorMode* _sensorModes = nullptr;
     int8_t* _configurationData = nullptr;
     ZoomKeyResolutions _zoomKeyResolutions;
+    // Sorted once in Init() so that the lookups don't scan all the headers
+    std::vector<uint32_t> _settingsKeyIndex;
+    std::vector<uint32_t> _dataOffsetIndex;
 };
 
 #endif
\ No newline at end of file
@@ -63,6 +63,15 @@
 
     _originalCropOfFinalCropper = cropperRunKernel->resolution_info->input_crop;
 
+    // Search the upscaler steps of the static output resolutions now, instead of on the first ROI update
+    auto upscalerRunKernel = getRunKernel(_upscalerRunKernelCoord);
+    uint32_t stepW = 1;
+    uint32_t stepH = 1;
+    getUpscalerSteps(cropperRunKernel->resolution_info->output_width, cropperRunKernel->resolution_info->output_height, stepW, stepH);
+    getUpscalerSteps(cropperRunKernel->resolution_info->output_width + _originalCropOfFinalCropper.left + _originalCropOfFinalCropper.right,
+        cropperRunKernel->resolution_info->output_height + _originalCropOfFinalCropper.top + _originalCropOfFinalCropper.bottom, stepW, stepH);
+    getUpscalerSteps(upscalerRunKernel->resolution_info->output_width, upscalerRunKernel->resolution_info->output_height, stepW, stepH);
+
     // Calculate total scaling between sensor and output
     // We want to calculate the scaling ratio without taking any cropping into consideration
     _widthIn2OutScale = static_cast<double>(outputRunKernel->resolution_history->input_width -
@@ -372,14 +381,9 @@ StaticGraphStatus GraphResolutionConfigurator::updateRunKernelOfScalers(bool fro
         cropperRunKernel->resolution_info->input_crop.bottom = roi.cropBottom;
 
         // Update resolution history for relevant kernels
-        for (auto& runKernelForUpdate : _kernelsForUpdate)
+        if (updateResolutionHistoryOfKernelsForUpdate(cropperRunKernel) != StaticGraphStatus::SG_OK)
         {
-            // We update all histories according to upscaler... ignoring any cropping from now on, even if we configured ESPA cropper.
-            StaticGraphRunKernel* runKernelPtr = getRunKernel(runKernelForUpdate);
-            if (updateRunKernelResolutionHistory(runKernelPtr, cropperRunKernel, false) != StaticGraphStatus::SG_OK)
-            {
-                ret = StaticGraphStatus::SG_ERROR;
-            }
+            ret = StaticGraphStatus::SG_ERROR;
         }
     }
     else
@@ -461,15 +465,10 @@ StaticGraphStatus GraphResolutionConfigurator::updateRunKernelOfScalers(bool fro
         }
 
         // Update resolution history for relevant kernels
-        for (auto& runKernelForUpdate : _kernelsForUpdate)
+        // Anna - I don't know why cropping was ignored. I think it should be after cropping
+        if (updateResolutionHistoryOfKernelsForUpdate(cropperRunKernel) != StaticGraphStatus::SG_OK)
         {
-            // We update all histories according to upscaler... ignoring any cropping from now on, even if we configured ESPA cropper.
-            // Anna - I don't know why cropping was ignored. I think it should be after cropping
-            StaticGraphRunKernel* runKernelPtr = getRunKernel(runKernelForUpdate);
-            if (updateRunKernelResolutionHistory(runKernelPtr, cropperRunKernel, false) != StaticGraphStatus::SG_OK)
-            {
-                ret = StaticGraphStatus::SG_ERROR;
-            }
+            ret = StaticGraphStatus::SG_ERROR;
         }
     }
 
@@ -642,16 +641,7 @@ StaticGraphStatus GraphResolutionConfigurator::updateRunKernelUpScaler(StaticGra
      // Find valid output configurations
     uint32_t stepW1 = 1;
     uint32_t stepH1 = 1;
-
-    for (stepH1 = 1; stepH1 < outputHeight / 2; stepH1++)
-    {
-        double horStep = static_cast<double>(stepH1) * outputWidth / 2 / outputHeight;
-        if (floor((horStep)) == horStep)
-        {
-            stepW1 = static_cast<uint32_t>(horStep) * 2;
-            break;
-        }
-    }
+    getUpscalerSteps(outputWidth, outputHeight, stepW1, stepH1);
 
     // Try to work with "sensor" resolution - take original ESPA crop's values
     // This is usually better when US output is not regular (and mp/dp cropping is used) and/or DS input is irregular (and ESPA is fixing A/R in original settings)
@@ -661,16 +651,7 @@ StaticGraphStatus GraphResolutionConfigurator::updateRunKernelUpScaler(StaticGra
 
     uint32_t stepW2 = 1;
     uint32_t stepH2 = 1;
-
-    for (stepH2 = 1; stepH2 < newOutputHeight / 2; stepH2++)
-    {
-        double horStep = static_cast<double>(stepH2) * newOutputWidth / 2 / newOutputHeight;
-        if (floor((horStep)) == horStep)
-        {
-            stepW2 = static_cast<uint32_t>(horStep) * 2;
-            break;
-        }
-    }
+    getUpscalerSteps(newOutputWidth, newOutputHeight, stepW2, stepH2);
 
      // Select which steps to take
     uint32_t stepW = stepW1;
@@ -688,18 +669,7 @@ StaticGraphStatus GraphResolutionConfigurator::updateRunKernelUpScaler(StaticGra
     newOutputWidth = runKernel->resolution_info->output_width;
     newOutputHeight = runKernel->resolution_info->output_height;
 
-    stepW2 = 1;
-    stepH2 = 1;
-
-    for (stepH2 = 1; stepH2 < newOutputHeight / 2; stepH2++)
-    {
-        double horStep = static_cast<double>(stepH2) * newOutputWidth / 2 / newOutputHeight;
-        if (floor((horStep)) == horStep)
-        {
-            stepW2 = static_cast<uint32_t>(horStep) * 2;
-            break;
-        }
-    }
+    getUpscalerSteps(newOutputWidth, newOutputHeight, stepW2, stepH2);
 
     // Select which steps to take
     if (stepW2 > 1 && stepW2 < stepW)
@@ -747,6 +717,34 @@ StaticGraphStatus GraphResolutionConfigurator::updateRunKernelUpScaler(StaticGra
     return ret;
 }
 
+// The steps only depend on the output resolution, which is one of a few per graph.
+// So they are searched once per resolution and kept for the next ROI updates.
+void GraphResolutionConfigurator::getUpscalerSteps(uint32_t outputWidth, uint32_t outputHeight, uint32_t& stepW, uint32_t& stepH)
+{
+    for (auto& steps : _upscalerSteps)
+    {
+        if (steps.width == outputWidth && steps.height == outputHeight)
+        {
+            stepW = steps.stepW;
+            stepH = steps.stepH;
+            return;
+        }
+    }
+
+    stepW = 1;
+    for (stepH = 1; stepH < outputHeight / 2; stepH++)
+    {
+        double horStep = static_cast<double>(stepH) * outputWidth / 2 / outputHeight;
+        if (floor((horStep)) == horStep)
+        {
+            stepW = static_cast<uint32_t>(horStep) * 2;
+            break;
+        }
+    }
+
+    _upscalerSteps.push_back({ outputWidth, outputHeight, stepW, stepH });
+}
+
 StaticGraphStatus GraphResolutionConfigurator::updateRunKernelPassThrough(StaticGraphRunKernel* runKernel, uint32_t width, uint32_t height)
 {
     runKernel->resolution_info->input_width = width;
@@ -823,17 +821,25 @@ StaticGraphStatus GraphResolutionConfigurator::updateCroppingScaler(StaticGraphR
      return StaticGraphStatus::SG_OK;
  }
 
-StaticGraphStatus GraphResolutionConfigurator::updateRunKernelResolutionHistory(StaticGraphRunKernel* runKernel, StaticGraphRunKernel* prevRunKernel, bool updateResolution)
+StaticGraphKernelResCrop GraphResolutionConfigurator::getResolutionHistoryCrop(StaticGraphRunKernel* prevRunKernel)
 {
-    runKernel->resolution_history->input_crop.left = prevRunKernel->resolution_history->input_crop.left +
+    StaticGraphKernelResCrop crop;
+    crop.left = prevRunKernel->resolution_history->input_crop.left +
         static_cast<uint32_t>(prevRunKernel->resolution_info->input_crop.left / _sensorHorizontalScaling);
-    runKernel->resolution_history->input_crop.right = prevRunKernel->resolution_history->input_crop.right +
+    crop.right = prevRunKernel->resolution_history->input_crop.right +
         static_cast<uint32_t>(prevRunKernel->resolution_info->input_crop.right / _sensorHorizontalScaling);
-    runKernel->resolution_history->input_crop.top = prevRunKernel->resolution_history->input_crop.top +
+    crop.top = prevRunKernel->resolution_history->input_crop.top +
         static_cast<uint32_t>(prevRunKernel->resolution_info->input_crop.top / _sensorVerticalScaling);
-    runKernel->resolution_history->input_crop.bottom = prevRunKernel->resolution_history->input_crop.bottom +
+    crop.bottom = prevRunKernel->resolution_history->input_crop.bottom +
         static_cast<uint32_t>(prevRunKernel->resolution_info->input_crop.bottom / _sensorVerticalScaling);
 
+    return crop;
+}
+
+StaticGraphStatus GraphResolutionConfigurator::updateRunKernelResolutionHistory(StaticGraphRunKernel* runKernel, StaticGraphRunKernel* prevRunKernel, bool updateResolution)
+{
+    runKernel->resolution_history->input_crop = getResolutionHistoryCrop(prevRunKernel);
+
     if (updateResolution == true)
     {
         runKernel->resolution_history->output_width = runKernel->resolution_info->input_width;
@@ -843,6 +849,28 @@ StaticGraphStatus GraphResolutionConfigurator::updateRunKernelResolutionHistory(
     return StaticGraphStatus::SG_OK;
 }
 
+// Same as updateRunKernelResolutionHistory(kernel, cropperRunKernel, false) for each kernel for update.
+// We update all histories according to upscaler... ignoring any cropping from now on, even if we configured ESPA cropper.
+// They all get the same crop, so it is calculated once instead of per kernel.
+StaticGraphStatus GraphResolutionConfigurator::updateResolutionHistoryOfKernelsForUpdate(StaticGraphRunKernel* cropperRunKernel)
+{
+    StaticGraphKernelResCrop cropHistory = getResolutionHistoryCrop(cropperRunKernel);
+
+    for (auto& runKernelForUpdate : _kernelsForUpdate)
+    {
+        StaticGraphRunKernel* runKernelPtr = getRunKernel(runKernelForUpdate);
+        runKernelPtr->resolution_history->input_crop = cropHistory;
+
+        if (runKernelPtr->resolution_history == cropperRunKernel->resolution_history)
+        {
+            // Kernel shares the history of the cropper, the next kernels get the updated crop
+            cropHistory = getResolutionHistoryCrop(cropperRunKernel);
+        }
+    }
+
+    return StaticGraphStatus::SG_OK;
+}
+
 StaticGraphRunKernel* GraphResolutionConfigurator::getRunKernel(RunKernelCoords& coord)
 {
     GraphTopology* graphTopology = nullptr;
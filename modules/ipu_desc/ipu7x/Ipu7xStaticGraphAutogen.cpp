@@ -8703,7 +8703,7 @@ StaticGraphStatus StaticGraph100000::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100000::~StaticGraph100000()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100000::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -9097,7 +9097,7 @@ StaticGraphStatus StaticGraph100001::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100001::~StaticGraph100001()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100001::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -9453,7 +9453,7 @@ StaticGraphStatus StaticGraph100002::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100002::~StaticGraph100002()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100002::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -9839,7 +9839,7 @@ StaticGraphStatus StaticGraph100003::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100003::~StaticGraph100003()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100003::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -10233,7 +10233,7 @@ StaticGraphStatus StaticGraph100004::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100004::~StaticGraph100004()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100004::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -10622,7 +10622,7 @@ StaticGraphStatus StaticGraph100005::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100005::~StaticGraph100005()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100005::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -11228,7 +11228,7 @@ StaticGraphStatus StaticGraph100006::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100006::~StaticGraph100006()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100006::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -11667,7 +11667,7 @@ StaticGraphStatus StaticGraph100007::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100007::~StaticGraph100007()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100007::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -12111,7 +12111,7 @@ StaticGraphStatus StaticGraph100008::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100008::~StaticGraph100008()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100008::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -12562,7 +12562,7 @@ StaticGraphStatus StaticGraph100015::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100015::~StaticGraph100015()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100015::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -12732,7 +12732,7 @@ StaticGraphStatus StaticGraph100016::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100016::~StaticGraph100016()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100016::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -12959,7 +12959,7 @@ StaticGraphStatus StaticGraph100024::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100024::~StaticGraph100024()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100024::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -13223,7 +13223,7 @@ StaticGraphStatus StaticGraph100025::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100025::~StaticGraph100025()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100025::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -13394,7 +13394,7 @@ StaticGraphStatus StaticGraph100026::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100026::~StaticGraph100026()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100027
@@ -13598,7 +13598,7 @@ StaticGraphStatus StaticGraph100027::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100027::~StaticGraph100027()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100027::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -13872,7 +13872,7 @@ StaticGraphStatus StaticGraph100028::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100028::~StaticGraph100028()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100028::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -14210,7 +14210,7 @@ StaticGraphStatus StaticGraph100029::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100029::~StaticGraph100029()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100029::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -14540,7 +14540,7 @@ StaticGraphStatus StaticGraph100030::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100030::~StaticGraph100030()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100030::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -14959,7 +14959,7 @@ StaticGraphStatus StaticGraph100031::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100031::~StaticGraph100031()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100031::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -15425,7 +15425,7 @@ StaticGraphStatus StaticGraph100032::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100032::~StaticGraph100032()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100032::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -15626,7 +15626,7 @@ StaticGraphStatus StaticGraph100035::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100035::~StaticGraph100035()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100036
@@ -15726,7 +15726,7 @@ StaticGraphStatus StaticGraph100036::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100036::~StaticGraph100036()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100037
@@ -16040,7 +16040,7 @@ StaticGraphStatus StaticGraph100037::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100037::~StaticGraph100037()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100037::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -16441,7 +16441,7 @@ StaticGraphStatus StaticGraph100038::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100038::~StaticGraph100038()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100038::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -17131,7 +17131,7 @@ StaticGraphStatus StaticGraph100039::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100039::~StaticGraph100039()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100039::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -17771,7 +17771,7 @@ StaticGraphStatus StaticGraph100040::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100040::~StaticGraph100040()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100040::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -18140,7 +18140,7 @@ StaticGraphStatus StaticGraph100041::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100041::~StaticGraph100041()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100041::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -18527,7 +18527,7 @@ StaticGraphStatus StaticGraph100042::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100042::~StaticGraph100042()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100042::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -5027,7 +5027,7 @@ StaticGraphStatus StaticGraph100000::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100000::~StaticGraph100000()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100000::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -5341,7 +5341,7 @@ StaticGraphStatus StaticGraph100002::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100002::~StaticGraph100002()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100002::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -5706,7 +5706,7 @@ StaticGraphStatus StaticGraph100003::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100003::~StaticGraph100003()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100003::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -6304,7 +6304,7 @@ StaticGraphStatus StaticGraph100006::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100006::~StaticGraph100006()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100006::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -6707,7 +6707,7 @@ StaticGraphStatus StaticGraph100007::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100007::~StaticGraph100007()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100007::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -7153,7 +7153,7 @@ StaticGraphStatus StaticGraph100008::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100008::~StaticGraph100008()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100008::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -7596,7 +7596,7 @@ StaticGraphStatus StaticGraph100015::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100015::~StaticGraph100015()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100015::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -7764,7 +7764,7 @@ StaticGraphStatus StaticGraph100016::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100016::~StaticGraph100016()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100016::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -8006,7 +8006,7 @@ StaticGraphStatus StaticGraph100025::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100025::~StaticGraph100025()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100025::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -8175,7 +8175,7 @@ StaticGraphStatus StaticGraph100026::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100026::~StaticGraph100026()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100027
@@ -8380,7 +8380,7 @@ StaticGraphStatus StaticGraph100027::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100027::~StaticGraph100027()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100027::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -8653,7 +8653,7 @@ StaticGraphStatus StaticGraph100028::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100028::~StaticGraph100028()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100028::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -8991,7 +8991,7 @@ StaticGraphStatus StaticGraph100029::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100029::~StaticGraph100029()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100029::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -9313,7 +9313,7 @@ StaticGraphStatus StaticGraph100030::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100030::~StaticGraph100030()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100030::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -9649,7 +9649,7 @@ StaticGraphStatus StaticGraph100031::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100031::~StaticGraph100031()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100031::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -10033,7 +10033,7 @@ StaticGraphStatus StaticGraph100032::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100032::~StaticGraph100032()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 
 StaticGraphStatus imageSubGraphTopology100032::configInnerNodes(SubGraphInnerNodeConfiguration& subGraphInnerNodeConfiguration)
@@ -10216,7 +10216,7 @@ StaticGraphStatus StaticGraph100035::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100035::~StaticGraph100035()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
 /*
  * Graph 100036
@@ -10316,5 +10316,5 @@ StaticGraphStatus StaticGraph100036::updateConfiguration(uint32_t selectedIndex)
 StaticGraph100036::~StaticGraph100036()
 {
     delete[] _graphConfigurations;
-    delete _zoomKeyResolutions.zoomKeyResolutionOptions;
+    delete[] _zoomKeyResolutions.zoomKeyResolutionOptions;
 }
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "StaticGraphBinaryAutogen.h"
 #include "StaticGraphAutogen.h"
 
@@ -70,6 +72,16 @@ public:
     StaticGraphStatus GetStaticGraphConfig(GraphConfigurationKey& settingsKey, IStaticGraphConfig** graph);
     static const uint32_t staticGraphCommonHashCode = 2833911390; // autogenerated
 private:
+    // Header indices of the same settings key or configuration data, in the binary order
+    struct HeaderIndexRange {
+        std::vector<uint32_t>::const_iterator first;
+        std::vector<uint32_t>::const_iterator last;
+        std::vector<uint32_t>::const_iterator begin() const { return first; }
+        std::vector<uint32_t>::const_iterator end() const { return last; }
+    };
+    void BuildHeaderIndex();
+    HeaderIndexRange GetHeadersBySettingsKey(const GraphConfigurationKey& settingsKey) const;
+    HeaderIndexRange GetHeadersByDataOffset(int32_t resConfigDataOffset) const;
     void GetSinkMappingConfiguration(GraphConfigurationHeader* baseGraphConfigurationHeader, VirtualSinkMapping* baseSinkMappingConfiguration,
                                      GraphConfigurationHeader* selectedGraphConfigurationHeader, VirtualSinkMapping* selectedSinkMappingConfiguration);
     BinaryHeader _binaryHeader;
@@ -77,5 +89,8 @@ private:
     SensorMode* _sensorModes = nullptr;
     int8_t* _configurationData = nullptr;
     ZoomKeyResolutions _zoomKeyResolutions;
+    // Sorted once in Init() so that the lookups don't scan all the headers
+    std::vector<uint32_t> _settingsKeyIndex;
+    std::vector<uint32_t> _dataOffsetIndex;
 };
 
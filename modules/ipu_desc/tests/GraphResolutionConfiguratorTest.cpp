@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+// Golden test of the GraphResolutionConfigurator updates. For every graph of
+// the binaries of a gcss directory, one configurator is updated along a sweep
+// of ROIs: centered zoom in and out, then pan and tilt at a few zoom levels.
+// After each update, its graph must be bit-identical to a fresh graph whose
+// new configurator had only this update, so nothing the configurator keeps
+// from one update to the next changes the result. The deepest zooms fail on
+// some graphs, both configurators must fail there and recover after.
+//
+// Usage: GraphResolutionConfiguratorTest [gcss directory]
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "StaticGraphTestUtils.h"
+#include "GraphResolutionConfiguratorInclude.h"
+#include "GraphResolutionConfigurator.h"
+
+using StaticGraphTestUtils::baseName;
+using StaticGraphTestUtils::getSettingsKeys;
+using StaticGraphTestUtils::listBinaries;
+using StaticGraphTestUtils::readFile;
+
+namespace {
+
+struct Update {
+    RegionOfInterest roi;
+    bool centered;
+};
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what, const std::string& graph, size_t step) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s, %s, update %zu\n", what, graph.c_str(), step);
+        gFailures++;
+    }
+}
+
+std::vector<Update> getSweep() {
+    std::vector<Update> sweep;
+    for (int i = 0; i <= 18; i++) {
+        sweep.push_back({{1.0 - i * 0.05, 0, 0, false}, true});
+    }
+    for (int i = 17; i >= 0; i--) {
+        sweep.push_back({{1.0 - i * 0.05, 0, 0, false}, true});
+    }
+    const double zooms[] = {0.8, 0.5, 0.3, 0.15};
+    for (double zoom : zooms) {
+        for (int i = 0; i <= 4; i++) {
+            const double pan = (1.0 - zoom) * i / 4;
+            sweep.push_back({{zoom, pan, (1.0 - zoom) - pan, false}, false});
+        }
+    }
+    sweep.push_back({{1.0, 0, 0, false}, true});
+    return sweep;
+}
+
+// The nodes of the graph in the order of its links
+std::vector<OuterNode*> getNodes(IStaticGraphConfig* graph) {
+    std::vector<OuterNode*> nodes;
+    GraphTopology* topology = nullptr;
+    if (graph->getGraphTopology(&topology) != StaticGraphStatus::SG_OK) return nodes;
+    for (int32_t i = 0; i < topology->numOfLinks; i++) {
+        OuterNode* linkNodes[] = {topology->links[i]->srcNode, topology->links[i]->destNode};
+        for (OuterNode* node : linkNodes) {
+            bool known = (node == nullptr);
+            for (OuterNode* n : nodes) known = known || (n == node);
+            if (!known) nodes.push_back(node);
+        }
+    }
+    return nodes;
+}
+
+bool sameRes(const StaticGraphKernelRes* a, const StaticGraphKernelRes* b) {
+    if (a == nullptr || b == nullptr) return a == b;
+    return memcmp(a, b, sizeof(StaticGraphKernelRes)) == 0;
+}
+
+bool sameKernels(IStaticGraphConfig* a, IStaticGraphConfig* b) {
+    const std::vector<OuterNode*> nodesA = getNodes(a);
+    const std::vector<OuterNode*> nodesB = getNodes(b);
+    if (nodesA.size() != nodesB.size()) return false;
+    for (size_t i = 0; i < nodesA.size(); i++) {
+        const StaticGraphNodeKernels& kernelsA = nodesA[i]->nodeKernels;
+        const StaticGraphNodeKernels& kernelsB = nodesB[i]->nodeKernels;
+        if (kernelsA.kernelCount != kernelsB.kernelCount) return false;
+        for (uint32_t k = 0; k < kernelsA.kernelCount; k++) {
+            const StaticGraphRunKernel& runA = kernelsA.kernelList[k].run_kernel;
+            const StaticGraphRunKernel& runB = kernelsB.kernelList[k].run_kernel;
+            if (runA.kernel_uuid != runB.kernel_uuid || runA.enable != runB.enable ||
+                !sameRes(runA.resolution_info, runB.resolution_info) ||
+                !sameRes(runA.resolution_history, runB.resolution_history)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Returns the number of graphs checked
+int checkGraph(StaticGraphReader& reader, GraphConfigurationKey& key,
+               const std::vector<Update>& sweep, const std::string& name) {
+    IStaticGraphConfig* graph = nullptr;
+    if (reader.GetStaticGraphConfig(key, &graph) != StaticGraphStatus::SG_OK) {
+        expect(false, "the settings key is found", name, 0);
+        return 0;
+    }
+    GraphResolutionConfigurator configurator(graph);
+
+    for (size_t step = 0; step < sweep.size(); step++) {
+        const Update& prev = sweep[(step > 0) ? step - 1 : 0];
+        const Update& cur = sweep[step];
+        bool changed = false;
+        const StaticGraphStatus ret = configurator.updateStaticGraphConfig(
+            cur.roi, prev.roi, cur.centered, prev.centered, changed);
+
+        IStaticGraphConfig* fresh = nullptr;
+        reader.GetStaticGraphConfig(key, &fresh);
+        GraphResolutionConfigurator freshConfigurator(fresh);
+        bool freshChanged = false;
+        const StaticGraphStatus freshRet = freshConfigurator.updateStaticGraphConfig(
+            cur.roi, prev.roi, cur.centered, prev.centered, freshChanged);
+
+        expect(ret == freshRet, "same status", name, step);
+        expect(changed == freshChanged, "same key resolution change", name, step);
+        // A failed update leaves the graph as it was when the update stopped
+        expect(ret != StaticGraphStatus::SG_OK || sameKernels(graph, fresh), "same run kernels",
+               name, step);
+        delete fresh;
+    }
+    delete graph;
+    return 1;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const std::string dir = (argc > 1) ? argv[1] : GCSS_DIR;
+    const std::vector<std::string> files = listBinaries(dir);
+    const std::vector<Update> sweep = getSweep();
+    int graphs = 0;
+
+    for (const std::string& file : files) {
+        std::vector<int8_t> data;
+        StaticReaderBinaryData binary;
+        StaticGraphReader reader;
+        if (!readFile(file, &data)) continue;
+        binary.data = data.data();
+        binary.size = static_cast<uint32_t>(data.size());
+        if (reader.Init(binary) != StaticGraphStatus::SG_OK) continue;
+
+        std::vector<GraphConfigurationKey> keys = getSettingsKeys(data);
+        for (size_t i = 0; i < keys.size(); i++) {
+            const std::string name = baseName(file) + " key " + std::to_string(i);
+            graphs += checkGraph(reader, keys[i], sweep, name);
+        }
+    }
+    if (graphs == 0) {
+        fprintf(stderr, "FAIL: no graph of this IPU version in %s\n", dir.c_str());
+        return 1;
+    }
+
+    if (gFailures == 0) {
+        printf("GraphResolutionConfiguratorTest passed, %d graphs, %zu updates each\n", graphs,
+               sweep.size());
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times the static graph part of a stream configuration on every graph
+// binary of a gcss directory: StaticGraphReader::Init(), done once per camera,
+// and GetStaticGraphConfig() for each settings key of the binary, which looks
+// the key up and constructs the graph. Binaries of another IPU version don't
+// match the reader and are skipped.
+//
+// Usage: StaticGraphReaderBenchmark [rounds] [gcss directory]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "StaticGraphTestUtils.h"
+
+using StaticGraphTestUtils::baseName;
+using StaticGraphTestUtils::getSettingsKeys;
+using StaticGraphTestUtils::listBinaries;
+using StaticGraphTestUtils::readFile;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double elapsedUs(const Clock::time_point& start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+void run(const std::string& path, int rounds) {
+    const std::string name = baseName(path);
+    std::vector<int8_t> data;
+    if (!readFile(path, &data)) {
+        printf("%s: can't be read\n", name.c_str());
+        return;
+    }
+    StaticReaderBinaryData binary;
+    binary.data = data.data();
+    binary.size = static_cast<uint32_t>(data.size());
+
+    // Init() builds the header index, time a fresh reader each round
+    double initUs = 0;
+    StaticGraphReader reader;
+    for (int i = 0; i < rounds; i++) {
+        StaticGraphReader fresh;
+        Clock::time_point start = Clock::now();
+        const StaticGraphStatus ret = fresh.Init(binary);
+        initUs += elapsedUs(start);
+        if (ret != StaticGraphStatus::SG_OK) {
+            printf("%s: not a graph binary of this IPU version, skipped\n", name.c_str());
+            return;
+        }
+        if (i == 0) reader = fresh;
+    }
+    initUs /= rounds;
+
+    std::vector<GraphConfigurationKey> keys = getSettingsKeys(data);
+    int failures = 0;
+    std::vector<double> configureUs;
+    for (GraphConfigurationKey& key : keys) {
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < rounds; i++) {
+            IStaticGraphConfig* graph = nullptr;
+            if (reader.GetStaticGraphConfig(key, &graph) != StaticGraphStatus::SG_OK) {
+                failures++;
+            }
+            delete graph;
+        }
+        configureUs.push_back(elapsedUs(start) / rounds);
+    }
+    if (configureUs.empty()) {
+        printf("%s: no settings\n", name.c_str());
+        return;
+    }
+
+    std::sort(configureUs.begin(), configureUs.end());
+    double sum = 0;
+    for (double us : configureUs) sum += us;
+    printf("%-40s %4zu keys, init %7.1f us, configure avg %6.2f us, p50 %6.2f us, max %6.2f us%s\n",
+           name.c_str(), keys.size(), initUs, sum / configureUs.size(),
+           configureUs[configureUs.size() / 2], configureUs.back(),
+           (failures > 0) ? ", some keys failed" : "");
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int rounds = (argc > 1) ? atoi(argv[1]) : 20;
+    const std::string dir = (argc > 2) ? argv[2] : GCSS_DIR;
+    if (rounds <= 0) {
+        fprintf(stderr, "Usage: %s [rounds] [gcss directory]\n", argv[0]);
+        return 1;
+    }
+
+    const std::vector<std::string> files = listBinaries(dir);
+    if (files.empty()) {
+        fprintf(stderr, "No graph binary in %s\n", dir.c_str());
+        return 1;
+    }
+    for (const std::string& file : files) {
+        run(file, rounds);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+
+// Helpers of the static graph tests and benchmarks to load the graph binaries
+// of a gcss directory, and the settings keys they have.
+
+#include <dirent.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#if defined(GRC_IPU7X)
+#include "Ipu7xStaticGraphAutogen.h"
+#include "Ipu7xStaticGraphReaderAutogen.h"
+#elif defined(GRC_IPU75XA)
+#include "Ipu75xaStaticGraphAutogen.h"
+#include "Ipu75xaStaticGraphReaderAutogen.h"
+#else
+#include "StaticGraphAutogen.h"
+#include "StaticGraphReaderAutogen.h"
+#endif
+
+namespace StaticGraphTestUtils {
+
+// The .bin files of the directory, sorted by name
+inline std::vector<std::string> listBinaries(const std::string& dir) {
+    std::vector<std::string> files;
+    DIR* dp = opendir(dir.c_str());
+    if (dp == nullptr) return files;
+    for (dirent* entry = readdir(dp); entry != nullptr; entry = readdir(dp)) {
+        const std::string name = entry->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".bin") == 0) {
+            files.push_back(dir + "/" + name);
+        }
+    }
+    closedir(dp);
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+inline std::string baseName(const std::string& path) {
+    const size_t slash = path.rfind('/');
+    return path.substr((slash == std::string::npos) ? 0 : slash + 1);
+}
+
+inline bool readFile(const std::string& path, std::vector<int8_t>* data) {
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) return false;
+    fseek(file, 0, SEEK_END);
+    const long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data->resize((size > 0) ? size : 0);
+    const size_t len = fread(data->data(), 1, data->size(), file);
+    fclose(file);
+    return size > 0 && len == data->size();
+}
+
+// Walks the binary the way StaticGraphReader::Init() does, up to the headers
+inline std::vector<GraphConfigurationKey> getSettingsKeys(const std::vector<int8_t>& data) {
+    std::vector<GraphConfigurationKey> keys;
+    const int8_t* offset = data.data();
+    const int8_t* end = data.data() + data.size();
+    const BinaryHeader* binaryHeader = reinterpret_cast<const BinaryHeader*>(offset);
+    offset += sizeof(BinaryHeader);
+
+    const DataRangeHeader* dataRangeHeader = reinterpret_cast<const DataRangeHeader*>(offset);
+    uint32_t pins = 0;
+    for (int i = 0; i < enNumOfOutPins; i++) pins += dataRangeHeader->NumberOfPinResolutions[i];
+    offset += sizeof(DataRangeHeader) + sizeof(DriverDesc) * pins;
+
+    const uint32_t graphs = *reinterpret_cast<const uint32_t*>(offset);
+    offset += sizeof(graphs) + graphs * sizeof(GraphHashCode);
+
+    const uint32_t zoomKeys = *reinterpret_cast<const uint32_t*>(offset);
+    offset += sizeof(zoomKeys) + zoomKeys * sizeof(ZoomKeyResolution);
+
+    const GraphConfigurationHeader* headers =
+        reinterpret_cast<const GraphConfigurationHeader*>(offset);
+    if (offset + sizeof(GraphConfigurationHeader) * binaryHeader->numberOfResolutions > end) {
+        return keys;
+    }
+    for (uint32_t i = 0; i < binaryHeader->numberOfResolutions; i++) {
+        keys.push_back(headers[i].settingsKey);
+    }
+    return keys;
+}
+
+}  // namespace StaticGraphTestUtils
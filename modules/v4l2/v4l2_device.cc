@@ -27,6 +27,7 @@
 #include <unistd.h>
 
 #include <v4l2_device.h>
+#include "SysCall.h"
 #include "iutils/CameraDump.h"
 #include "iutils/CameraLog.h"
 #include "iutils/Errors.h"
@@ -227,6 +228,54 @@ int V4L2Device::SetControl(struct v4l2_ext_control* ext_control) {
     return ::ioctl(fd_, VIDIOC_S_EXT_CTRLS, &controls);
 }
 
+int V4L2Device::SetControls(struct v4l2_ext_control* ext_controls, uint32_t count,
+                            uint32_t* error_idx) {
+    LOG1("@%s, count %u", __func__, count);
+
+    if (!IsOpened()) {
+        LOGE("%s: Device node %s is not opened! %s", __func__, name_.c_str(), strerror(errno));
+        return -EINVAL;
+    }
+    if (!ext_controls || count == 0) {
+        LOGE("%s: Device node %s ext_controls is empty", __func__, name_.c_str());
+        return -EINVAL;
+    }
+    struct v4l2_ext_controls controls = {};
+    controls.which = V4L2_CTRL_WHICH_CUR_VAL;
+    controls.count = count;
+    controls.controls = ext_controls;
+    int ret = SysCall::getInstance()->ioctl(fd_, VIDIOC_S_EXT_CTRLS, &controls);
+    if (ret != 0) {
+        ret = -errno;
+        LOGW("%s: Device node %s IOCTL VIDIOC_S_EXT_CTRLS error at %u: %s", __func__,
+             name_.c_str(), controls.error_idx, strerror(-ret));
+    }
+    if (error_idx) {
+        *error_idx = controls.error_idx;
+    }
+    return ret;
+}
+
+int V4L2Device::ProbeExtControls() {
+    LOG1("@%s", __func__);
+
+    if (!IsOpened()) {
+        LOGE("%s: Device node %s is not opened! %s", __func__, name_.c_str(), strerror(errno));
+        return -EINVAL;
+    }
+    // No control is changed with count 0, the driver only checks the request
+    struct v4l2_ext_controls controls = {};
+    controls.which = V4L2_CTRL_WHICH_CUR_VAL;
+    controls.count = 0;
+    int ret = SysCall::getInstance()->ioctl(fd_, VIDIOC_TRY_EXT_CTRLS, &controls);
+    if (ret != 0) {
+        ret = -errno;
+        LOGW("%s: Device node %s IOCTL VIDIOC_TRY_EXT_CTRLS error: %s", __func__, name_.c_str(),
+             strerror(-ret));
+    }
+    return ret;
+}
+
 int V4L2Device::SetControl(int id, int32_t value) {
     LOG1("@%s", __func__);
 
@@ -169,6 +169,29 @@ class V4L2Device {
     int SetControl(int id, const std::string& value);
     int SetControl(struct v4l2_control* control);
 
+    // This method sets a group of controls of V4L2 device with a single
+    // VIDIOC_S_EXT_CTRLS call. The controls may belong to different control
+    // classes.
+    //
+    // Args:
+    //    |ext_controls|: controls with new values.
+    //    |count|: number of controls.
+    //    |error_idx|: optional, index of the failed control reported by driver.
+    //
+    // Returns:
+    //    0 on success; negative errno on failure.
+    int SetControls(struct v4l2_ext_control* ext_controls, uint32_t count,
+                    uint32_t* error_idx = nullptr);
+
+    // This method checks whether the V4L2 device accepts VIDIOC_S_EXT_CTRLS
+    // for SetControls(). It sends an empty VIDIOC_TRY_EXT_CTRLS, so no control
+    // is changed.
+    //
+    // Returns:
+    //    0 if supported; negative errno otherwise, -ENOTTY if the device has
+    //    no extended controls.
+    int ProbeExtControls();
+
     // These methods gets the control of V4L2 device.
     //
     // Args:
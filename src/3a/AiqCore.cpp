@@ -21,6 +21,7 @@
 #include <math.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <string>
@@ -76,9 +77,19 @@ AiqCore::AiqCore(int cameraId)
     // init LscOffGrid to 1.0f
     std::fill(std::begin(mLscOffGrid), std::end(mLscOffGrid), 1.0F);
 
+#ifdef IPA_SANDBOXING
+    const std::string number =
+        std::to_string(cameraId) + std::to_string(reinterpret_cast<uintptr_t>(this));
+    mStatsParams.allocate("/aiqCoreStats" + number + "shm");
+    mAiqParams.allocate("/aiqCoreParams" + number + "shm");
+    mAiqResults.allocate("/aiqCoreResults" + number + "shm");
+#else
+    mStatsParams = std::unique_ptr<cca::cca_stats_params>(new cca::cca_stats_params);
     mAiqParams = std::unique_ptr<cca::cca_aiq_params>(new cca::cca_aiq_params);
     mAiqResults = std::unique_ptr<cca::cca_aiq_results>(new cca::cca_aiq_results);
+#endif
 
+    memset(mStatsParams.get(), 0, sizeof(cca::cca_stats_params));
     memset(mAiqParams.get(), 0, sizeof(cca::cca_aiq_params));
     memset(mAiqResults.get(), 0, sizeof(cca::cca_aiq_results));
 }
@@ -369,8 +380,8 @@ int AiqCore::runAiq(int64_t ccaId, AiqResult* aiqResult) {
 
     // handle gbce result
     if ((aaaRunType & static_cast<uint32_t>(IMAGING_ALGO_GBCE)) != 0U) {
-        aiqResult->mGbceResults = mAiqResults->gbce_output;
-        AiqUtils::dumpGbceResults(aiqResult->mGbceResults);
+        aiqResult->mGbceResults.set(mAiqResults->gbce_output);
+        AiqUtils::dumpGbceResults(*aiqResult->mGbceResults);
     }
 
     // handle pa result
@@ -383,7 +394,7 @@ int AiqCore::runAiq(int64_t ccaId, AiqResult* aiqResult) {
     // handle sa result
     if ((aaaRunType & static_cast<uint32_t>(IMAGING_ALGO_SA)) != 0U) {
         AiqUtils::dumpSaResults(mAiqResults->sa_output);
-        ret = processSAResults(&mAiqResults->sa_output, aiqResult->mLensShadingMap);
+        ret = processSAResults(&mAiqResults->sa_output, &aiqResult->mLensShadingMap);
     }
     CheckAndLogError(ret != OK, ret, "run3A failed, ret: %d", ret);
 
@@ -604,7 +615,8 @@ int AiqCore::storeLensShadingMap(const LSCGrid& inputLscGrid, const LSCGrid& res
     return reFormatLensShadingMap(resizeLscGrid, dstLscGridRGGB);
 }
 
-int AiqCore::processSAResults(cca::cca_sa_results* saResults, float* lensShadingMap) {
+int AiqCore::processSAResults(cca::cca_sa_results* saResults,
+                              CowResult<LensShadingMap>* lensShadingMap) {
     CheckAndLogError((saResults == nullptr) || (lensShadingMap == nullptr), BAD_VALUE,
                      "@%s, Bad input values, saResults %p, lensShadingMap %p",
                      __func__, saResults, lensShadingMap);
@@ -653,8 +665,9 @@ int AiqCore::processSAResults(cca::cca_sa_results* saResults, float* lensShading
     }
 
     float* lsm = (mShadingMode != SHADING_MODE_OFF) ? mLscGridRGGB : mLscOffGrid;
+    float* dstLsm = lensShadingMap->getWritable()->data();
     for (size_t i = 0U; i < mLscGridRGGBLen; i++) {
-        lensShadingMap[i] = lsm[i];
+        dstLsm[i] = lsm[i];
     }
 
     return OK;
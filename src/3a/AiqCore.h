@@ -68,6 +68,11 @@ class AiqCore {
      */
     int updateParameter(const aiq_parameter_t& param);
 
+    /**
+     * \brief Get the stats params to be filled and set by setStatsParams()
+     */
+    cca::cca_stats_params* getStatsParams() { return mStatsParams.get(); }
+
     /**
      * \brief Set ispStatistics to AiqCore
      */
@@ -114,7 +119,8 @@ class AiqCore {
     int runAEC(int64_t ccaId, cca::cca_ae_results* aeResults);
     void focusDistanceResult(const cca::cca_af_results* afResults, float* afDistanceDiopters,
                              camera_range_t* focusRange);
-    int processSAResults(cca::cca_sa_results* saResults, float* lensShadingMap);
+    int processSAResults(cca::cca_sa_results* saResults,
+                         CowResult<LensShadingMap>* lensShadingMap);
     int checkColorOrder(cmc_bayer_order bayerOrder, ColorOrder* colorOrder);
     int storeLensShadingMap(const LSCGrid& inputLscGrid, const LSCGrid& resizeLscGrid,
                             float* dstLscGridRGGB);
@@ -183,8 +189,16 @@ class AiqCore {
 
     cca::cca_ae_results mLastAeResult;
 
+#ifdef IPA_SANDBOXING
+    // In the shared memory so that they are passed to the IPA server by handles
+    CcaShmStruct<cca::cca_stats_params> mStatsParams;
+    CcaShmStruct<cca::cca_aiq_params> mAiqParams;
+    CcaShmStruct<cca::cca_aiq_results> mAiqResults;
+#else
+    std::unique_ptr<cca::cca_stats_params> mStatsParams;
     std::unique_ptr<cca::cca_aiq_params> mAiqParams;
     std::unique_ptr<cca::cca_aiq_results> mAiqResults;
+#endif
 
     bool mAeAndAwbConverged;
 
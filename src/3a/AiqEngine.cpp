@@ -144,7 +144,7 @@ EventListener* AiqEngine::getSofEventListener() {
     return this;
 }
 
-void AiqEngine::handleEvent(EventData eventData) {
+void AiqEngine::handleEvent(const EventData& eventData) {
     AutoMutex l(mEngineLock);
     mSensorManager->handleSofEvent(eventData);
     mLensManager->handleSofEvent(eventData);
@@ -317,8 +317,9 @@ AiqEngine::AiqState AiqEngine::prepareInputParam(AiqStatistics* aiqStats, AiqRes
     }
 
     // set Stats
-    cca::cca_stats_params statsParams = {};
-    ret = prepareStatsParams(aiqParams, &statsParams, aiqStats, aiqResult);
+    cca::cca_stats_params* statsParams = mAiqCore->getStatsParams();
+    memset(statsParams, 0, sizeof(cca::cca_stats_params));
+    ret = prepareStatsParams(aiqParams, statsParams, aiqStats, aiqResult);
     if (ret != OK) {
         LOG2("%s: no useful stats", __func__);
         return AIQ_STATE_RUN;
@@ -326,10 +327,10 @@ AiqEngine::AiqState AiqEngine::prepareInputParam(AiqStatistics* aiqStats, AiqRes
 
     if (PlatformData::getSensorAeEnable(mCameraId)) {
         LOG2("@%s, sensor ae is enabled", __func__);
-        statsParams.using_rgbs_for_aec = true;
+        statsParams->using_rgbs_for_aec = true;
     }
 
-    mAiqCore->setStatsParams(statsParams, aiqStats);
+    mAiqCore->setStatsParams(*statsParams, aiqStats);
 
     return AIQ_STATE_RUN;
 }
@@ -393,46 +394,52 @@ AiqEngine::AiqState AiqEngine::handleAiqResult(const aiq_parameter_t& aiqParams,
 }
 
 int AiqEngine::applyManualTonemaps(const aiq_parameter_t& aiqParams, AiqResult* aiqResult) {
-    aiqResult->mGbceResults.have_manual_settings = true;
+    bool haveManualSettings = true;
 
     // Due to the tone map curve effect on image IQ, so need to apply
     // manual/fixed tone map table in manual tonemap or manual ISO/ET mode
     if ((aiqParams.tonemapMode == TONEMAP_MODE_FAST) ||
         (aiqParams.tonemapMode == TONEMAP_MODE_HIGH_QUALITY)) {
-        aiqResult->mGbceResults.have_manual_settings = false;
+        haveManualSettings = false;
 
         if ((aiqParams.aeMode != AE_MODE_AUTO) && (aiqParams.manualIso != 0)
             && (aiqParams.manualExpTimeUs != 0)) {
-            aiqResult->mGbceResults.have_manual_settings = true;
+            haveManualSettings = true;
         }
     }
     LOG2("%s, has manual setting: %d, aeMode: %d, tonemapMode: %d", __func__,
-         aiqResult->mGbceResults.have_manual_settings, aiqParams.aeMode,
-         aiqParams.tonemapMode);
+         haveManualSettings, aiqParams.aeMode, aiqParams.tonemapMode);
 
-    if (!aiqResult->mGbceResults.have_manual_settings) {
+    // The gbce results may be shared with the previous results, only copy them when changed
+    if (!haveManualSettings) {
+        if (aiqResult->mGbceResults->have_manual_settings) {
+            aiqResult->mGbceResults.getWritable()->have_manual_settings = false;
+        }
         return OK;
     }
 
+    cca::cca_gbce_params* gbceResults = aiqResult->mGbceResults.getWritable();
+    gbceResults->have_manual_settings = true;
+
     // Apply user value or gamma curve for gamma table
     if (aiqParams.tonemapMode == TONEMAP_MODE_GAMMA_VALUE) {
-        AiqUtils::applyTonemapGamma(aiqParams.tonemapGamma, &aiqResult->mGbceResults);
+        AiqUtils::applyTonemapGamma(aiqParams.tonemapGamma, gbceResults);
     } else if (aiqParams.tonemapMode == TONEMAP_MODE_PRESET_CURVE) {
         if (aiqParams.tonemapPresetCurve == TONEMAP_PRESET_CURVE_SRGB) {
-            AiqUtils::applyTonemapSRGB(&aiqResult->mGbceResults);
+            AiqUtils::applyTonemapSRGB(gbceResults);
         } else if (aiqParams.tonemapPresetCurve == TONEMAP_PRESET_CURVE_REC709) {
-            AiqUtils::applyTonemapREC709(&aiqResult->mGbceResults);
+            AiqUtils::applyTonemapREC709(gbceResults);
         }
     } else if (aiqParams.tonemapMode == TONEMAP_MODE_CONTRAST_CURVE) {
-        AiqUtils::applyTonemapCurve(aiqParams.tonemapCurves, &aiqResult->mGbceResults);
+        AiqUtils::applyTonemapCurve(aiqParams.tonemapCurves, gbceResults);
         AiqUtils::applyAwbGainForTonemapCurve(aiqParams.tonemapCurves,
                                               &aiqResult->mAwbResults);
     }
 
     // Apply the fixed unity value for tone map table
-    if (aiqResult->mGbceResults.tone_map_lut_size > 0U) {
-        for (unsigned int i = 0U; i < aiqResult->mGbceResults.tone_map_lut_size; i++) {
-            aiqResult->mGbceResults.tone_map_lut[i] = 1.0;
+    if (gbceResults->tone_map_lut_size > 0U) {
+        for (unsigned int i = 0U; i < gbceResults->tone_map_lut_size; i++) {
+            gbceResults->tone_map_lut[i] = 1.0;
         }
     }
 
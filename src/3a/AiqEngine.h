@@ -74,7 +74,7 @@ class AiqEngine : public EventListener {
     /**
      * \brief handle event
      */
-    virtual void handleEvent(EventData eventData);
+    virtual void handleEvent(const EventData& eventData);
 
     int prepareStatsParams(const aiq_parameter_t& aiqParams,
                            cca::cca_stats_params* statsParams, const AiqStatistics* aiqStatistics,
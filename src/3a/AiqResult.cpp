@@ -38,13 +38,11 @@ AiqResult::AiqResult(int cameraId) :
     CLEAR(mCustomControls);
     CLEAR(mCustomControlsParams);
     CLEAR(mAwbResults);
-    CLEAR(mGbceResults);
     CLEAR(mPaResults);
     CLEAR(mAeResults);
     CLEAR(mAfResults);
     CLEAR(mOutStats);
     CLEAR(mFocusRange);
-    CLEAR(mLensShadingMap);
 }
 
 AiqResult::~AiqResult() {
@@ -87,6 +85,7 @@ AiqResult &AiqResult::operator=(const AiqResult &other) {
     mAeResults = other.mAeResults;
     mAwbResults = other.mAwbResults;
     mAfResults = other.mAfResults;
+    // Shared until one of them is changed
     mGbceResults = other.mGbceResults;
     mPaResults = other.mPaResults;
     mOutStats = other.mOutStats;
@@ -96,8 +95,7 @@ AiqResult &AiqResult::operator=(const AiqResult &other) {
     for (int i = 0; i < mCustomControls.count; i++) {
         mCustomControlsParams[i] = other.mCustomControlsParams[i];
     }
-    MEMCPY_S(mLensShadingMap, sizeof(mLensShadingMap),
-             other.mLensShadingMap, sizeof(other.mLensShadingMap));
+    mLensShadingMap = other.mLensShadingMap;
 
     mFrameDuration = other.mFrameDuration;
     mRollingShutter = other.mRollingShutter;
@@ -16,12 +16,66 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+
 #include "AiqUtils.h"
 #include "AiqSetting.h"
 #include "iutils/Utils.h"
 
 namespace icamera {
 
+/**
+ * \class CowResult
+ * Copy-on-write storage of a large part of AiqResult.
+ *
+ * The copies of AiqResult share it, so the results reused by the skipped 3A runs don't
+ * copy it. The writer calls set() or getWritable(), which copies it only if it's shared.
+ * It's only copied and written by the 3A thread. The readers in other threads must call
+ * get() and keep the returned snapshot while using it, since the 3A thread may replace
+ * the data of a reused result at any time; operator* and operator-> are for the 3A thread.
+ */
+template <typename T>
+class CowResult {
+ public:
+    CowResult() : mData(std::make_shared<T>()) {}
+    CowResult(const CowResult& other) : mData(other.get()) {}
+
+    CowResult& operator=(const CowResult& other) {
+        std::atomic_store(&mData, std::atomic_load(&other.mData));
+        return *this;
+    }
+
+    std::shared_ptr<const T> get() const { return std::atomic_load(&mData); }
+
+    const T& operator*() const { return *mData; }
+    const T* operator->() const { return mData.get(); }
+
+    T* getWritable() {
+        if (isShared()) {
+            std::atomic_store(&mData, std::make_shared<T>(*mData));
+        }
+        return mData.get();
+    }
+
+    void set(const T& data) {
+        if (isShared()) {
+            std::atomic_store(&mData, std::make_shared<T>(data));
+        } else {
+            *mData = data;
+        }
+    }
+
+ private:
+    // Load it to wait for the readers which are taking it, then count mData and the copy
+    bool isShared() const { return std::atomic_load(&mData).use_count() > 2; }
+
+    // Replaced with std::atomic_store, read with std::atomic_load out of the 3A thread
+    std::shared_ptr<T> mData;
+};
+
+typedef std::array<float, DEFAULT_LSC_GRID_SIZE * 4> LensShadingMap;
+
 /**
  * \class AiqResult
  * The private structs are part of AE, AF, AWB, PA and SA results.
@@ -55,13 +109,13 @@ public:
     cca::cca_ae_results mAeResults;
     cca::cca_awb_results mAwbResults;
     cca::cca_af_results mAfResults;
-    cca::cca_gbce_params mGbceResults;
+    CowResult<cca::cca_gbce_params> mGbceResults;
     cca::cca_pa_params mPaResults;
     cca::cca_out_stats mOutStats;
 
     ia_isp_custom_controls mCustomControls;
 
-    float mLensShadingMap[DEFAULT_LSC_GRID_SIZE * 4];
+    CowResult<LensShadingMap> mLensShadingMap;
 
     int64_t mFrameDuration;   // us
     int64_t mRollingShutter;  // us
@@ -17,15 +17,27 @@
 #define LOG_TAG AiqResultStorage
 
 #include "AiqResultStorage.h"
+
+#include <algorithm>
+
 #include "iutils/CameraLog.h"
 
 namespace icamera {
 
 AiqResultStorage::AiqResultStorage(int cameraId) :
-    mCameraId(cameraId) {
+    mCameraId(cameraId),
+    mLatestIndex(-1) {
+    static_assert((kSeqIndexSize & kSeqIndexMask) == 0, "kSeqIndexSize must be power of two");
+    static_assert(kSeqIndexSize > kStorageSize, "kSeqIndexSize is too small");
+
     for (int i = 0; i < kStorageSize; i++) {
         mAiqResults[i] = new AiqResult(mCameraId);
         mAiqResults[i]->init();
+        mResultVersion[i].store(0U, std::memory_order_relaxed);
+        mResultSequence[i].store(-1, std::memory_order_relaxed);
+    }
+    for (int i = 0; i < kSeqIndexSize; i++) {
+        mSeqIndex[i].store(-1, std::memory_order_relaxed);
     }
 }
 
@@ -86,37 +98,78 @@ void AiqResultStorage::unLockAiqStatistics() {
 }
 
 AiqResult* AiqResultStorage::acquireAiqResult() {
-    AutoWMutex rlock(mDataLock);
-
     int index = mCurrentIndex + 1;
     index %= kStorageSize;
+
+    // Make the version odd before the writer touches the result
+    const uint32_t version = mResultVersion[index].load(std::memory_order_relaxed);
+    if ((version & 1U) == 0U) {
+        mResultVersion[index].store(version + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    mResultSequence[index].store(-1, std::memory_order_relaxed);
     mAiqResults[index]->mSequence = -1;
 
     return mAiqResults[index];
 }
 
 void AiqResultStorage::updateAiqResult(int64_t sequence) {
-    AutoWMutex wlock(mDataLock);
-
+    const int lastIndex = mCurrentIndex;
     mCurrentIndex++;
     mCurrentIndex %= kStorageSize;
     mAiqResults[mCurrentIndex]->mSequence = sequence;
+
+    mResultSequence[mCurrentIndex].store(sequence, std::memory_order_relaxed);
+    const uint32_t version = mResultVersion[mCurrentIndex].load(std::memory_order_relaxed);
+    mResultVersion[mCurrentIndex].store((version + 1U) & ~1U, std::memory_order_release);
+
+    // The sequences between the last result and this one still use the last result
+    int64_t seq = std::max(mLatestSequence + 1, sequence - kSeqIndexSize + 1);
+    if ((lastIndex >= 0) && (mLatestSequence >= 0)) {
+        for (; seq < sequence; seq++) {
+            mSeqIndex[seq & kSeqIndexMask].store(lastIndex, std::memory_order_relaxed);
+        }
+    }
+    if (sequence >= 0) {
+        mSeqIndex[sequence & kSeqIndexMask].store(mCurrentIndex, std::memory_order_relaxed);
+    }
+    mLatestSequence = sequence;
+
+    mLatestIndex.store(mCurrentIndex, std::memory_order_release);
 }
 
-const AiqResult* AiqResultStorage::getAiqResult(int64_t sequence) {
-    AutoRMutex rlock(mDataLock);
+bool AiqResultStorage::isNewestAiqResult(int index, int64_t sequence, int latestIndex) const {
+    const uint32_t version = mResultVersion[index].load(std::memory_order_acquire);
+    if ((version & 1U) != 0U) {
+        return false;
+    }
 
-    // Sequence id is -1 means user wants get the latest result.
-    if (sequence == -1) {
-        // If mCurrentIndex is -1, that means no result is saved to the storage yet,
-        // just return the first one in this case.
-        return mAiqResults[(mCurrentIndex == -1) ? 0 : mCurrentIndex];
+    const int64_t resultSeq = mResultSequence[index].load(std::memory_order_relaxed);
+    bool newest = (resultSeq >= 0) && (resultSeq <= sequence);
+    if (newest && (index != latestIndex)) {
+        // The next result is newer, it must be after the sequence
+        const int next = (index + 1) % kStorageSize;
+        const int64_t nextSeq = mResultSequence[next].load(std::memory_order_relaxed);
+        newest = (nextSeq < 0) || (nextSeq > sequence);
     }
 
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return newest && (mResultVersion[index].load(std::memory_order_relaxed) == version);
+}
+
+const AiqResult* AiqResultStorage::searchAiqResult(int64_t sequence, int latestIndex) const {
     for (int i = 0; i < kStorageSize; i++) {
         // Search from the newest result
-        const int tmpIdx = (mCurrentIndex + kStorageSize - i) % kStorageSize;
-        if ((mAiqResults[tmpIdx]->mSequence >= 0) && (sequence >= mAiqResults[tmpIdx]->mSequence)) {
+        const int tmpIdx = (latestIndex + kStorageSize - i) % kStorageSize;
+        const uint32_t version = mResultVersion[tmpIdx].load(std::memory_order_acquire);
+        const int64_t resultSeq = mResultSequence[tmpIdx].load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (((version & 1U) != 0U) ||
+            (mResultVersion[tmpIdx].load(std::memory_order_relaxed) != version)) {
+            continue;
+        }
+
+        if ((resultSeq >= 0) && (sequence >= resultSeq)) {
             return mAiqResults[tmpIdx];
         }
     }
@@ -124,6 +177,32 @@ const AiqResult* AiqResultStorage::getAiqResult(int64_t sequence) {
     return nullptr;
 }
 
+const AiqResult* AiqResultStorage::getAiqResult(int64_t sequence) {
+    const int latestIndex = mLatestIndex.load(std::memory_order_acquire);
+
+    // Sequence id is -1 means user wants get the latest result.
+    if (sequence == -1) {
+        // If latestIndex is -1, that means no result is saved to the storage yet,
+        // just return the first one in this case.
+        return mAiqResults[(latestIndex == -1) ? 0 : latestIndex];
+    }
+
+    if (latestIndex == -1) {
+        return nullptr;
+    }
+
+    if (isNewestAiqResult(latestIndex, sequence, latestIndex)) {
+        return mAiqResults[latestIndex];
+    }
+
+    const int index = mSeqIndex[sequence & kSeqIndexMask].load(std::memory_order_acquire);
+    if ((index >= 0) && isNewestAiqResult(index, sequence, latestIndex)) {
+        return mAiqResults[index];
+    }
+
+    return searchAiqResult(sequence, latestIndex);
+}
+
 FaceDetectionResult* AiqResultStorage::acquireFaceResult() {
     AutoWMutex rlock(mFaceLock);
 
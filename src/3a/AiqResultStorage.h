@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 
 #include "AiqResult.h"
@@ -37,6 +38,10 @@ namespace icamera {
  *
  * It's a singleton based on camera id, and its life cycle can be maintained by
  * its static methods getInstance and releaseAiqResultStorage.
+ *
+ * The Aiq results have one writer (AiqEngine) and many readers, getAiqResult() doesn't
+ * take any lock. Each result has a version which is odd while the writer fills it
+ * (seqlock), and the result for a sequence is found by a ring indexed by sequence.
  */
 class AiqResultStorage {
 public:
@@ -52,6 +57,8 @@ public:
 
     /**
      * \brief Update mCurrentIndex and set sequence id into internal storage.
+     *
+     * Aiq result is acquired and updated by one thread.
      */
     void updateAiqResult(int64_t sequence);
 
@@ -61,7 +68,7 @@ public:
      * The function will return the internal pointer of AiqResult, the caller MUST use this
      * pointer quickly, let's say less than 10ms. For any time-consuming operations, it's
      * the caller's responsibility to do a deep-copy, otherwise the data in returned AiqResult
-     * may not be consistent.
+     * may not be consistent. It never blocks and never returns a result being written.
      *
      * param[in] int64_t sequence: specify which aiq result is needed.
      *
@@ -126,12 +133,28 @@ public:
     ~AiqResultStorage();
 
 private:
+    bool isNewestAiqResult(int index, int64_t sequence, int latestIndex) const;
+    const AiqResult* searchAiqResult(int64_t sequence, int latestIndex) const;
+
     int mCameraId;
-    RWLock mDataLock;   // lock for all the data storage below
 
     static const int kStorageSize = MAX_SETTING_COUNT; // Should > MAX_BUFFER_COUNT + sensorLag
-    int mCurrentIndex = -1;
+    int mCurrentIndex = -1;  // Only used by the writer
+    std::atomic<int> mLatestIndex;  // The index of the latest result for readers
     AiqResult* mAiqResults[kStorageSize];
+    // Seqlock of each result, odd while the writer fills it
+    std::atomic<uint32_t> mResultVersion[kStorageSize];
+    // Sequence of each result, -1 means invalid
+    std::atomic<int64_t> mResultSequence[kStorageSize];
+
+    // The entry of sequence s is at (s & kSeqIndexMask), it is the index of the newest result
+    // whose sequence is not larger than s. Readers verify it with the result sequences.
+    static const int kSeqIndexSize = 64;  // Power of two, larger than kStorageSize
+    static const int64_t kSeqIndexMask = kSeqIndexSize - 1;
+    std::atomic<int> mSeqIndex[kSeqIndexSize];
+    int64_t mLatestSequence = -1;  // Only used by the writer
+
+    RWLock mDataLock;   // lock for the statistics storage below
 
     static const int kAiqStatsStorageSize = 3; // Always use the latest, but may hold for long time
     int mCurrentAiqStatsIndex = -1;
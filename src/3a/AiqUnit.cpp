@@ -22,6 +22,7 @@
 
 #include "iutils/Errors.h"
 #include "iutils/CameraLog.h"
+#include "iutils/FrameTimeline.h"
 #include "CameraContext.h"
 #include "PlatformData.h"
 
@@ -272,6 +273,7 @@ void AiqUnit::stop() {
 int AiqUnit::run3A(int64_t ccaId, int64_t applyingSeq, int64_t frameNumber, int64_t* effectSeq) {
     AutoMutex l(mAiqUnitLock);
     TRACE_LOG_PROCESS("AiqUnit", "run3A");
+    FRAME_TIMELINE_SCOPE(mCameraId, TIMELINE_AIQ_RUN, applyingSeq);
 
     if (mAiqUnitState != AIQ_UNIT_START) {
         LOGW("%s: AIQ is not started: %d", __func__, mAiqUnitState);
@@ -128,7 +128,7 @@ int Dvs::configCcaDvsData(const ConfigMode configMode, cca::cca_init_params *par
     return OK;
 }
 
-void Dvs::handleEvent(EventData eventData) {
+void Dvs::handleEvent(const EventData& eventData) {
     LOG2("@%s: eventData.type:%d", __func__, eventData.type);
 
     if (eventData.type != EVENT_PSYS_STATS_BUF_READY) {
@@ -34,7 +34,7 @@ class Dvs : public EventListener {
     ~Dvs();
 
     int configure(const ConfigMode configMode, cca::cca_init_params *params);
-    void handleEvent(EventData eventData);
+    void handleEvent(const EventData& eventData);
 
  private:
     int configCcaDvsData(const ConfigMode configMode, cca::cca_init_params *params);
@@ -43,7 +43,7 @@ void LensManager::reset() {
     mLastSofSequence = -1;
 }
 
-void LensManager::handleSofEvent(EventData eventData) {
+void LensManager::handleSofEvent(const EventData& eventData) {
     AutoMutex l(mLock);
     if (eventData.type == EVENT_ISYS_SOF) {
         mLastSofSequence = eventData.data.sync.sequence;
@@ -44,7 +44,7 @@ public:
     /**
      * \brief handle SOF event
      */
-    void handleSofEvent(EventData eventData);
+    void handleSofEvent(const EventData& eventData);
 
     /**
      * \brief Set Lens results
@@ -73,7 +73,7 @@ void SensorManager::reset() {
     mSofEventInfo.clear();
 }
 
-void SensorManager::handleSofEvent(EventData eventData) {
+void SensorManager::handleSofEvent(const EventData& eventData) {
     AutoMutex l(mLock);
     if (eventData.type == EVENT_ISYS_SOF) {
         LOG2("<seq%ld> SOF timestamp = %ld", eventData.data.sync.sequence,
@@ -166,6 +166,8 @@ int SensorManager::setAWB(float r_per_g, float b_per_g) {
 // HDR_FEATURE_E
 
 void SensorManager::handleSensorExposure() {
+    mSensorHwCtrl->beginControls();
+
     if (mExposureDataMap.find(mLastSofSequence) != mExposureDataMap.end()) {
         const ExposureData& exposureData = mExposureDataMap[mLastSofSequence];
         mSensorHwCtrl->setFrameDuration(exposureData.lineLengthPixels,
@@ -183,6 +185,8 @@ void SensorManager::handleSensorExposure() {
         mSensorHwCtrl->setDigitalGains(mDigitalGainMap[mLastSofSequence]);
         mDigitalGainMap.erase(mLastSofSequence);
     }
+
+    mSensorHwCtrl->commitControls();
 }
 
 int SensorManager::getCurrentExposureAppliedDelay() {
@@ -219,6 +223,7 @@ uint32_t SensorManager::updateSensorExposure(SensorExpGroup sensorExposures, int
         digitalGains.push_back(digitalGain);
     }
 
+    mSensorHwCtrl->beginControls();
     if (effectSeq > 0) {
         int sensorSeq = mLastSofSequence + static_cast<int32_t>(mExposureDataMap.size()) + 1;
         if ((applyingSeq > 0) && (applyingSeq == mLastSofSequence)) {
@@ -248,6 +253,7 @@ uint32_t SensorManager::updateSensorExposure(SensorExpGroup sensorExposures, int
         mSensorHwCtrl->setAnalogGains(analogGains);
         mSensorHwCtrl->setDigitalGains(digitalGains);
     }
+    mSensorHwCtrl->commitControls();
 
     LOG2("<seq%ld>@%s: effectSeq %ld, applyingSeq %ld", mLastSofSequence, __func__,
          effectSeq, applyingSeq);
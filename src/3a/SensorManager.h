@@ -57,7 +57,7 @@ public:
     ~SensorManager();
     void reset();
 
-    void handleSofEvent(EventData eventData);
+    void handleSofEvent(const EventData& eventData);
     /* sensorExposures are exposure results, applyingSeq is the sequence to apply results */
     uint32_t updateSensorExposure(SensorExpGroup sensorExposures, int64_t applyingSeq);
     int getSensorInfo(ia_aiq_frame_params &frameParams,
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times AiqResultStorage::getAiqResult() of the recent sequences on 1, 2, 4
+// and 8 reader threads, while a writer publishes a result every 100 us, a lot
+// faster than any sensor. Prints ns per lookup of each reader.
+//
+// Usage: AiqResultStorageBenchmark [milliseconds]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "AiqResultStorage.h"
+
+using icamera::AiqResult;
+using icamera::AiqResultStorage;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double run(int readerNum, int milliseconds) {
+    AiqResultStorage storage(0);
+    std::atomic<int64_t> published(-1);
+    std::atomic<bool> stop(false);
+
+    std::thread writer([&]() {
+        for (int64_t seq = 0; !stop; seq++) {
+            storage.acquireAiqResult()->mFrameId = seq;
+            storage.updateAiqResult(seq);
+            published.store(seq, std::memory_order_release);
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    });
+
+    std::vector<double> nsPerLookup(readerNum);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < readerNum; t++) {
+        readers.emplace_back([&, t]() {
+            long count = 0;
+            long found = 0;
+            const Clock::time_point start = Clock::now();
+            while (!stop) {
+                const int64_t latest = published.load(std::memory_order_acquire);
+                if (latest < 8) continue;
+                const AiqResult* result = storage.getAiqResult(latest - (count & 7));
+                found += (result != nullptr) ? 1 : 0;
+                count++;
+            }
+            const std::chrono::duration<double, std::nano> ns = Clock::now() - start;
+            nsPerLookup[t] = (count > 0) ? ns.count() / count : 0;
+            if (found > count) printf("unreachable\n");  // Keeps the lookups
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    stop = true;
+    writer.join();
+    for (auto& reader : readers) reader.join();
+
+    double sum = 0;
+    for (double ns : nsPerLookup) sum += ns;
+    return sum / readerNum;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int milliseconds = (argc > 1) ? atoi(argv[1]) : 1000;
+    if (milliseconds <= 0) {
+        fprintf(stderr, "Usage: %s [milliseconds]\n", argv[0]);
+        return 1;
+    }
+
+    const int readerNums[] = {1, 2, 4, 8};
+    for (int readerNum : readerNums) {
+        printf("%d readers: %7.1f ns/lookup\n", readerNum, run(readerNum, milliseconds));
+    }
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks the sequence lookup of AiqResultStorage::getAiqResult(): the newest
+// result not after the sequence is returned, skipped 3A runs reuse the last
+// result, and overwritten sequences give nullptr. Then one writer publishes
+// results as AiqEngine does while reader threads look them up, and checks
+// that no reader gets a result being written or the result of another
+// sequence. A reader preempted for about a ring period is not checked, the
+// caller must use the result quickly.
+//
+// Usage: AiqResultStorageTest [seconds] [readers]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "AiqResultStorage.h"
+
+using icamera::AiqResult;
+using icamera::AiqResultStorage;
+
+namespace {
+
+const int kCameraId = 0;
+const int64_t kStorageSize = MAX_SETTING_COUNT;
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what, int64_t sequence) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s, sequence %ld\n", what, static_cast<long>(sequence));
+        gFailures++;
+    }
+}
+
+// The fields the writer fills with the sequence, they are equal if not torn
+void fillResult(AiqResult* result, int64_t sequence) {
+    result->mFrameId = sequence;
+    result->mTimestamp = static_cast<unsigned long long>(sequence);
+    result->mLensPosition = static_cast<uint32_t>(sequence);
+    result->mFrameDuration = sequence;
+}
+
+bool isWhole(const AiqResult* result) {
+    const int64_t sequence = result->mFrameId;
+    return (result->mTimestamp == static_cast<unsigned long long>(sequence)) &&
+           (result->mLensPosition == static_cast<uint32_t>(sequence)) &&
+           (result->mFrameDuration == sequence);
+}
+
+void publish(AiqResultStorage* storage, int64_t sequence) {
+    fillResult(storage->acquireAiqResult(), sequence);
+    storage->updateAiqResult(sequence);
+}
+
+// Like AiqEngine, the results of some sequences are skipped
+bool isSkipped(int64_t sequence) {
+    return (sequence % 7) == 3;
+}
+
+void testLookup() {
+    AiqResultStorage storage(kCameraId);
+    expect(storage.getAiqResult(0) == nullptr, "no result before the first one", 0);
+
+    const int64_t last = kStorageSize * 3;
+    for (int64_t seq = 0; seq <= last; seq++) {
+        if (!isSkipped(seq)) publish(&storage, seq);
+    }
+
+    const AiqResult* latest = storage.getAiqResult();
+    expect(latest != nullptr && latest->mSequence == last, "-1 gets the latest result", -1);
+    const AiqResult* newer = storage.getAiqResult(last + 5);
+    expect(newer != nullptr && newer->mSequence == last, "a newer sequence gets the latest",
+           last + 5);
+
+    // The ring keeps the last kStorageSize results, with the skipped sequences among them
+    for (int64_t seq = last - kStorageSize; seq <= last; seq++) {
+        const AiqResult* result = storage.getAiqResult(seq);
+        const int64_t expected = isSkipped(seq) ? seq - 1 : seq;
+        expect(result != nullptr && result->mSequence == expected && result->mFrameId == expected,
+               "the newest result not after the sequence", seq);
+    }
+    expect(storage.getAiqResult(kStorageSize) == nullptr, "an overwritten sequence", kStorageSize);
+    expect(storage.getAiqResult(0) == nullptr, "the first sequence is overwritten", 0);
+}
+
+void testReadersDuringWrites(int seconds, int readerNum) {
+    AiqResultStorage storage(kCameraId);
+    std::atomic<int64_t> published(-1);
+    std::atomic<bool> stop(false);
+    std::atomic<long> lookups(0);
+    std::atomic<long> torn(0);
+    std::atomic<long> wrong(0);
+
+    std::thread writer([&]() {
+        for (int64_t seq = 0; !stop; seq++) {
+            if (isSkipped(seq)) continue;
+            publish(&storage, seq);
+            published.store(seq, std::memory_order_release);
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < readerNum; t++) {
+        readers.emplace_back([&]() {
+            long count = 0;
+            while (!stop) {
+                const int64_t latest = published.load(std::memory_order_acquire);
+                if (latest < kStorageSize) continue;
+                const int64_t seq = latest - (count % 8);
+                const AiqResult* result = storage.getAiqResult(seq);
+                count++;
+                const bool whole = (result != nullptr) && isWhole(result);
+                const int64_t resultSeq = (result != nullptr) ? result->mFrameId : -1;
+                if (published.load(std::memory_order_acquire) - latest >= kStorageSize / 2) {
+                    continue;
+                }
+                if ((result != nullptr) && !whole) torn++;
+                // The result of seq or of the sequence before a skipped one
+                if ((result == nullptr) || (resultSeq > seq) || (seq - resultSeq > 1)) wrong++;
+            }
+            lookups += count;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    stop = true;
+    writer.join();
+    for (auto& reader : readers) reader.join();
+
+    printf("%d readers, %ld lookups, %ld torn, %ld wrong\n", readerNum, lookups.load(),
+           torn.load(), wrong.load());
+    expect(lookups > 0, "the readers ran", published);
+    expect(torn == 0, "no torn result", published);
+    expect(wrong == 0, "the result of the sequence", published);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int seconds = (argc > 1) ? atoi(argv[1]) : 2;
+    const int readers = (argc > 2) ? atoi(argv[2]) : 4;
+    if (seconds <= 0 || readers <= 0) {
+        fprintf(stderr, "Usage: %s [seconds] [readers]\n", argv[0]);
+        return 1;
+    }
+
+    testLookup();
+    testReadersDuringWrites(seconds, readers);
+
+    if (gFailures == 0) {
+        printf("AiqResultStorageTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
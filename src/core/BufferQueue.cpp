@@ -37,13 +37,14 @@ BufferQueue::~BufferQueue() {}
 
 int BufferQueue::queueInputBuffer(uuid port, const std::shared_ptr<CameraBuffer>& camBuffer) {
     // If it's not in mInputQueue, then it's not for this processor.
-    if (mInputQueue.find(port) == mInputQueue.end()) {
+    auto it = mInputQueue.find(port);
+    if (it == mInputQueue.end()) {
         return OK;
     }
 
     LOG2("%s CameraBuffer %p for port:%x", __func__, camBuffer.get(), port);
 
-    CameraBufQ& input = mInputQueue[port];
+    CameraBufRing& input = it->second;
     const bool needSignal = input.empty();
     input.push(camBuffer);
     if (needSignal) {
@@ -107,11 +108,10 @@ int BufferQueue::qbuf(uuid port, const std::shared_ptr<CameraBuffer>& camBuffer)
 
     // Enqueue buffer to internal pool
     AutoMutex l(mBufferQueueLock);
-    CheckAndLogError(mOutputQueue.find(port) == mOutputQueue.end(), BAD_VALUE,
-                     "Not supported port:%x", port);
+    auto it = mOutputQueue.find(port);
+    CheckAndLogError(it == mOutputQueue.end(), BAD_VALUE, "Not supported port:%x", port);
 
-    CameraBufQ& output = mOutputQueue[port];
-    output.push(camBuffer);
+    it->second.push(camBuffer);
 
     return OK;
 }
@@ -121,12 +121,12 @@ void BufferQueue::clearBufferQueues() {
 
     mInputQueue.clear();
     for (const auto& input : mInputFrameInfo) {
-        mInputQueue[input.first] = CameraBufQ();
+        mInputQueue[input.first] = CameraBufRing();
     }
 
     mOutputQueue.clear();
     for (const auto& output : mOutputFrameInfo) {
-        mOutputQueue[output.first] = CameraBufQ();
+        mOutputQueue[output.first] = CameraBufRing();
     }
 }
 
@@ -150,13 +150,13 @@ void BufferQueue::setThreadWaiting(bool waiting) {
 
 int BufferQueue::waitFreeBuffersInQueue(std::unique_lock<std::mutex>& lock,
                                         std::map<uuid, std::shared_ptr<CameraBuffer> >& buffer,
-                                        std::map<uuid, CameraBufQ>& bufferQueue,
+                                        PortBufQueues& bufferQueue,
                                         int64_t timeout) {
     timeout = (timeout != 0 ? timeout : kWaitDuration) * SLOWLY_MULTIPLIER;
 
     for (auto& queue : bufferQueue) {
         const uuid port = queue.first;
-        CameraBufQ& cameraBufQ = queue.second;
+        CameraBufRing& cameraBufQ = queue.second;
         if (cameraBufQ.empty()) {
             LOG2("%s: wait port %x", __func__, port);
             const std::cv_status status = mFrameAvailableSignal.wait_for(
@@ -201,7 +201,7 @@ int BufferQueue::getFreeBuffersInQueue(std::map<uuid, std::shared_ptr<CameraBuff
                                        std::map<uuid, std::shared_ptr<CameraBuffer> >& outBuffers) {
     for (auto& input : mInputQueue) {
         const uuid port = input.first;
-        CameraBufQ& inputQueue = input.second;
+        CameraBufRing& inputQueue = input.second;
         if (inputQueue.empty()) {
             inBuffers.clear();
             return NOT_ENOUGH_DATA;
@@ -211,7 +211,7 @@ int BufferQueue::getFreeBuffersInQueue(std::map<uuid, std::shared_ptr<CameraBuff
 
     for (auto& output : mOutputQueue) {
         const uuid port = output.first;
-        CameraBufQ& outputQueue = output.second;
+        CameraBufRing& outputQueue = output.second;
         if (outputQueue.empty()) {
             inBuffers.clear();
             outBuffers.clear();
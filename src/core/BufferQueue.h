@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <map>
+#include <utility>
 #include <vector>
 #include <condition_variable>
 
@@ -29,6 +31,114 @@
 
 namespace icamera {
 
+/**
+ * \class CameraBufRing
+ *
+ * A FIFO of camera buffers backed by a power-of-two ring, it has the same
+ * interface as CameraBufQ but doesn't allocate memory per push after the
+ * initial capacity is reached. The capacity is doubled if it's full.
+ */
+class CameraBufRing {
+ public:
+    explicit CameraBufRing(size_t capacity = kDefaultCapacity)
+            : mBuffers(roundUpPowerOf2(capacity)),
+              mHead(0U),
+              mCount(0U) {}
+
+    bool empty() const { return mCount == 0U; }
+    size_t size() const { return mCount; }
+
+    const std::shared_ptr<CameraBuffer>& front() const { return mBuffers[mHead]; }
+
+    void push(const std::shared_ptr<CameraBuffer>& buffer) {
+        if (mCount == mBuffers.size()) {
+            grow();
+        }
+        mBuffers[(mHead + mCount) & (mBuffers.size() - 1U)] = buffer;
+        mCount++;
+    }
+
+    void pop() {
+        if (mCount == 0U) {
+            return;
+        }
+        // Drop the reference here, the buffer may be owned by others
+        mBuffers[mHead].reset();
+        mHead = (mHead + 1U) & (mBuffers.size() - 1U);
+        mCount--;
+    }
+
+ private:
+    static const size_t kDefaultCapacity = MAX_BUFFER_COUNT;
+
+    static size_t roundUpPowerOf2(size_t value) {
+        size_t size = 1U;
+        while (size < value) {
+            size <<= 1;
+        }
+        return size;
+    }
+
+    void grow() {
+        std::vector<std::shared_ptr<CameraBuffer> > buffers(mBuffers.size() * 2U);
+        for (size_t i = 0U; i < mCount; i++) {
+            buffers[i] = std::move(mBuffers[(mHead + i) & (mBuffers.size() - 1U)]);
+        }
+        mBuffers.swap(buffers);
+        mHead = 0U;
+    }
+
+    std::vector<std::shared_ptr<CameraBuffer> > mBuffers;
+    size_t mHead;
+    size_t mCount;
+};
+
+/**
+ * \class PortBufQueues
+ *
+ * The buffer queues of all ports of one BufferQueue. The ports are stored in
+ * a dense array sorted by uuid, so the per-frame lookup and the iteration over
+ * all ports don't chase map nodes. The ports are only added at configuration
+ * time, and the interface follows std::map<uuid, CameraBufRing>.
+ */
+class PortBufQueues {
+ public:
+    typedef std::pair<uuid, CameraBufRing> PortQueue;
+    typedef std::vector<PortQueue>::iterator iterator;
+    typedef std::vector<PortQueue>::const_iterator const_iterator;
+
+    iterator begin() { return mQueues.begin(); }
+    iterator end() { return mQueues.end(); }
+    const_iterator begin() const { return mQueues.begin(); }
+    const_iterator end() const { return mQueues.end(); }
+
+    bool empty() const { return mQueues.empty(); }
+    size_t size() const { return mQueues.size(); }
+    void clear() { mQueues.clear(); }
+
+    iterator find(uuid port) {
+        auto it = lowerBound(port);
+        return ((it != mQueues.end()) && (it->first == port)) ? it : mQueues.end();
+    }
+
+    CameraBufRing& operator[](uuid port) {
+        auto it = lowerBound(port);
+        if ((it == mQueues.end()) || (it->first != port)) {
+            it = mQueues.insert(it, PortQueue(port, CameraBufRing()));
+        }
+        return it->second;
+    }
+
+ private:
+    iterator lowerBound(uuid port) {
+        return std::lower_bound(
+            mQueues.begin(), mQueues.end(), port,
+            [](const PortQueue& queue, uuid value) { return queue.first < value; });
+    }
+
+    std::vector<PortQueue> mQueues;
+};
+
 class BufferQueue : public BufferConsumer, public BufferProducer, public EventListener {
  public:
     BufferQueue();
@@ -105,7 +215,7 @@ class BufferQueue : public BufferConsumer, public BufferProducer, public EventLi
                                int64_t timeout = 0);
     int waitFreeBuffersInQueue(std::unique_lock<std::mutex>& lock,
                                std::map<uuid, std::shared_ptr<CameraBuffer> >& buffer,
-                               std::map<uuid, CameraBufQ>& bufferQueue, int64_t timeout);
+                               PortBufQueues& bufferQueue, int64_t timeout);
     /**
      * \brief Get available input and output buffers and pop them from buffer queue.
      *
@@ -137,8 +247,8 @@ class BufferQueue : public BufferConsumer, public BufferProducer, public EventLi
     std::map<uuid, stream_t> mInputFrameInfo;
     std::map<uuid, stream_t> mOutputFrameInfo;
 
-    std::map<uuid, CameraBufQ> mInputQueue;
-    std::map<uuid, CameraBufQ> mOutputQueue;
+    PortBufQueues mInputQueue;
+    PortBufQueues mOutputQueue;
 
     // For internal buffers allocation for producer
     std::map<uuid, CameraBufVector> mInternalBuffers;
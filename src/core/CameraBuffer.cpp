@@ -24,11 +24,15 @@
 #endif
 
 #include <errno.h>
+#include <linux/dma-buf.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/ioctl.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "PlatformData.h"
@@ -60,6 +64,10 @@ CameraBuffer::CameraBuffer(int memory, uint32_t size, int index)
 
 CameraBuffer::~CameraBuffer() {
     freeMemory();
+    if (mV.Memory() == V4L2_MEMORY_DMABUF) {
+        // Don't keep the DMA buffer alive with a cached mapping
+        CameraBufferMapper::releaseBuffer(this);
+    }
 
     if ((mBufferflag & BUFFER_FLAG_INTERNAL) != 0U) {
         delete mU;
@@ -394,26 +402,225 @@ void* CameraBuffer::getBufferAddr() {
     return ret;
 }
 
-CameraBufferMapper::CameraBufferMapper(std::shared_ptr<CameraBuffer> buffer)
-        : mBuffer(buffer),
+namespace {
+
+/**
+ * Keeps the CPU mappings of DMA buffers, so the SW stages don't mmap and munmap
+ * the same buffer for each frame. A DMA buffer is identified by the inode of its
+ * fd, which is valid as long as the cached mapping holds the buffer.
+ * Each mapping records the CameraBuffer that used it last, and it is dropped when
+ * that CameraBuffer is destroyed.
+ */
+class DmaBufMapCache {
+ public:
+    DmaBufMapCache() : mUseCount(0U), mHits(0U), mMisses(0U), mEvictions(0U) {}
+
+    void* acquire(int fd, uint32_t size, const CameraBuffer* owner) {
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            return map(fd, size);
+        }
+
+        std::lock_guard<std::mutex> l(mLock);
+        for (auto& entry : mEntries) {
+            if (entry.ino == st.st_ino && entry.dev == st.st_dev && entry.size == size &&
+                !entry.stale) {
+                entry.users++;
+                entry.lastUse = ++mUseCount;
+                entry.owner = owner;
+                mHits++;
+                return entry.addr;
+            }
+        }
+
+        mMisses++;
+        void* addr = map(fd, size);
+        if (addr == nullptr) {
+            return nullptr;
+        }
+        if (mEntries.size() >= kMaxEntries && !evictLocked()) {
+            // All cached mappings are in use, don't cache this one
+            return addr;
+        }
+
+        MapEntry entry = {st.st_dev, st.st_ino, size, addr, owner, 1U, ++mUseCount, false};
+        mEntries.push_back(entry);
+        return addr;
+    }
+
+    void release(void* addr, uint32_t size) {
+        {
+            std::lock_guard<std::mutex> l(mLock);
+            for (size_t i = 0U; i < mEntries.size(); i++) {
+                MapEntry& entry = mEntries[i];
+                if (entry.addr != addr) {
+                    continue;
+                }
+                entry.users--;
+                if (entry.stale && entry.users == 0U) {
+                    CameraBuffer::unmapDmaBufferAddr(entry.addr, entry.size);
+                    mEntries.erase(mEntries.begin() + i);
+                }
+                return;
+            }
+        }
+        CameraBuffer::unmapDmaBufferAddr(addr, size);
+    }
+
+    // The owner is destroyed, its DMA buffer may be freed by the application
+    void evictOwner(const CameraBuffer* owner) {
+        std::lock_guard<std::mutex> l(mLock);
+        for (auto it = mEntries.begin(); it != mEntries.end();) {
+            if (it->owner != owner) {
+                ++it;
+                continue;
+            }
+            mEvictions++;
+            if (it->users == 0U) {
+                CameraBuffer::unmapDmaBufferAddr(it->addr, it->size);
+                it = mEntries.erase(it);
+            } else {
+                it->stale = true;
+                it->owner = nullptr;
+                ++it;
+            }
+        }
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> l(mLock);
+        LOG1("%s: %zu mappings, hit %lu, miss %lu, evict %lu", __func__, mEntries.size(), mHits,
+             mMisses, mEvictions);
+        for (auto it = mEntries.begin(); it != mEntries.end();) {
+            if (it->users == 0U) {
+                CameraBuffer::unmapDmaBufferAddr(it->addr, it->size);
+                it = mEntries.erase(it);
+            } else {
+                // Still accessed by SW, unmap it when the last user releases it
+                it->stale = true;
+                ++it;
+            }
+        }
+        mHits = 0U;
+        mMisses = 0U;
+        mEvictions = 0U;
+    }
+
+ private:
+    static void* map(int fd, uint32_t size) {
+        void* addr = CameraBuffer::mapDmaBufferAddr(fd, size);
+        CheckAndLogError(addr == MAP_FAILED, nullptr, "failed to map dma buffer fd %d", fd);
+        return addr;
+    }
+
+    // Unmap the least recently used mapping which isn't in use
+    bool evictLocked() {
+        auto lru = mEntries.end();
+        for (auto it = mEntries.begin(); it != mEntries.end(); ++it) {
+            if (it->users == 0U && (lru == mEntries.end() || it->lastUse < lru->lastUse)) {
+                lru = it;
+            }
+        }
+        if (lru == mEntries.end()) {
+            return false;
+        }
+
+        CameraBuffer::unmapDmaBufferAddr(lru->addr, lru->size);
+        mEntries.erase(lru);
+        mEvictions++;
+        return true;
+    }
+
+ private:
+    // Enough for the buffer pools of a few streams
+    static const size_t kMaxEntries = 4 * MAX_BUFFER_COUNT;
+
+    struct MapEntry {
+        dev_t dev;
+        ino_t ino;
+        uint32_t size;
+        void* addr;
+        const CameraBuffer* owner;
+        uint32_t users;
+        uint64_t lastUse;
+        bool stale;
+    };
+
+    std::mutex mLock;
+    std::vector<MapEntry> mEntries;
+    uint64_t mUseCount;
+    uint64_t mHits;
+    uint64_t mMisses;
+    uint64_t mEvictions;
+};
+
+// One cache per camera, so stopping a camera only releases its own mappings
+DmaBufMapCache gDmaBufMapCaches[MAX_CAMERA_NUMBER];
+
+DmaBufMapCache& getDmaBufMapCache(int cameraId) {
+    return gDmaBufMapCaches[cameraId];
+}
+
+}  // namespace
+
+CameraBufferMapper::CameraBufferMapper(int cameraId, std::shared_ptr<CameraBuffer> buffer)
+        : mCameraId(cameraId),
+          mBuffer(buffer),
           mDMAMapped(false) {
+    CheckAndLogError((cameraId < 0) || (cameraId >= MAX_CAMERA_NUMBER), VOID_VALUE,
+                     "Invalid camera id %d", cameraId);
+
     if ((buffer->getMemory() == V4L2_MEMORY_DMABUF) &&
         (mBuffer->getUserBuffer()->addr == nullptr)) {
-        void* addr = CameraBuffer::mapDmaBufferAddr(mBuffer->getFd(), mBuffer->getBufferSize());
+        void* addr =
+            getDmaBufMapCache(mCameraId).acquire(mBuffer->getFd(), mBuffer->getBufferSize(),
+                                                 mBuffer.get());
+        CheckAndLogError(addr == nullptr, VOID_VALUE, "failed to map buffer %d",
+                         mBuffer->getIndex());
 
         mBuffer->getUserBuffer()->addr = addr;
         mDMAMapped = true;
+        syncDmaBuffer(true);
     }
 }
 
 CameraBufferMapper::~CameraBufferMapper() {
     if (mDMAMapped) {
-        CameraBuffer::unmapDmaBufferAddr(mBuffer->getBufferAddr(), mBuffer->getBufferSize());
+        syncDmaBuffer(false);
+        getDmaBufMapCache(mCameraId).release(mBuffer->getBufferAddr(), mBuffer->getBufferSize());
 
         mBuffer->getUserBuffer()->addr = nullptr;
     }
 }
 
+void CameraBufferMapper::releaseCache(int cameraId) {
+    CheckAndLogError((cameraId < 0) || (cameraId >= MAX_CAMERA_NUMBER), VOID_VALUE,
+                     "Invalid camera id %d", cameraId);
+    getDmaBufMapCache(cameraId).clear();
+}
+
+void CameraBufferMapper::releaseBuffer(const CameraBuffer* buffer) {
+    // The buffer doesn't know its camera, and is mapped by one camera at most
+    for (int i = 0; i < MAX_CAMERA_NUMBER; i++) {
+        getDmaBufMapCache(i).evictOwner(buffer);
+    }
+}
+
+void CameraBufferMapper::syncDmaBuffer(bool start) {
+    struct dma_buf_sync sync;
+    CLEAR(sync);
+    sync.flags = (start ? DMA_BUF_SYNC_START : DMA_BUF_SYNC_END) | DMA_BUF_SYNC_RW;
+
+    int ret = 0;
+    do {
+        ret = ioctl(mBuffer->getFd(), DMA_BUF_IOCTL_SYNC, &sync);
+    } while (ret != 0 && (errno == EINTR || errno == EAGAIN));
+    // Not all exporters support it, the mapping is coherent in that case
+    if (ret != 0) {
+        LOG2("%s: sync %s failed, %s", __func__, start ? "start" : "end", strerror(errno));
+    }
+}
+
 void* CameraBufferMapper::addr() {
     return mBuffer->getBufferAddr();
 }
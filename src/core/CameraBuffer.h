@@ -181,15 +181,29 @@ class CameraBuffer {
 typedef std::vector<std::shared_ptr<CameraBuffer> > CameraBufVector;
 typedef std::queue<std::shared_ptr<CameraBuffer> > CameraBufQ;
 
+/**
+ * CameraBufferMapper maps a DMA buffer to CPU for SW access during its lifetime.
+ *
+ * The mappings are cached and reused by the following mappers of the same DMA
+ * buffer, CPU access is bracketed with DMA_BUF_IOCTL_SYNC for coherency.
+ */
 class CameraBufferMapper {
  public:
-    explicit CameraBufferMapper(std::shared_ptr<CameraBuffer> buffer);
+    CameraBufferMapper(int cameraId, std::shared_ptr<CameraBuffer> buffer);
     ~CameraBufferMapper();
 
     void* addr();
     int size();
 
+    // Unmap the cached mappings of the camera, called when its buffers may be released
+    static void releaseCache(int cameraId);
+    // Unmap the cached mappings last used by the buffer, called when it is destroyed
+    static void releaseBuffer(const CameraBuffer* buffer);
+
  private:
+    void syncDmaBuffer(bool start);
+
+    int mCameraId;
     std::shared_ptr<CameraBuffer> mBuffer;
     bool mDMAMapped;
 };
@@ -98,19 +98,26 @@ CameraContext::CameraContext(int cameraId) :
     mCameraId(cameraId),
     mCurrentIndex(-1) {
     LOG1("<id%d> %s", cameraId, __func__);
+    static_assert((kIdIndexSize & kIdIndexMask) == 0, "kIdIndexSize must be power of two");
+    static_assert(kIdIndexSize > kContextSize, "kIdIndexSize is too small");
+
     for (int i = 0; i < kContextSize; i++) {
         mDataContext[i] = new DataContext(mCameraId);
     }
+    for (int type = 0; type < ID_TYPE_MAX; type++) {
+        for (int i = 0; i < kContextSize; i++) {
+            mContextIds[type][i].store(-1, std::memory_order_relaxed);
+        }
+        for (int i = 0; i < kIdIndexSize; i++) {
+            mIdIndex[type][i].store(-1, std::memory_order_relaxed);
+        }
+    }
     mAiqResultStorage = new AiqResultStorage(mCameraId);
 }
 
 CameraContext::~CameraContext() {
     LOG1("<id%d> %s", mCameraId, __func__);
 
-    mFnToDataContextMap.clear();
-    mSeqToDataContextMap.clear();
-    mCcaIdToDataContextMap.clear();
-
     delete mAiqResultStorage;
     for (int i = 0; i < kContextSize; i++) {
         delete mDataContext[i];
@@ -119,12 +126,10 @@ CameraContext::~CameraContext() {
 
 void CameraContext::reset() {
     LOG2("<id%d> %s", mCameraId, __func__);
-    mFnToDataContextMap.clear();
-    mSeqToDataContextMap.clear();
-    mCcaIdToDataContextMap.clear();
 
+    std::lock_guard<std::mutex> lock(mLock);
     for (int i = 0; i < kContextSize; i++) {
-        mDataContext[i]->reset();
+        eraseDataContextIds(i);
     }
 }
 
@@ -132,68 +137,124 @@ AiqResultStorage* CameraContext::getAiqResultStorage() {
     return mAiqResultStorage;
 }
 
-DataContext* CameraContext::acquireDataContext() {
-    LOG2("<id%d> %s", mCameraId, __func__);
+int CameraContext::getDataContextIndex(const DataContext* context) const {
+    for (int i = 0; i < kContextSize; i++) {
+        if (mDataContext[i] == context) {
+            return i;
+        }
+    }
 
-    std::lock_guard<std::mutex> lock(mLock);
-    mCurrentIndex += 1;
-    mCurrentIndex %= kContextSize;
+    return -1;
+}
+
+void CameraContext::setDataContextId(DataContextIdType type, int64_t id, int index) {
+    mContextIds[type][index].store(id, std::memory_order_release);
+    if (id >= 0) {
+        mIdIndex[type][id & kIdIndexMask].store(index, std::memory_order_release);
+    }
+}
+
+void CameraContext::eraseDataContextIds(int index) {
+    for (int type = 0; type < ID_TYPE_MAX; type++) {
+        mContextIds[type][index].store(-1, std::memory_order_release);
+    }
+    mDataContext[index]->reset();
+}
+
+int CameraContext::findDataContext(DataContextIdType type, int64_t id) const {
+    if (id < 0) {
+        return -1;
+    }
 
-    if (mDataContext[mCurrentIndex]->mSequence >= 0) {
-        eraseDataContextMap(mDataContext[mCurrentIndex]);
+    const int index = mIdIndex[type][id & kIdIndexMask].load(std::memory_order_acquire);
+    if ((index >= 0) && (mContextIds[type][index].load(std::memory_order_acquire) == id)) {
+        return index;
+    }
+
+    // The entry is taken by another id, search from the newest DataContext
+    const int currentIndex = mCurrentIndex.load(std::memory_order_acquire);
+    for (int i = 0; i < kContextSize; i++) {
+        const int tmpIdx = (currentIndex + kContextSize - i) % kContextSize;
+        if (mContextIds[type][tmpIdx].load(std::memory_order_acquire) == id) {
+            return tmpIdx;
+        }
     }
 
-    return mDataContext[mCurrentIndex];
+    return -1;
+}
+
+int CameraContext::advanceDataContext() {
+    const int index = (mCurrentIndex.load(std::memory_order_relaxed) + 1) % kContextSize;
+
+    // Evict the ids of the oldest DataContext before it is reused
+    eraseDataContextIds(index);
+    mCurrentIndex.store(index, std::memory_order_release);
+
+    return index;
+}
+
+DataContext* CameraContext::acquireDataContext() {
+    LOG2("<id%d> %s", mCameraId, __func__);
+
+    std::lock_guard<std::mutex> lock(mLock);
+    return mDataContext[advanceDataContext()];
 }
 
 void CameraContext::updateDataContextMapByFn(int64_t frameNumber, DataContext* context) {
     LOG2("<id%d:fn%ld> %s", mCameraId, frameNumber, __func__);
 
     std::lock_guard<std::mutex> lock(mLock);
+    const int index = getDataContextIndex(context);
+    CheckAndLogError(index < 0, VOID_VALUE, "Unknown context for fn %ld", frameNumber);
+
     context->setFrameNumber(frameNumber);
-    mFnToDataContextMap[frameNumber] = context;
+    setDataContextId(ID_FRAME_NUMBER, frameNumber, index);
 }
 
 DataContext* CameraContext::acquireDataContextByFn(int64_t frameNumber) {
     LOG2("<id%d:fn%ld> %s", mCameraId, frameNumber, __func__);
 
-    std::lock_guard<std::mutex> lock(mLock);
-    if (mFnToDataContextMap.find(frameNumber) != mFnToDataContextMap.end()) {
-        return mFnToDataContextMap[frameNumber];
+    const int index = findDataContext(ID_FRAME_NUMBER, frameNumber);
+    if (index >= 0) {
+        return mDataContext[index];
     }
 
     LOGW("Failed to find context for fn %ld", frameNumber);
     // if mCurrentIndex is -1, use 0 as default setting
-    return mDataContext[(mCurrentIndex == -1) ? 0 : mCurrentIndex];
+    const int currentIndex = mCurrentIndex.load(std::memory_order_acquire);
+    return mDataContext[(currentIndex == -1) ? 0 : currentIndex];
 }
 
 DataContext* CameraContext::getReprocessingDataContextBySeq(int64_t sequence) {
     LOG2("<id%d:seq%ld> %s", mCameraId, sequence, __func__);
 
     std::lock_guard<std::mutex> lock(mLock);
-    if(mSeqToDataContextMap.find(sequence) != mSeqToDataContextMap.end()) {
-        return mSeqToDataContextMap[sequence];
+    const int found = findDataContext(ID_SEQUENCE, sequence);
+    if (found >= 0) {
+        return mDataContext[found];
     }
 
     LOGW("Failed to find seq %ld for reprocessing", sequence);
 
     // create a DataContext for reprocessing with the nearest sequence
-    mCurrentIndex += 1;
-    mCurrentIndex %= kContextSize;
+    const int index = advanceDataContext();
 
-    if (mDataContext[mCurrentIndex]->mSequence >= 0) {
-        eraseDataContextMap(mDataContext[mCurrentIndex]);
+    int nearest = -1;
+    int64_t nearestSeq = -1;
+    for (int i = 0; i < kContextSize; i++) {
+        const int64_t seq = mContextIds[ID_SEQUENCE][i].load(std::memory_order_relaxed);
+        if ((seq >= 0) && (seq < sequence) && (seq > nearestSeq)) {
+            nearestSeq = seq;
+            nearest = i;
+        }
     }
-
-    auto it = mSeqToDataContextMap.upper_bound(sequence);
-    if (it != mSeqToDataContextMap.begin()) {
-        --it;
-        *mDataContext[mCurrentIndex] = *(it)->second;
+    if (nearest >= 0) {
+        *mDataContext[index] = *mDataContext[nearest];
     }
-    mDataContext[mCurrentIndex]->setSequence(sequence);
-    mSeqToDataContextMap[sequence] = mDataContext[mCurrentIndex];
+    mDataContext[index]->setSequence(sequence);
+    setDataContextId(ID_SEQUENCE, sequence, index);
 
-    return mDataContext[mCurrentIndex];
+    return mDataContext[index];
 }
 
 void CameraContext::storeGraphConfig(std::map<ConfigMode, std::shared_ptr<GraphConfig> > gcs) {
@@ -216,52 +277,53 @@ void CameraContext::updateDataContextMapBySeq(int64_t sequence, DataContext* con
     LOG2("<id%d:seq%ld> %s", mCameraId, sequence, __func__);
 
     std::lock_guard<std::mutex> lock(mLock);
+    const int index = getDataContextIndex(context);
+    CheckAndLogError(index < 0, VOID_VALUE, "Unknown context for seq %ld", sequence);
+
     context->setSequence(sequence);
-    mSeqToDataContextMap[sequence] = context;
+    setDataContextId(ID_SEQUENCE, sequence, index);
 }
 
 void CameraContext::updateDataContextMapByCcaId(int64_t ccaId, DataContext* context) {
     LOG2("<id%d:cca%ld> %s", mCameraId, ccaId, __func__);
 
     std::lock_guard<std::mutex> lock(mLock);
-    context->setCcaId(ccaId);
-    mCcaIdToDataContextMap[ccaId] = context;
-}
+    const int index = getDataContextIndex(context);
+    CheckAndLogError(index < 0, VOID_VALUE, "Unknown context for ccaId %ld", ccaId);
 
-void CameraContext::eraseDataContextMap(const DataContext* context) {
-    mFnToDataContextMap.erase(context->mFrameNumber);
-    mSeqToDataContextMap.erase(context->mSequence);
-    mCcaIdToDataContextMap.erase(context->mCcaId);
+    context->setCcaId(ccaId);
+    setDataContextId(ID_CCA_ID, ccaId, index);
 }
 
 const DataContext* CameraContext::getDataContextBySeq(int64_t sequence) {
     LOG2("<id%d:seq%ld> %s", mCameraId, sequence, __func__);
 
-    std::lock_guard<std::mutex> lock(mLock);
-    if(mSeqToDataContextMap.find(sequence) != mSeqToDataContextMap.end()) {
-        return mSeqToDataContextMap[sequence];
+    const int index = findDataContext(ID_SEQUENCE, sequence);
+    if (index >= 0) {
+        return mDataContext[index];
     }
 
     // search from the newest result
+    const int currentIndex = mCurrentIndex.load(std::memory_order_acquire);
     for (int i = 0; i < kContextSize; i++) {
-        const int tmpIdx = (mCurrentIndex + kContextSize - i) % kContextSize;
-        if ((mDataContext[tmpIdx]->mSequence >= 0) &&
-            (sequence >= mDataContext[tmpIdx]->mSequence)) {
+        const int tmpIdx = (currentIndex + kContextSize - i) % kContextSize;
+        const int64_t seq = mContextIds[ID_SEQUENCE][tmpIdx].load(std::memory_order_acquire);
+        if ((seq >= 0) && (sequence >= seq)) {
             return mDataContext[tmpIdx];
         }
     }
 
     LOGW("Failed to find context for seq %ld", sequence);
     // if mCurrentIndex is -1, use 0 as default setting
-    return mDataContext[(mCurrentIndex == -1) ? 0 : mCurrentIndex];
+    return mDataContext[(currentIndex == -1) ? 0 : currentIndex];
 }
 
 const DataContext* CameraContext::getDataContextByCcaId(int64_t ccaId) {
     LOG2("<id%d:cca%ld> %s", mCameraId, ccaId, __func__);
 
-    std::lock_guard<std::mutex> lock(mLock);
-    if (mCcaIdToDataContextMap.find(ccaId) != mCcaIdToDataContextMap.end()) {
-        return mCcaIdToDataContextMap[ccaId];
+    const int index = findDataContext(ID_CCA_ID, ccaId);
+    if (index >= 0) {
+        return mDataContext[index];
     }
 
     LOGW("Failed to find context for ccaId %ld", ccaId);
@@ -269,9 +331,7 @@ const DataContext* CameraContext::getDataContextByCcaId(int64_t ccaId) {
 }
 
 bool CameraContext::checkUserRequestBySeq(int64_t sequence) {
-    std::lock_guard<std::mutex> lock(mLock);
-    return mSeqToDataContextMap.find(sequence) == mSeqToDataContextMap.end() ? false : true;
+    return findDataContext(ID_SEQUENCE, sequence) >= 0;
 }
 
 }  // namespace icamera
-
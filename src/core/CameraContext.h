@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <memory>
@@ -144,13 +145,24 @@ class CameraContext {
     void updateDataContextMapBySeq(int64_t sequence, DataContext* context);
     void updateDataContextMapByCcaId(int64_t ccaId, DataContext* context);
 
-    // called runtimely after request has been handled
+    // called runtimely after request has been handled, the lookups don't take lock
     const DataContext* getDataContextBySeq(int64_t sequence);
     const DataContext* getDataContextByCcaId(int64_t ccaId);
     bool checkUserRequestBySeq(int64_t sequence);
 
  private:
-    void eraseDataContextMap(const DataContext* context);
+    enum DataContextIdType {
+        ID_FRAME_NUMBER = 0,
+        ID_SEQUENCE,
+        ID_CCA_ID,
+        ID_TYPE_MAX
+    };
+
+    int getDataContextIndex(const DataContext* context) const;
+    void setDataContextId(DataContextIdType type, int64_t id, int index);
+    void eraseDataContextIds(int index);
+    int findDataContext(DataContextIdType type, int64_t id) const;
+    int advanceDataContext();
 
  private:
     static std::map<int, CameraContext*> sInstances;
@@ -160,15 +172,24 @@ class CameraContext {
 
     int mCameraId;
 
-    int mCurrentIndex;  // range from 0 to MAX_SETTING_COUNT - 1;
+    // range from 0 to MAX_SETTING_COUNT - 1, written under mLock and read without lock
+    std::atomic<int> mCurrentIndex;
     DataContext* mDataContext[kContextSize];
 
     AiqResultStorage* mAiqResultStorage;
 
-    std::mutex mLock;  // Guard all Maps and public APIs
-    std::map<int64_t, DataContext*> mFnToDataContextMap;
-    std::map<int64_t, DataContext*> mSeqToDataContextMap;
-    std::map<int64_t, DataContext*> mCcaIdToDataContextMap;
+    std::mutex mLock;  // Serialize the writers of DataContext ids, and guard mGraphConfigMap
+
+    // Ids of each DataContext, -1 means not set. Written under mLock and read without lock.
+    std::atomic<int64_t> mContextIds[ID_TYPE_MAX][kContextSize];
+
+    // The entry of id is at (id & kIdIndexMask), it is the index of the DataContext the id was
+    // set to last. Readers verify it with mContextIds, and search mContextIds if the entry is
+    // taken by another id.
+    static const int kIdIndexSize = 64;  // Power of two, larger than kContextSize
+    static const int64_t kIdIndexMask = kIdIndexSize - 1;
+    std::atomic<int> mIdIndex[ID_TYPE_MAX][kIdIndexSize];
+
     std::map<ConfigMode, std::shared_ptr<GraphConfig> > mGraphConfigMap;
 }; /* CameraContext */
 
@@ -315,6 +315,8 @@ int CameraDevice::configure(stream_config_t* streamList) {
 
     // Release the resource created last time
     deleteStreams();
+    // The buffers of the old streams may not be used again
+    CameraBufferMapper::releaseCache(mCameraId);
     delete mProcessingUnit;
     mProcessingUnit = nullptr;
     mProducer->removeAllFrameAvailableListener();
@@ -793,6 +795,8 @@ int CameraDevice::stop() {
     }
 
     mScheduler->stop();
+    // The buffers may be freed after stop, don't hold their mappings
+    CameraBufferMapper::releaseCache(mCameraId);
     mState = DEVICE_STOP;
 
     return OK;
@@ -1002,7 +1006,7 @@ int CameraDevice::stopLocked() {
     return OK;
 }
 
-void CameraDevice::handleEvent(EventData eventData) {
+void CameraDevice::handleEvent(const EventData& eventData) {
     LOG2("%s, event type:%d", __func__, eventData.type);
 
     switch (eventData.type) {
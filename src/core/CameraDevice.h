@@ -205,7 +205,7 @@ class CameraDevice : public EventListener {
     // The second phase of qbuf(), done in RequestThread
     int handleQueueBuffer(int bufferNum, camera_buffer_t** ubuffer, int64_t sequence);
 
-    virtual void handleEvent(EventData eventData);
+    virtual void handleEvent(const EventData& eventData);
 
     int startLocked();
     int stopLocked();
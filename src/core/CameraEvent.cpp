@@ -18,10 +18,109 @@
 
 #include "CameraEvent.h"
 
+#include <inttypes.h>
+
+#include <algorithm>
+#include <atomic>
+
 #include "iutils/CameraLog.h"
 
 namespace icamera {
 
+EventListener::~EventListener() {
+    disableAsyncDelivery();
+}
+
+void EventListener::deliverEvent(const EventData& eventData) {
+    if (mEventQueue) {
+        mEventQueue->queue(eventData);
+    } else {
+        handleEvent(eventData);
+    }
+}
+
+void EventListener::enableAsyncDelivery(const std::string& name, size_t queueDepth) {
+    LOG1("@%s listener: %p, queue depth: %zu", __func__, this, queueDepth);
+    CheckAndLogError(mEventQueue != nullptr, VOID_VALUE, "%s: already enabled", __func__);
+
+    mEventQueue = std::unique_ptr<EventQueue>(new EventQueue(this, queueDepth));
+    mEventQueue->run(name, PRIORITY_NORMAL);
+}
+
+void EventListener::disableAsyncDelivery() {
+    if (!mEventQueue) return;
+
+    mEventQueue->stop();
+    mEventQueue.reset();
+}
+
+EventListener::EventQueue::EventQueue(EventListener* listener, size_t queueDepth)
+        : mListener(listener),
+          mQueueDepth(queueDepth),
+          mDropped(0U),
+          mRunning(true) {}
+
+void EventListener::EventQueue::queue(const EventData& eventData) {
+    AutoMutex l(mQueueLock);
+    if (mEvents.size() >= mQueueDepth) {
+        mDropped++;
+        LOGW("%s: queue of listener %p is full, drop event %d, %" PRIu64 " dropped", __func__,
+             mListener, eventData.type, mDropped);
+        return;
+    }
+
+    mEvents.push_back(eventData);
+    mQueueSignal.signal();
+}
+
+void EventListener::EventQueue::stop() {
+    exit();
+    {
+        AutoMutex l(mQueueLock);
+        mRunning = false;
+        mQueueSignal.signal();
+    }
+    wait();
+}
+
+bool EventListener::EventQueue::threadLoop() {
+    EventData eventData;
+    {
+        ConditionLock lock(mQueueLock);
+        while (mRunning && mEvents.empty()) {
+            mQueueSignal.wait(lock);
+        }
+        if (!mRunning) return false;
+
+        eventData = mEvents.front();
+        mEvents.pop_front();
+    }
+
+    mListener->handleEvent(eventData);
+    return true;
+}
+
+// The event sources which are dispatching in the current thread, the innermost is the last
+static thread_local std::vector<const EventSource*> gDispatchingSources;
+
+EventSource::EventSource() {
+#ifndef LIBCAMERA_BUILD
+    mRemoveWaiters = 0;
+#endif
+}
+
+void EventSource::replaceListeners(EventType eventType,
+                                   const std::shared_ptr<const ListenerList>& list) {
+    std::shared_ptr<const ListenerList> old = std::atomic_exchange(&mListeners[eventType], list);
+
+    mRetiredListeners.erase(std::remove_if(mRetiredListeners.begin(), mRetiredListeners.end(),
+                                           [](const std::weak_ptr<const ListenerList>& retired) {
+                                               return retired.expired();
+                                           }),
+                            mRetiredListeners.end());
+    if (old) mRetiredListeners.push_back(old);
+}
+
 void EventSource::registerListener(EventType eventType, EventListener* eventListener) {
     LOG1("@%s eventType: %d, listener: %p", __func__, eventType, eventListener);
 
@@ -29,54 +128,101 @@ void EventSource::registerListener(EventType eventType, EventListener* eventList
                      "%s: event listener is nullptr, skip registration.", __func__);
 
 #ifdef LIBCAMERA_BUILD
-    mNotifier[eventType].connect(eventListener, &EventListener::handleEvent);
+    mNotifier[eventType].connect(eventListener, &EventListener::deliverEvent);
 #else
     AutoMutex l(mListenersLock);
 
-    std::set<EventListener*> listenersOfType;
-    if (mListeners.find(eventType) != mListeners.end()) {
-        listenersOfType = mListeners[eventType];
-    }
+    std::shared_ptr<const ListenerList> listenersOfType = std::atomic_load(&mListeners[eventType]);
+    std::shared_ptr<ListenerList> newList =
+        listenersOfType ? std::make_shared<ListenerList>(*listenersOfType)
+                        : std::make_shared<ListenerList>();
+    if (std::find(newList->begin(), newList->end(), eventListener) != newList->end()) return;
 
-    listenersOfType.insert(eventListener);
-    mListeners[eventType] = listenersOfType;
+    newList->push_back(eventListener);
+    replaceListeners(eventType, newList);
 #endif
 }
 
 void EventSource::removeListener(EventType eventType, EventListener* eventListener) {
     LOG1("@%s eventType: %d, listener: %p", __func__, eventType, eventListener);
 #ifdef LIBCAMERA_BUILD
-    mNotifier[eventType].disconnect(eventListener, &EventListener::handleEvent);
+    mNotifier[eventType].disconnect(eventListener, &EventListener::deliverEvent);
 #else
-    AutoMutex l(mListenersLock);
+    ConditionLock lock(mListenersLock);
 
-    if (mListeners.find(eventType) == mListeners.end()) {
+    std::shared_ptr<const ListenerList> listenersOfType = std::atomic_load(&mListeners[eventType]);
+    if (!listenersOfType) {
         LOG1("%s: no listener found for event type %d", __func__, eventType);
         return;
     }
 
-    std::set<EventListener*> listenersOfType = mListeners[eventType];
-    listenersOfType.erase(eventListener);
-    mListeners[eventType] = listenersOfType;
+    std::shared_ptr<ListenerList> newList = std::make_shared<ListenerList>(*listenersOfType);
+    newList->erase(std::remove(newList->begin(), newList->end(), eventListener), newList->end());
+    // Don't hold the snapshot which is going to be waited for
+    listenersOfType.reset();
+    replaceListeners(eventType, newList);
+
+    /**
+     * The listener may be destroyed once it's removed, so wait for the dispatching with
+     * the replaced snapshots to finish.
+     * Don't wait when it's called by handleEvent of this source, the listener is still
+     * running in this case, and other threads may be waiting for this dispatching as well.
+     */
+    if (std::find(gDispatchingSources.begin(), gDispatchingSources.end(), this) !=
+        gDispatchingSources.end()) {
+        return;
+    }
+
+    // The replaced snapshots which still have the listener
+    std::vector<std::weak_ptr<const ListenerList>> retired;
+    for (const auto& weakList : mRetiredListeners) {
+        std::shared_ptr<const ListenerList> list = weakList.lock();
+        if (list && (std::find(list->begin(), list->end(), eventListener) != list->end())) {
+            retired.push_back(weakList);
+        }
+    }
+    if (retired.empty()) return;
+
+    // Pairs with the fence in notifyListeners, either side sees the other one
+    mRemoveWaiters++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (const auto& list : retired) {
+        while (!list.expired()) {
+            mDispatchDone.wait(lock);
+        }
+    }
+    mRemoveWaiters--;
+    // expired() doesn't order the memory, see the last accesses of the dispatching threads
+    std::atomic_thread_fence(std::memory_order_acquire);
 #endif
 }
 
-void EventSource::notifyListeners(EventData eventData) {
+void EventSource::notifyListeners(const EventData& eventData) {
     LOG2("@%s eventType: %d", __func__, eventData.type);
 #ifdef LIBCAMERA_BUILD
     mNotifier[eventData.type].emit(eventData);
 #else
-    AutoMutex l(mListenersLock);
-
-    if (mListeners.find(eventData.type) == mListeners.end()) {
+    std::shared_ptr<const ListenerList> listenersOfType =
+        std::atomic_load(&mListeners[eventData.type]);
+    if (!listenersOfType || listenersOfType->empty()) {
         LOG2("%s: no listener found for event type %d", __func__, eventData.type);
         return;
     }
 
-    for (auto listener : mListeners[eventData.type]) {
+    gDispatchingSources.push_back(this);
+    for (auto listener : *listenersOfType) {
         LOG2("%s: send event data to listener %p for event type %d", __func__, listener,
              eventData.type);
-        listener->handleEvent(eventData);
+        listener->deliverEvent(eventData);
+    }
+    gDispatchingSources.pop_back();
+
+    // Wake up removeListener if it waits for this snapshot
+    listenersOfType.reset();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mRemoveWaiters.load(std::memory_order_relaxed) > 0) {
+        AutoMutex l(mListenersLock);
+        mDispatchDone.broadcast();
     }
 #endif
 }
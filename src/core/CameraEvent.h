@@ -16,8 +16,11 @@
 
 #pragma once
 
-#include <map>
-#include <set>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
 #ifdef LIBCAMERA_BUILD
 #include <libcamera/base/signal.h>
 #endif
@@ -29,27 +32,82 @@ namespace icamera {
 class EventListener {
  public:
     EventListener() {}
-    virtual ~EventListener() {}
-    virtual void handleEvent(EventData eventData) {}
+    virtual ~EventListener();
+    virtual void handleEvent(const EventData& eventData) {}
+
+    /**
+     * Called by EventSource, handle the event in the calling thread, or queue it
+     * when the asynchronous delivery is enabled.
+     */
+    void deliverEvent(const EventData& eventData);
+
+ protected:
+    /**
+     * Handle the events in a thread of this listener, so a slow handleEvent doesn't
+     * block the event sources and the other listeners.
+     * Up to queueDepth events are queued, the newer events are dropped and counted.
+     * It must be enabled before registering the listener, and disabled in the destructor
+     * of the derived class after the listener is removed from the event sources.
+     */
+    void enableAsyncDelivery(const std::string& name, size_t queueDepth);
+    void disableAsyncDelivery();
+
+ private:
+    class EventQueue : public Thread {
+     public:
+        EventQueue(EventListener* listener, size_t queueDepth);
+        ~EventQueue() {}
+
+        void queue(const EventData& eventData);
+        void stop();
+
+     private:
+        bool threadLoop() override;
+
+        EventListener* mListener;
+        size_t mQueueDepth;
+
+        Mutex mQueueLock;  // protect the members below
+        Condition mQueueSignal;
+        std::deque<EventData> mEvents;
+        uint64_t mDropped;
+        bool mRunning;
+    };
+
+    std::unique_ptr<EventQueue> mEventQueue;
 };
 
 class EventSource {
  private:
 #ifdef LIBCAMERA_BUILD
-    libcamera::Signal<EventData> mNotifier[EVENT_TYPE_MAX];
+    libcamera::Signal<const EventData&> mNotifier[EVENT_TYPE_MAX];
 #else
-    std::map<EventType, std::set<EventListener*>> mListeners;
+    typedef std::vector<EventListener*> ListenerList;
 
-    // Guard for EventSource public API to protect mListeners.
+    /**
+     * notifyListeners reads the snapshot of the listeners without any lock,
+     * register/remove replace the snapshot of one event type.
+     * Access them with std::atomic_load/std::atomic_store.
+     */
+    std::shared_ptr<const ListenerList> mListeners[EVENT_TYPE_MAX];
+
+    // Serialize the register/remove, and protect mRetiredListeners
     Mutex mListenersLock;
+    // The replaced snapshots which may be still used by notifyListeners
+    std::vector<std::weak_ptr<const ListenerList>> mRetiredListeners;
+    // Signaled with mListenersLock when a dispatching finishes and mRemoveWaiters isn't 0
+    Condition mDispatchDone;
+    std::atomic<int> mRemoveWaiters;
+
+    void replaceListeners(EventType eventType, const std::shared_ptr<const ListenerList>& list);
 #endif
 
  public:
-    EventSource() {}
+    EventSource();
     virtual ~EventSource() {}
     virtual void registerListener(EventType eventType, EventListener* eventListener);
     virtual void removeListener(EventType eventType, EventListener* eventListener);
-    virtual void notifyListeners(EventData eventData);
+    virtual void notifyListeners(const EventData& eventData);
 };
 
 }  // namespace icamera
@@ -25,6 +25,7 @@
 #include "PlatformData.h"
 #include "iutils/CameraDump.h"
 #include "iutils/CameraLog.h"
+#include "iutils/PerfStats.h"
 #include "iutils/Utils.h"
 #include "StageDescriptor.h"
 
@@ -425,6 +426,7 @@ int CaptureUnit::poll() {
         return OK;
     }
 
+    PERF_STAGE_STATS(mCameraId, PERF_STAGE_CAPTURE_UNIT);
     for (const auto& readyDevice : readyDevices) {
         for (auto device : mDevices) {
             if (device->getV4l2Device() == readyDevice) {
@@ -26,6 +26,7 @@
 #include "V4l2DeviceFactory.h"
 #include "iutils/CameraDump.h"
 #include "iutils/CameraLog.h"
+#include "iutils/FrameTimeline.h"
 #include "iutils/Utils.h"
 #include "linux/ipu-isys.h"
 
@@ -198,6 +199,7 @@ int DeviceBase::dequeueBuffer() {
 
     int ret = OK;
     const int targetIndex = camBuffer->getIndex();
+    const nsecs_t grabStart = FrameTimeline::isEnabled() ? CameraUtils::systemTime() : 0;
 
     V4L2Buffer& vbuf = camBuffer->getV4L2Buffer();
     int actualIndex = mDevice->GrabFrame(&vbuf);
@@ -214,6 +216,11 @@ int DeviceBase::dequeueBuffer() {
     PERF_CAMERA_ATRACE_PARAM3("grabFrame SeqID", camBuffer->getSequence(), "csi2_port",
                               camBuffer->getCsi2Port(), "virtual_channel",
                               camBuffer->getVirtualChannel());
+    if (grabStart != 0) {
+        FrameTimeline::record(mCameraId, TIMELINE_ISYS_DQ, camBuffer->getSequence(), grabStart,
+                              CameraUtils::systemTime() - grabStart,
+                              static_cast<uint8_t>(camBuffer->getCsi2Port()));
+    }
     (void)onDequeueBuffer(camBuffer);
 
     // Skip initial frames if needed.
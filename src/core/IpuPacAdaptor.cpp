@@ -27,6 +27,7 @@
 #include "iutils/Utils.h"
 #include "iutils/CameraLog.h"
 #include "iutils/CameraDump.h"
+#include "iutils/FrameTimeline.h"
 #include "CameraContext.h"
 #include "AiqResultStorage.h"
 #include "PlatformData.h"
@@ -54,13 +55,15 @@ int IpuPacAdaptor::init(std::vector<int> streamIds) {
     mIntelCca = IntelCca::getInstance(mCameraId, TUNING_MODE_VIDEO);
     CheckAndLogError(mIntelCca == nullptr, UNKNOWN_ERROR, "%s, mIntelCca is nullptr", __func__);
 
-    mStreamIdToInputParams.clear();
+    mPacStreams.clear();
     for (const auto& id : streamIds) {
         cca::cca_pal_input_params* p = static_cast<cca::cca_pal_input_params*>(
                 mIntelCca->allocMem(id, "param", id, sizeof(cca::cca_pal_input_params)));
         CheckAndLogError(p == nullptr, NO_MEMORY, "Cannot alloc memory for input parameter!");
         CLEAR(*p);
-        mStreamIdToInputParams[id] = p;
+        std::shared_ptr<PacStream> pacStream = std::make_shared<PacStream>();
+        pacStream->inputParams = p;
+        mPacStreams[id] = pacStream;
     }
 
     {
@@ -74,7 +77,9 @@ int IpuPacAdaptor::init(std::vector<int> streamIds) {
 }
 
 int IpuPacAdaptor::reinitAic(const int32_t aicId) {
-    AutoMutex l(mPacAdaptorLock);
+    std::shared_ptr<PacStream> pacStream = getPacStream(aicId);
+    // The stream not in init(), like yuv reprocessing, is serialized by mPacAdaptorLock
+    ConditionLock l((pacStream != nullptr) ? pacStream->lock : mPacAdaptorLock);
     CheckAndLogError(mIntelCca == nullptr, UNKNOWN_ERROR, "%s, mIntelCca is nullptr", __func__);
 
     const ia_err iaErr = mIntelCca->reinitAic(aicId);
@@ -88,10 +93,14 @@ int IpuPacAdaptor::deinit() {
     LOG1("<id%d>@%s", mCameraId, __func__);
 
     AutoMutex l(mPacAdaptorLock);
-    for (auto& it : mStreamIdToInputParams) {
-        mIntelCca->freeMem(it.second);
+    for (auto& it : mPacStreams) {
+        // Wait for the running AIC of the stream
+        AutoMutex streamLock(it.second->lock);
+        mIntelCca->freeMem(it.second->inputParams);
+        it.second->inputParams = nullptr;
+        it.second->active = false;
     }
-    mStreamIdToInputParams.clear();
+    mPacStreams.clear();
 
     {
         AutoMutex l(mIpuParamLock);
@@ -107,9 +116,12 @@ status_t IpuPacAdaptor::pacConfig(int streamId, const cca::cca_aic_config& aicCo
                                   const cca::cca_aic_kernel_offset& kernelOffset,
                                   uint32_t* offsetPtr, cca::cca_aic_terminal_config* termCfg,
                                   const int32_t* statsBufToTermIds) {
-    AutoMutex l(mPacAdaptorLock);
+    std::shared_ptr<PacStream> pacStream = getPacStream(streamId);
+    // The stream not in init(), like yuv reprocessing, is serialized by mPacAdaptorLock
+    ConditionLock l((pacStream != nullptr) ? pacStream->lock : mPacAdaptorLock);
     CheckAndLogError(mIntelCca == nullptr, UNKNOWN_ERROR, "%s, mIntelCca is nullptr", __func__);
-    CheckAndLogError(mPacAdaptorState != PAC_ADAPTOR_INIT,
+    CheckAndLogError((pacStream != nullptr) ? !pacStream->active
+                                            : (mPacAdaptorState != PAC_ADAPTOR_INIT),
                      INVALID_OPERATION, "%s, wrong state %d", __func__, mPacAdaptorState);
 
     LOG2("@%s, cb number: %u, streamId: %d", __func__, termCfg->cb_num, streamId);
@@ -127,7 +139,20 @@ status_t IpuPacAdaptor::pacConfig(int streamId, const cca::cca_aic_config& aicCo
 
 void IpuPacAdaptor::clearAicResult() {
     AutoMutex l(mPacAdaptorLock);
-    mPacRunHistMap.clear();
+    for (auto& it : mPacStreams) {
+        AutoMutex streamLock(it.second->lock);
+        it.second->runHistMap.clear();
+    }
+}
+
+std::shared_ptr<IpuPacAdaptor::PacStream> IpuPacAdaptor::getPacStream(int streamId) {
+    AutoMutex l(mPacAdaptorLock);
+    if ((mPacAdaptorState != PAC_ADAPTOR_INIT) || (mIntelCca == nullptr)) {
+        return nullptr;
+    }
+
+    auto it = mPacStreams.find(streamId);
+    return (it != mPacStreams.end()) ? it->second : nullptr;
 }
 
 void* IpuPacAdaptor::allocateBuffer(int streamId, uint8_t contextId,
@@ -184,9 +209,12 @@ status_t IpuPacAdaptor::setPacTerminalData(int streamId, uint8_t contextId,
 }
 
 status_t IpuPacAdaptor::registerBuffer(int streamId, const cca::cca_aic_terminal_config& termCfg) {
-    AutoMutex l(mPacAdaptorLock);
+    std::shared_ptr<PacStream> pacStream = getPacStream(streamId);
+    // The stream not in init(), like yuv reprocessing, is serialized by mPacAdaptorLock
+    ConditionLock l((pacStream != nullptr) ? pacStream->lock : mPacAdaptorLock);
     CheckAndLogError(mIntelCca == nullptr, UNKNOWN_ERROR, "%s, mIntelCca is nullptr", __func__);
-    CheckAndLogError(mPacAdaptorState != PAC_ADAPTOR_INIT,
+    CheckAndLogError((pacStream != nullptr) ? !pacStream->active
+                                            : (mPacAdaptorState != PAC_ADAPTOR_INIT),
                      INVALID_OPERATION, "%s, wrong state %d", __func__, mPacAdaptorState);
 
     LOG2("@%s, cb number: %u, streamId: %d", __func__, termCfg.cb_num, streamId);
@@ -202,24 +230,31 @@ status_t IpuPacAdaptor::registerBuffer(int streamId, const cca::cca_aic_terminal
 }
 
 status_t IpuPacAdaptor::storeTerminalResult(int64_t sequence, int32_t streamId) {
-    AutoMutex l(mIpuParamLock);
+    // Copy the terminals of the stream, the aic buffers are got without the param lock
+    std::map<uint8_t, PacTerminalBufMap> streamTermData;
+    {
+        AutoMutex l(mIpuParamLock);
+        for (auto& data : mTerminalData) {
+            if (data.first.first == streamId) {
+                streamTermData[data.first.second] = data.second;
+            }
+        }
+    }
 
     // get the aic buffer of all CBs for current streamId
-    for (auto& data : mTerminalData) {
-        if (data.first.first != streamId) {
-            continue;
-        }
+    for (auto& data : streamTermData) {
+        const uint8_t contextId = data.first;
 
         // According to the PacTerminalBufMap of streamId and contextId to get aic buffer
         PacTerminalBufMap& cbTermData = data.second;
         cca::cca_aic_terminal_config ccaTermConfig = {};
         ccaTermConfig.cb_num = 1U;
         cca::cca_cb_termal_buf* ccaTermBufs = &(ccaTermConfig.cb_terminal_buf[0]);
-        ccaTermBufs->group_id = data.first.second;
+        ccaTermBufs->group_id = contextId;
         ccaTermBufs->num_terminal = cbTermData.size();
         CheckAndLogError(cbTermData.size() > cca::MAX_PG_TERMINAL_NUM, UNKNOWN_ERROR,
                          "%s, there are too many terminals for streamId: %d, contextId: %u",
-                         __func__, streamId, data.first.second);
+                         __func__, streamId, contextId);
 
         int index = 0;
         aic::IaAicBuffer payloadBufs[cca::MAX_PG_TERMINAL_NUM] = {};
@@ -231,14 +266,13 @@ status_t IpuPacAdaptor::storeTerminalResult(int64_t sequence, int32_t streamId)
         }
 
         LOG2("%s, get the aic buffer for streamId: %d, contextId: %u, terminal num: %d",
-             __func__, streamId, data.first.second, index);
+             __func__, streamId, contextId, index);
         const ia_err iaErr = mIntelCca->getAicBuf(ccaTermConfig, streamId);
         CheckAndLogError(iaErr != ia_err_none, UNKNOWN_ERROR,
                          "<seq:%ld>%s, Failed to getAicBuf. streamId: %d, contextId: %d",
-                         sequence, __func__, streamId, data.first.second);
+                         sequence, __func__, streamId, contextId);
 
         index = 0;
-        std::pair<int, uint8_t> cbInstance = std::make_pair(streamId, data.first.second);
         for (auto& buf : cbTermData) {
             int aicDataId = payloadBufs[index].id;
             const size_t aicDataSize = payloadBufs[index].size;
@@ -252,24 +286,13 @@ status_t IpuPacAdaptor::storeTerminalResult(int64_t sequence, int32_t streamId)
         }
 
         // store terminal buffers with sequence id into mTerminalResult
-        std::vector<CBTerminalResult>& cbTermResult = mTerminalResult[cbInstance];
-        if (cbTermResult.size() > MAX_SETTING_COUNT) {
-            cbTermResult.erase(cbTermResult.begin());
-        }
-
-        // Only update data if find same sequence id
-        size_t i = 0U;
-        for ( ; i < cbTermResult.size(); ++i) {
-            if (cbTermResult[i].sequence == sequence) {
-                break;
-            }
-        }
-
-        if (i != cbTermResult.size()) {
-            cbTermResult[i].termResult = cbTermData;
-        } else {
-            CBTerminalResult result = {sequence, cbTermData};
-            cbTermResult.push_back(result);
+        AutoMutex l(mIpuParamLock);
+        CBTerminalResultRing& cbTermResult = mTerminalResult[std::make_pair(streamId, contextId)];
+        CBTerminalResult& result = cbTermResult.at(sequence);
+        result.sequence = sequence;
+        result.termResult.swap(cbTermData);
+        if (sequence > cbTermResult.latestSequence) {
+            cbTermResult.latestSequence = sequence;
         }
     }
 
@@ -323,13 +346,16 @@ void IpuPacAdaptor::applyMediaFormat(const AiqResult* aiqResult,
 
 status_t IpuPacAdaptor::runAIC(const IspSettings* ispSettings,
                                int64_t settingSequence, int32_t streamId) {
-    AutoMutex l(mPacAdaptorLock);
-    CheckAndLogError(mIntelCca == nullptr, UNKNOWN_ERROR, "%s, mIntelCca is nullptr", __func__);
-    CheckAndLogError(mPacAdaptorState != PAC_ADAPTOR_INIT,
-                     INVALID_OPERATION, "%s, wrong state %d", __func__, mPacAdaptorState);
-
-    std::pair<int, int64_t> pacItem = std::make_pair(streamId, settingSequence);
-    if (mPacRunHistMap.find(pacItem) != mPacRunHistMap.end()) {
+    std::shared_ptr<PacStream> pacStream = getPacStream(streamId);
+    CheckAndLogError(pacStream == nullptr, INVALID_OPERATION,
+                     "%s, no stream %d or wrong state", __func__, streamId);
+    AutoMutex streamLock(pacStream->lock);
+    CheckAndLogError(!pacStream->active, INVALID_OPERATION,
+                     "%s, stream %d is deinited", __func__, streamId);
+    FRAME_TIMELINE_SCOPE(mCameraId, TIMELINE_PAC_RUN, settingSequence,
+                         static_cast<uint8_t>(streamId));
+
+    if (pacStream->runHistMap.find(settingSequence) != pacStream->runHistMap.end()) {
         LOG1("%s, streamId %d, sequence %ld had run before", __func__, streamId, settingSequence);
         return OK;
     }
@@ -344,14 +370,18 @@ status_t IpuPacAdaptor::runAIC(const IspSettings* ispSettings,
     LOG2("<id%d:streamId:%d>@%s: aiq result id %ld", mCameraId, streamId, __func__,
          aiqResults->mFrameId);
 
-    cca::cca_pal_input_params* inputParams = mStreamIdToInputParams[streamId];
+    cca::cca_pal_input_params* inputParams = pacStream->inputParams;
     inputParams->seq_id = settingSequence;
     inputParams->stream_id = streamId;
 
+    // Hold the GBCE results in case the 3A thread replaces them in the meantime
+    const std::shared_ptr<const cca::cca_gbce_params> gbceResults =
+        aiqResults->mGbceResults.get();
+
     bool useLinearGamma = false;
     applyMediaFormat(aiqResults, &inputParams->media_format, &useLinearGamma, settingSequence);
     LOG2("%s, media format: 0x%x, gamma lut size: %d", __func__,
-         inputParams->media_format, aiqResults->mGbceResults.gamma_lut_size);
+         inputParams->media_format, gbceResults->gamma_lut_size);
 
     if (STILL_STREAM_ID == streamId) {
         inputParams->force_lsc_update = true;
@@ -385,8 +415,8 @@ status_t IpuPacAdaptor::runAIC(const IspSettings* ispSettings,
     }
 
     inputParams->manual_pa_setting = aiqResults->mPaResults;
-    if (aiqResults->mGbceResults.have_manual_settings == true) {
-        inputParams->manual_gbce_setting = aiqResults->mGbceResults;
+    if (gbceResults->have_manual_settings == true) {
+        inputParams->manual_gbce_setting = *gbceResults;
         if (useLinearGamma) {
             inputParams->manual_gbce_setting.gamma_lut_size = 0U;
         }
@@ -434,7 +464,7 @@ status_t IpuPacAdaptor::runAIC(const IspSettings* ispSettings,
 
     (void)storeTerminalResult(settingSequence, streamId);
 
-    mPacRunHistMap[pacItem] = false;
+    pacStream->runHistMap[settingSequence] = false;
 
     return OK;
 }
@@ -442,9 +472,12 @@ status_t IpuPacAdaptor::runAIC(const IspSettings* ispSettings,
 status_t IpuPacAdaptor::updateResolutionSettings(int streamId,
                                                  const cca::cca_aic_config& aicConfig,
                                                  bool isKeyResChanged) {
-    AutoMutex l(mPacAdaptorLock);
+    std::shared_ptr<PacStream> pacStream = getPacStream(streamId);
+    // The stream not in init(), like yuv reprocessing, is serialized by mPacAdaptorLock
+    ConditionLock l((pacStream != nullptr) ? pacStream->lock : mPacAdaptorLock);
     CheckAndLogError(mIntelCca == nullptr, UNKNOWN_ERROR, "%s, mIntelCca is nullptr", __func__);
-    CheckAndLogError(mPacAdaptorState != PAC_ADAPTOR_INIT,
+    CheckAndLogError((pacStream != nullptr) ? !pacStream->active
+                                            : (mPacAdaptorState != PAC_ADAPTOR_INIT),
                      INVALID_OPERATION, "%s, wrong state %d", __func__, mPacAdaptorState);
 
     const ia_err iaErr = mIntelCca->updateConfigurationResolutions(aicConfig, streamId,
@@ -466,17 +499,17 @@ status_t IpuPacAdaptor::getAllBuffers(int streamId, uint8_t contextId, int64_t s
         return BAD_INDEX;
     }
 
-    std::vector<CBTerminalResult>& cbTermResult = mTerminalResult[cbInstance];
+    CBTerminalResultRing& cbTermResult = mTerminalResult[cbInstance];
     // Get the latest result when sequence is -1
     if (sequenceId == -1) {
-        bufferMap = cbTermResult.back().termResult;
-        return OK;
-    } else {
-        for (size_t i = 0U; i < cbTermResult.size(); ++i) {
-            if (cbTermResult[i].sequence == sequenceId) {
-                bufferMap = cbTermResult[i].termResult;
-                return OK;
-            }
+        sequenceId = cbTermResult.latestSequence;
+    }
+
+    if (sequenceId >= 0) {
+        const CBTerminalResult& result = cbTermResult.at(sequenceId);
+        if (result.sequence == sequenceId) {
+            bufferMap = result.termResult;
+            return OK;
         }
     }
 
@@ -503,21 +536,30 @@ bool IpuPacAdaptor::isStatsUsed(int streamId, int64_t sequence) {
 
 status_t IpuPacAdaptor::decodeStats(int streamId, uint8_t contextId, int64_t sequenceId,
                                     unsigned long long timestamp) {
-    AutoMutex l(mPacAdaptorLock);
-    CheckAndLogError(mIntelCca == nullptr, UNKNOWN_ERROR, "%s, mIntelCca is nullptr", __func__);
-    CheckAndLogError(mPacAdaptorState != PAC_ADAPTOR_INIT,
-                     INVALID_OPERATION, "%s, wrong state %d", __func__, mPacAdaptorState);
+    std::shared_ptr<PacStream> pacStream = getPacStream(streamId);
+    if (pacStream == nullptr) {
+        LOG1("%s, no stream %d found", __func__, streamId);
+        return OK;
+    }
+    AutoMutex streamLock(pacStream->lock);
+    CheckAndLogError(!pacStream->active, INVALID_OPERATION,
+                     "%s, stream %d is deinited", __func__, streamId);
 
-    std::pair<int, int64_t> pacItem = std::make_pair(streamId, sequenceId);
-    if (mPacRunHistMap.find(pacItem) == mPacRunHistMap.end()) {
+    std::map<int64_t, bool>& runHistMap = pacStream->runHistMap;
+    auto histItem = runHistMap.find(sequenceId);
+    if (histItem == runHistMap.end()) {
         LOG1("%s, no stream %d and sequence %ld found", __func__, streamId, sequenceId);
         return OK;
-    } else if (mPacRunHistMap[pacItem]) {
+    } else if (histItem->second) {
         LOG1("%s, stream %d and sequence %ld decoded", __func__, streamId, sequenceId);
         return OK;
     }
 
-    const bool statsUsed = isStatsUsed(streamId, sequenceId);
+    bool statsUsed = false;
+    {
+        AutoMutex l(mStatsLock);
+        statsUsed = isStatsUsed(streamId, sequenceId);
+    }
 
     cca::cca_out_stats outStatsTemp;
     cca::cca_out_stats* outStats = &outStatsTemp;
@@ -538,6 +580,7 @@ status_t IpuPacAdaptor::decodeStats(int streamId, uint8_t contextId, int64_t seq
 
     const ia_err iaErr = mIntelCca->decodeStats(contextId, sequenceId, streamId, outStats);
     if (iaErr == ia_err::ia_err_none) {
+        AutoMutex l(mStatsLock);
         if (statsUsed) {
             AiqStatistics* aiqStatistics = mAiqResultStorage->acquireAiqStatistics();
             aiqStatistics->mSequence = sequenceId;
@@ -552,11 +595,11 @@ status_t IpuPacAdaptor::decodeStats(int streamId, uint8_t contextId, int64_t seq
              __func__, streamId, contextId);
     }
 
-    mPacRunHistMap[pacItem] = true;
-    if (mPacRunHistMap.size() >= MAX_CACHE_PAC_HIST) {
-        for (auto iter = mPacRunHistMap.begin(); iter != mPacRunHistMap.end(); iter++) {
+    histItem->second = true;
+    if (runHistMap.size() >= MAX_CACHE_PAC_HIST) {
+        for (auto iter = runHistMap.begin(); iter != runHistMap.end(); iter++) {
             if (iter->second) {
-                mPacRunHistMap.erase(iter);
+                runHistMap.erase(iter);
                 break;
             }
         }
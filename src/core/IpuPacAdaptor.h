@@ -74,8 +74,11 @@ public:
                          unsigned long long timestamp);
 
  private:
+    struct PacStream;
+
     void* allocateBufferL(int streamId, uint8_t contextId, uint32_t termId, size_t size);
     void releaseBufferL(int streamId, uint8_t contextId, uint32_t termId, void* addr);
+    std::shared_ptr<PacStream> getPacStream(int streamId);
     status_t storeTerminalResult(int64_t sequence, int32_t streamId);
     void applyMediaFormat(const AiqResult* aiqResult,
                           ia_media_format* mediaFormat, bool* useLinearGamma,
@@ -99,25 +102,58 @@ public:
         PacTerminalBufMap termResult;
     } CBTerminalResult;
 
+    // The terminal results of one CB, the result of sequence is in results[sequence % size]
+    struct CBTerminalResultRing {
+        int64_t latestSequence;
+        CBTerminalResult results[MAX_SETTING_COUNT];
+
+        CBTerminalResultRing() : latestSequence(-1) {
+            for (auto& result : results) {
+                result.sequence = -1;
+            }
+        }
+        CBTerminalResult& at(int64_t sequence) {
+            return results[static_cast<uint64_t>(sequence) % MAX_SETTING_COUNT];
+        }
+    };
+
+    static const uint8_t MAX_CACHE_PAC_HIST = 6;
+
+    /**
+     * The AIC state of one stream. The streams run AIC and decode stats concurrently,
+     * each of them is serialized by its own lock.
+     */
+    struct PacStream {
+        // Guard for the AIC calls of the stream
+        Mutex lock;
+        // false after deinit, the stream must not be used anymore
+        bool active;
+        cca::cca_pal_input_params* inputParams;
+        // key: sequence --> bool (true means stats decoded)
+        std::map<int64_t, bool> runHistMap;
+
+        PacStream() : active(true), inputParams(nullptr) {}
+    };
+
     int mCameraId;
     int memIndex = 0;
 
-    //Guard for IpuPacAdaptor public API
+    // Guard for the state, the streams and the buffer APIs. Never held while running AIC.
     Mutex mPacAdaptorLock;
     IntelCca *mIntelCca;
     AiqResultStorage* mAiqResultStorage;
+    // key: streamId, only changed in init() and deinit()
+    std::map<int, std::shared_ptr<PacStream> > mPacStreams;
 
     // Guard lock for payload buffer
     Mutex mIpuParamLock;
     // key: pair<streamId, contextId> -> PacTerminalBufMap
     std::map<std::pair<int, uint8_t>, PacTerminalBufMap> mTerminalData;
 
-    std::map<std::pair<int, uint8_t>, std::vector<CBTerminalResult> > mTerminalResult;
-    std::map<int, cca::cca_pal_input_params*> mStreamIdToInputParams;
+    std::map<std::pair<int, uint8_t>, CBTerminalResultRing> mTerminalResult;
 
+    // Guard for mLastStatsSequence and the statistics updated by all streams
+    Mutex mStatsLock;
     int64_t mLastStatsSequence;
-    static const uint8_t MAX_CACHE_PAC_HIST = 6;
-    // key: pair<streamId, sequence> --> bool (true means stats decoded)
-    std::map<std::pair<int, int64_t>, bool> mPacRunHistMap;
 };
 } // namespace icamera
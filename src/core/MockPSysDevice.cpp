@@ -55,17 +55,17 @@ void MockPSysDevice::registerPSysDeviceCallback(uint8_t contextId, IPSysDeviceCa
 }
 
 int MockPSysDevice::addTask(const PSysTask& task) {
-    for (const auto& item : task.terminalBuffers) {
-        if (task.sequence < kStartingFrameCount && item.second.handle > 0) {
-            char* addr =
-                reinterpret_cast<char*>(::mmap(nullptr, item.second.size, PROT_READ | PROT_WRITE,
-                                               MAP_SHARED, item.second.handle, 0));
+    for (uint8_t i = 0U; i < task.terminalCount; i++) {
+        const TerminalBuffer& item = task.terminalBuffers[i];
+        if (task.sequence < kStartingFrameCount && item.handle > 0) {
+            char* addr = reinterpret_cast<char*>(
+                ::mmap(nullptr, item.size, PROT_READ | PROT_WRITE, MAP_SHARED, item.handle, 0));
             if (mFileSource) {
-                mFileSource->fillFrameBuffer(addr, item.second.size, task.sequence);
+                mFileSource->fillFrameBuffer(addr, item.size, task.sequence);
             } else {
-                memset(addr, 0x99, item.second.size);
+                memset(addr, 0x99, item.size);
             }
-            munmap(addr, item.second.size);
+            munmap(addr, item.size);
         }
     }
 
@@ -54,7 +54,7 @@ class MockPSysDevice : public PSysDevice {
         buf->psysBuf.base.fd = ++mFd;
         return OK;
     }
-    virtual void unregisterBuffer(TerminalBuffer* buf) override {}
+    virtual void unregisterBuffer(const TerminalBuffer* buf) override {}
 
     virtual int poll() override;
 
@@ -33,6 +33,23 @@ namespace icamera {
 
 static const char* DRIVER_NAME = "/dev/ipu7-psys0";
 
+bool PSysTask::setTerminalBuffer(uint8_t terminalId, const TerminalBuffer& buf) {
+    for (uint8_t i = 0U; i < terminalCount; i++) {
+        if (terminalIds[i] == terminalId) {
+            terminalBuffers[i] = buf;
+            return true;
+        }
+    }
+
+    CheckAndLogError(terminalCount >= MAX_GRAPH_TERMINALS, false,
+                     "Too many terminals, terminal %u isn't added", terminalId);
+    terminalIds[terminalCount] = terminalId;
+    terminalBuffers[terminalCount] = buf;
+    terminalCount++;
+
+    return true;
+}
+
 PSysDevice::PSysDevice(int cameraId)
         : mPollThread(nullptr),
           mExitPending(false),
@@ -43,11 +60,18 @@ PSysDevice::PSysDevice(int cameraId)
     LOG1("<%id> Construct PSysDevice", mCameraId);
 
     CLEAR(mFrameId);
-    (void)memset(&mFrameIdToSeqMap, -1, sizeof(mFrameIdToSeqMap));
+    for (uint8_t i = 0U; i < MAX_NODE_NUM; i++) {
+        for (uint8_t j = 0U; j < MAX_TASK_NUM; j++) {
+            mFrameIdToSeqMap[i][j].store(-1, std::memory_order_relaxed);
+        }
+    }
     mGraphNode = new graph_node[MAX_GRAPH_NODES];
     for (uint8_t i = 0U; i < MAX_GRAPH_NODES; i++) {
         mTaskBuffers[i] = new ipu_psys_term_buffers[MAX_GRAPH_TERMINALS];
+        (void)memset(mTaskBuffers[i], 0, sizeof(ipu_psys_term_buffers) * MAX_GRAPH_TERMINALS);
     }
+    CLEAR(mTaskTermCount);
+    CLEAR(mTaskTermIds);
 
     mPollThread = new PollThread<PSysDevice>(this);
 
@@ -180,42 +204,55 @@ int PSysDevice::closeGraph() {
         mGraphId = INVALID_GRAPH_ID;
     }
     CLEAR(mFrameId);
+    // The next graph rebuilds the task request templates
+    CLEAR(mTaskTermCount);
     return OK;
 }
 
 int PSysDevice::addTask(const PSysTask& task) {
     CheckAndLogError(mFd < 0, INVALID_OPERATION, "psys device wasn't opened");
+    CheckAndLogError(task.nodeCtxId >= MAX_GRAPH_NODES, BAD_VALUE, "Invalid context id %u",
+                     task.nodeCtxId);
+
+    const uint8_t ctxId = task.nodeCtxId;
+    ipu_psys_term_buffers* termBuffers = mTaskBuffers[ctxId];
+
+    // Rebuild the template only if the terminals are changed
+    if ((task.terminalCount != mTaskTermCount[ctxId]) ||
+        (memcmp(task.terminalIds, mTaskTermIds[ctxId], task.terminalCount) != 0)) {
+        LOG1("%s, context %u, build task template with %u terminals", __func__, ctxId,
+             task.terminalCount);
+        (void)memset(termBuffers, 0, sizeof(ipu_psys_term_buffers) * MAX_GRAPH_TERMINALS);
+        for (uint8_t i = 0U; i < task.terminalCount; i++) {
+            termBuffers[i].term_id = task.terminalIds[i];
+        }
+        MEMCPY_S(mTaskTermIds[ctxId], sizeof(mTaskTermIds[ctxId]), task.terminalIds,
+                 task.terminalCount);
+        mTaskTermCount[ctxId] = task.terminalCount;
+    }
+
+    for (uint8_t i = 0U; i < task.terminalCount; i++) {
+        termBuffers[i].term_buf = task.terminalBuffers[i].psysBuf;
+    }
 
     ipu_psys_task_request taskData;
     CLEAR(taskData);
 
     taskData.graph_id = mGraphId;
-    taskData.node_ctx_id = task.nodeCtxId;
-    taskData.frame_id = mFrameId[task.nodeCtxId];
-    taskData.task_buffers = mTaskBuffers[task.nodeCtxId];
-    (void)memset(mTaskBuffers[task.nodeCtxId], 0,
-                 sizeof(ipu_psys_term_buffers) * MAX_GRAPH_TERMINALS);
-    taskData.term_buf_count = 0U;
-
-    for (const auto& item : task.terminalBuffers) {
-        taskData.task_buffers[taskData.term_buf_count].term_id = item.first;
-        taskData.task_buffers[taskData.term_buf_count].term_buf = item.second.psysBuf;
-        taskData.term_buf_count++;
-    }
-
-    {
-        std::lock_guard<std::mutex> l(mDataLock);
-        const uint8_t idx = taskData.frame_id % MAX_TASK_NUM;
-        CheckWarningNoReturn(mFrameIdToSeqMap[task.nodeCtxId][idx] >= 0,
-                             "context %d sequence %lld not done", task.nodeCtxId,
-                             mFrameIdToSeqMap[task.nodeCtxId][idx]);
-
-        mFrameIdToSeqMap[task.nodeCtxId][idx] = task.sequence;
-        if (mFrameId[task.nodeCtxId] >= MAX_DRV_FRAME_ID) {
-            mFrameId[task.nodeCtxId] = 0U;
-        } else {
-            ++mFrameId[task.nodeCtxId];
-        }
+    taskData.node_ctx_id = ctxId;
+    taskData.frame_id = mFrameId[ctxId];
+    taskData.task_buffers = termBuffers;
+    taskData.term_buf_count = task.terminalCount;
+
+    const uint8_t idx = taskData.frame_id % MAX_TASK_NUM;
+    const int64_t lastSequence = mFrameIdToSeqMap[ctxId][idx].exchange(task.sequence);
+    CheckWarningNoReturn(lastSequence >= 0, "context %d sequence %lld not done", ctxId,
+                         lastSequence);
+
+    if (mFrameId[ctxId] >= MAX_DRV_FRAME_ID) {
+        mFrameId[ctxId] = 0U;
+    } else {
+        ++mFrameId[ctxId];
     }
 
     const int ret = ioctl(mFd, static_cast<int>(IPU_IOC_TASK_REQUEST), &taskData);
@@ -373,17 +410,15 @@ int PSysDevice::poll(short events, int timeout)
 }
 
 void PSysDevice::handleEvent(const ipu_psys_event& event) {
-    int64_t sequence = -1;
-    const uint8_t idx = event.frame_id % MAX_TASK_NUM;;
-
-    {
-        std::lock_guard<std::mutex> l(mDataLock);
-        if (mFrameIdToSeqMap[event.node_ctx_id][idx] < 0) {
-            LOGW("frame id %u isn't found", event.frame_id);
-            return;
-        }
-
-        sequence = mFrameIdToSeqMap[event.node_ctx_id][idx];
+    CheckAndLogError(event.node_ctx_id >= MAX_NODE_NUM, VOID_VALUE, "Invalid context id %u",
+                     event.node_ctx_id);
+    const uint8_t idx = event.frame_id % MAX_TASK_NUM;
+    std::atomic<int64_t>& seqSlot = mFrameIdToSeqMap[event.node_ctx_id][idx];
+
+    int64_t sequence = seqSlot.load();
+    if (sequence < 0) {
+        LOGW("frame id %u isn't found", event.frame_id);
+        return;
     }
 
     if (mPSysDeviceCallbackMap.find(event.node_ctx_id) == mPSysDeviceCallbackMap.end()) {
@@ -392,10 +427,8 @@ void PSysDevice::handleEvent(const ipu_psys_event& event) {
     }
     mPSysDeviceCallbackMap[event.node_ctx_id]->bufferDone(sequence);
 
-    {
-        std::lock_guard<std::mutex> l(mDataLock);
-        mFrameIdToSeqMap[event.node_ctx_id][idx] = -1;
-    }
+    // Keep the slot if it is already taken by a newer task
+    (void)seqSlot.compare_exchange_strong(sequence, -1);
 
     LOG2("context id %u, frame id %u is done", event.node_ctx_id, event.frame_id);
 }
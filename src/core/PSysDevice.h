@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <atomic>
 #include <map>
 #include <list>
 #include <mutex>
@@ -82,8 +83,13 @@ struct TerminalBuffer {
 struct PSysTask {
     uint8_t nodeCtxId = 0;
     int64_t sequence = 0;
-    // first: terminal id, second: TerminalBuffer
-    std::unordered_map<uint8_t, TerminalBuffer> terminalBuffers;
+    // terminalIds[i] is the terminal id of terminalBuffers[i], in the order they are set
+    uint8_t terminalCount = 0;
+    uint8_t terminalIds[MAX_GRAPH_TERMINALS];
+    TerminalBuffer terminalBuffers[MAX_GRAPH_TERMINALS];
+
+    // Set the buffer of the terminal, replace the buffer if the terminal is already set
+    bool setTerminalBuffer(uint8_t terminalId, const TerminalBuffer& buf);
 };
 
 /**
@@ -132,12 +138,23 @@ class PSysDevice {
 
     int32_t mEventFd;
 
+    // Only accessed by the thread adding tasks of the node context
     uint8_t mFrameId[MAX_NODE_NUM];
-    std::mutex mDataLock;
-    int64_t mFrameIdToSeqMap[MAX_NODE_NUM][MAX_TASK_NUM];
+    // Written by addTask() and cleared by handleEvent(), no lock protection
+    std::atomic<int64_t> mFrameIdToSeqMap[MAX_NODE_NUM][MAX_TASK_NUM];
 
     struct graph_node *mGraphNode;
+    /*
+     * Task request template of each node context. The terminal ids are filled when the
+     * terminals of a task differ from the previous task of the node context, otherwise
+     * only the buffers of the terminals are patched.
+     */
     struct ipu_psys_term_buffers *mTaskBuffers[MAX_GRAPH_NODES];
+    uint8_t mTaskTermCount[MAX_GRAPH_NODES];
+    uint8_t mTaskTermIds[MAX_GRAPH_NODES][MAX_GRAPH_TERMINALS];
+
+    // Protect the PSYS buffer maps
+    std::mutex mDataLock;
 
     std::unordered_map<int, TerminalBuffer> mFdToTermBufMap;
     std::unordered_map<void*, TerminalBuffer> mPtrToTermBufMap;
@@ -25,6 +25,7 @@
 #include "PlatformData.h"
 #include "iutils/CameraDump.h"
 #include "iutils/CameraLog.h"
+#include "iutils/PerfStats.h"
 #include "iutils/Utils.h"
 #include "CameraContext.h"
 #include "src/core/processingUnit/IPipeManagerFactory.h"
@@ -386,7 +387,7 @@ int ProcessingUnit::processNewFrame() {
         // check the output request
         for (auto& output : BufferQueue::mOutputQueue) {
             const uuid port = output.first;
-            CameraBufQ& outputQueue = output.second;
+            CameraBufRing& outputQueue = output.second;
             if (outputQueue.empty()) {
                 taskReady = false;
                 LOG3("<id%d>@%s, port %d, output buffer not ready", mCameraId, __func__, port);
@@ -397,6 +398,7 @@ int ProcessingUnit::processNewFrame() {
     }
 
     if (taskReady) {
+        PERF_STAGE_STATS(mCameraId, PERF_STAGE_PROCESSING_UNIT);
         ret = prepareTask(&srcBuffers, &dstBuffers);
         CheckAndLogError(ret != OK, UNKNOWN_ERROR, "%s, Failed to process frame", __func__);
     }
@@ -958,7 +960,7 @@ void ProcessingUnit::onBufferDone(int64_t sequence, uuid port,
     }
 }
 
-void ProcessingUnit::onStatsReady(EventData& eventData) {
+void ProcessingUnit::onStatsReady(const EventData& eventData) {
     if ((eventData.type == EVENT_PSYS_STATS_BUF_READY) ||
         (eventData.type == EVENT_PSYS_STATS_SIS_BUF_READY)) {
         notifyListeners(eventData);
@@ -1075,8 +1077,8 @@ void ProcessingUnit::outputRawImage(shared_ptr<CameraBuffer>& srcBuf,
     }
 
     // Copy from source buffer
-    CameraBufferMapper srcMapper(srcBuf);
-    CameraBufferMapper dstMapper(dstBuf);
+    CameraBufferMapper srcMapper(mCameraId, srcBuf);
+    CameraBufferMapper dstMapper(mCameraId, dstBuf);
 
     MEMCPY_S(dstMapper.addr(), dstMapper.size(), srcMapper.addr(), srcMapper.size());
 
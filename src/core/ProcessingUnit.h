@@ -50,7 +50,7 @@ class ProcessingUnit : public IProcessingUnit, public PipeManagerCallback {
     virtual void onBufferDone(int64_t sequence, uuid port,
                               const std::shared_ptr<CameraBuffer>& camBuffer);
     virtual void onMetadataReady(int64_t sequence, const CameraBufferPortMap& outBuf);
-    virtual void onStatsReady(EventData& eventData);
+    virtual void onStatsReady(const EventData& eventData);
 
  private:
     DISALLOW_COPY_AND_ASSIGN(ProcessingUnit);
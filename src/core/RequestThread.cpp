@@ -236,7 +236,7 @@ int RequestThread::wait1stRequestDone() {
     return ret;
 }
 
-void RequestThread::handleEvent(EventData eventData) {
+void RequestThread::handleEvent(const EventData& eventData) {
     if (mState == EXIT) {
         return;
     }
@@ -36,7 +36,7 @@ public:
     void requestStart();
     void requestStop();
 
-    virtual void handleEvent(EventData eventData);
+    virtual void handleEvent(const EventData& eventData);
 
     /**
      * \Clear pending requests.
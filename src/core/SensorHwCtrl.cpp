@@ -17,6 +17,7 @@
 #define LOG_TAG SensorHwCtrl
 
 #include <limits.h>
+#include <string.h>
 #include <linux/types.h>
 #include <linux/v4l2-controls.h>
 // CRL_MODULE_S
@@ -47,7 +48,10 @@ SensorHwCtrl::SensorHwCtrl(int cameraId, V4L2Subdevice* pixelArraySubdev,
           mWdrMode(0),
           // HDR_FEATURE_E
           mCurFll(0),
-          mCalculatingFrameDuration(true) {
+          mCalculatingFrameDuration(true),
+          mGroupingControls(false),
+          mBatchSupported(false),
+          mControlStats({}) {
     LOG1("<id%d> @%s", mCameraId, __func__);
     // CRL_MODULE_S
     /**
@@ -64,6 +68,13 @@ SensorHwCtrl::SensorHwCtrl(int cameraId, V4L2Subdevice* pixelArraySubdev,
         }
     }
     // CRL_MODULE_E
+
+    // Check once if the controls of one frame can be written with one ioctl
+    if (mPixelArraySubdev != nullptr) {
+        mBatchSupported = (mPixelArraySubdev->ProbeExtControls() == OK);
+        LOG1("%s, batched control write is %ssupported", __func__,
+             mBatchSupported ? "" : "not ");
+    }
 }
 
 SensorHwCtrl* SensorHwCtrl::createSensorCtrl(int cameraId) {
@@ -163,7 +174,7 @@ int SensorHwCtrl::setExposure(const vector<int>& coarseExposures,
 
     LOG2("%s coarseExposure=%d fineExposure=%d", __func__, coarseExposures[0], fineExposures[0]);
     LOG2("SENSORCTRLINFO: exposure_value=%d", coarseExposures[0]);
-    int status = mPixelArraySubdev->SetControl(V4L2_CID_EXPOSURE, coarseExposures[0]);
+    int status = setPixelArrayControl(V4L2_CID_EXPOSURE, coarseExposures[0]);
     CheckAndLogError((status != 0), status, "failed to set exposure %d.", coarseExposures[0]);
 
     return OK;
@@ -179,7 +190,7 @@ int SensorHwCtrl::setMultiExposures(const vector<int>& coarseExposures,
     if (coarseExposures.size() > 2) {
         LOG2("coarseExposure[0]=%d fineExposure[0]=%d", coarseExposures[0], fineExposures[0]);
         // The first exposure is very short exposure if larger than 2 exposures.
-        status = mPixelArraySubdev->SetControl(CRL_CID_EXPOSURE_SHS2, coarseExposures[0]);
+        status = setPixelArrayControl(CRL_CID_EXPOSURE_SHS2, coarseExposures[0]);
         CheckAndLogError(status != OK, status, "failed to set exposure SHS2 %d.",
                          coarseExposures[0]);
 
@@ -192,10 +203,10 @@ int SensorHwCtrl::setMultiExposures(const vector<int>& coarseExposures,
     }
 
     LOG2("shortExp=%d longExp=%d", shortExp, longExp);
-    status = mPixelArraySubdev->SetControl(CRL_CID_EXPOSURE_SHS1, shortExp);
+    status = setPixelArrayControl(CRL_CID_EXPOSURE_SHS1, shortExp);
     CheckAndLogError(status != OK, status, "failed to set exposure SHS1 %d.", shortExp);
 
-    status = mPixelArraySubdev->SetControl(V4L2_CID_EXPOSURE, longExp);
+    status = setPixelArrayControl(V4L2_CID_EXPOSURE, longExp);
     CheckAndLogError(status != OK, status, "failed to set long exposure %d.", longExp);
     LOG2("SENSORCTRLINFO: exposure_value=%d", longExp);
 
@@ -210,7 +221,7 @@ int SensorHwCtrl::setDualExposuresDCGAndVS(const vector<int>& coarseExposures,
     if (coarseExposures.size() > 2) {
         LOG2("coarseExposure[0]=%d fineExposure[0]=%d", coarseExposures[0], fineExposures[0]);
         // The first exposure is very short exposure for DCG + VS case.
-        status = mPixelArraySubdev->SetControl(CRL_CID_EXPOSURE_SHS1, coarseExposures[0]);
+        status = setPixelArrayControl(CRL_CID_EXPOSURE_SHS1, coarseExposures[0]);
         CheckAndLogError(status != OK, status, "failed to set exposure SHS1 %d.",
                          coarseExposures[0]);
 
@@ -218,7 +229,7 @@ int SensorHwCtrl::setDualExposuresDCGAndVS(const vector<int>& coarseExposures,
         LOG2("SENSORCTRLINFO: exposure_long=%d", coarseExposures[2]);  // long
     }
 
-    status = mPixelArraySubdev->SetControl(V4L2_CID_EXPOSURE, longExp);
+    status = setPixelArrayControl(V4L2_CID_EXPOSURE, longExp);
     CheckAndLogError(status != OK, status, "failed to set long exposure %d.", longExp);
     LOG2("SENSORCTRLINFO: exposure_value=%d", longExp);
 
@@ -243,7 +254,7 @@ int SensorHwCtrl::setAnalogGains(const vector<int>& analogGains) {
     // CRL_MODULE_E
 
     LOG2("%s analogGain=%d", __func__, analogGains[0]);
-    int status = mPixelArraySubdev->SetControl(V4L2_CID_ANALOGUE_GAIN, analogGains[0]);
+    int status = setPixelArrayControl(V4L2_CID_ANALOGUE_GAIN, analogGains[0]);
     CheckAndLogError((status != 0), status, "failed to set analog gain %d.", analogGains[0]);
 
     return OK;
@@ -268,14 +279,14 @@ int SensorHwCtrl::setDigitalGains(const vector<int>& digitalGains) {
         (PlatformData::getSensorGainType(mCameraId) == ISP_DG_AND_SENSOR_DIRECT_AG)) {
         LOG2("%s: WDR mode, skip sensor DG, all digital gain is passed to ISP", __func__);
     } else if (PlatformData::isUsingSensorDigitalGain(mCameraId)) {
-        if (mPixelArraySubdev->SetControl(V4L2_CID_GAIN, digitalGains[0]) != OK) {
+        if (setPixelArrayControl(V4L2_CID_GAIN, digitalGains[0]) != OK) {
             LOGW("set digital gain failed");
         }
     }
     // CRL_MODULE_E
 
     LOG2("%s digitalGain=%d", __func__, digitalGains[0]);
-    int status = mPixelArraySubdev->SetControl(V4L2_CID_DIGITAL_GAIN, digitalGains[0]);
+    int status = setPixelArrayControl(V4L2_CID_DIGITAL_GAIN, digitalGains[0]);
     CheckAndLogError((status != 0), status, "failed to set digitalGain gain %d.", digitalGains[0]);
 
     return OK;
@@ -289,7 +300,7 @@ int SensorHwCtrl::setMultiDigitalGain(const vector<int>& digitalGains) {
 
     if (digitalGains.size() > 2) {
         LOG2("digitalGains[0]=%d", digitalGains[0]);
-        status = mPixelArraySubdev->SetControl(CRL_CID_DIGITAL_GAIN_VS, digitalGains[0]);
+        status = setPixelArrayControl(CRL_CID_DIGITAL_GAIN_VS, digitalGains[0]);
         CheckAndLogError(status != OK, status, "failed to set very short DG %d.", digitalGains[0]);
 
         shortDg = digitalGains[1];
@@ -297,10 +308,10 @@ int SensorHwCtrl::setMultiDigitalGain(const vector<int>& digitalGains) {
     }
 
     LOG2("shortDg=%d longDg=%d", shortDg, longDg);
-    status = mPixelArraySubdev->SetControl(CRL_CID_DIGITAL_GAIN_S, shortDg);
+    status = setPixelArrayControl(CRL_CID_DIGITAL_GAIN_S, shortDg);
     CheckAndLogError(status != OK, status, "failed to set short DG %d.", shortDg);
 
-    status = mPixelArraySubdev->SetControl(V4L2_CID_GAIN, longDg);
+    status = setPixelArrayControl(V4L2_CID_GAIN, longDg);
     CheckAndLogError(status != OK, status, "failed to set long DG %d.", longDg);
 
     return status;
@@ -313,7 +324,7 @@ int SensorHwCtrl::setMultiAnalogGain(const vector<int>& analogGains) {
 
     if (analogGains.size() > 2) {
         LOG2("VS AG %d", analogGains[0]);
-        const int status = mPixelArraySubdev->SetControl(CRL_CID_ANALOG_GAIN_VS, analogGains[0]);
+        const int status = setPixelArrayControl(CRL_CID_ANALOG_GAIN_VS, analogGains[0]);
         CheckAndLogError(status != OK, status, "failed to set VS AG %d", analogGains[0]);
 
         shortAg = analogGains[1];
@@ -325,10 +336,10 @@ int SensorHwCtrl::setMultiAnalogGain(const vector<int>& analogGains) {
     }
 
     LOG2("shortAg=%d longAg=%d", shortAg, longAg);
-    status = mPixelArraySubdev->SetControl(CRL_CID_ANALOG_GAIN_S, shortAg);
+    status = setPixelArrayControl(CRL_CID_ANALOG_GAIN_S, shortAg);
     CheckAndLogError(status != OK, status, "failed to set short AG %d.", shortAg);
 
-    status = mPixelArraySubdev->SetControl(V4L2_CID_ANALOGUE_GAIN, longAg);
+    status = setPixelArrayControl(V4L2_CID_ANALOGUE_GAIN, longAg);
     CheckAndLogError(status != OK, status, "failed to set long AG %d.", longAg);
 
     return status;
@@ -346,7 +357,7 @@ int SensorHwCtrl::setConversionGain(const vector<int>& analogGains) {
     LOG2("very short AG %d, short AG %d, long AG %d, conversion value %d", analogGains[0],
          analogGains[1], analogGains[2], value);
 
-    const int status = mPixelArraySubdev->SetControl(V4L2_CID_ANALOGUE_GAIN, value);
+    const int status = setPixelArrayControl(V4L2_CID_ANALOGUE_GAIN, value);
     CheckAndLogError(status != OK, status, "failed to set AG %d", value);
 
     return OK;
@@ -360,11 +371,11 @@ int SensorHwCtrl::setLineLengthPixels(int llp) {
     if (mCalculatingFrameDuration) {
         const int horzBlank = llp - mCropWidth;
         if (mHorzBlank != horzBlank) {
-            status = mPixelArraySubdev->SetControl(V4L2_CID_HBLANK, horzBlank);
+            status = setPixelArrayControl(V4L2_CID_HBLANK, horzBlank);
         }
         // CRL_MODULE_S
     } else {
-        status = mPixelArraySubdev->SetControl(V4L2_CID_LINE_LENGTH_PIXELS, llp);
+        status = setPixelArrayControl(V4L2_CID_LINE_LENGTH_PIXELS, llp);
         // CRL_MODULE_E
     }
 
@@ -381,11 +392,11 @@ int SensorHwCtrl::setFrameLengthLines(int fll) {
     if (mCalculatingFrameDuration) {
         const int vertBlank = fll - mCropHeight;
         if (mVertBlank != vertBlank) {
-            status = mPixelArraySubdev->SetControl(V4L2_CID_VBLANK, vertBlank);
+            status = setPixelArrayControl(V4L2_CID_VBLANK, vertBlank);
         }
         // CRL_MODULE_S
     } else {
-        status = mPixelArraySubdev->SetControl(V4L2_CID_FRAME_LENGTH_LINES, fll);
+        status = setPixelArrayControl(V4L2_CID_FRAME_LENGTH_LINES, fll);
         // CRL_MODULE_E
     }
 
@@ -414,6 +425,89 @@ int SensorHwCtrl::setFrameDuration(int llp, int fll) {
     return OK;
 }
 
+void SensorHwCtrl::beginControls() {
+    LOG2("@%s", __func__);
+    mGroupingControls = true;
+}
+
+int SensorHwCtrl::commitControls() {
+    HAL_TRACE_CALL(CAMERA_DEBUG_LOG_LEVEL2);
+    if (!mGroupingControls) return OK;
+
+    mGroupingControls = false;
+    if (mTimingControls.empty() && mPendingControls.empty()) return OK;
+
+    uint32_t ioctls = 0;
+    int status = writeControls(&mTimingControls, &ioctls);
+    status |= writeControls(&mPendingControls, &ioctls);
+
+    mControlStats.frames++;
+    mControlStats.ioctls += ioctls;
+    mControlStats.lastFrameIoctls = ioctls;
+    LOG2("@%s, %u ioctls, status %d", __func__, ioctls, status);
+
+    return status;
+}
+
+int SensorHwCtrl::setPixelArrayControl(int id, int value) {
+    if (!mGroupingControls) return mPixelArraySubdev->SetControl(id, value);
+
+    bool isTiming = (id == V4L2_CID_HBLANK) || (id == V4L2_CID_VBLANK);
+    // CRL_MODULE_S
+    isTiming = isTiming || (id == V4L2_CID_LINE_LENGTH_PIXELS) ||
+               (id == V4L2_CID_FRAME_LENGTH_LINES);
+    // CRL_MODULE_E
+    vector<v4l2_ext_control>& controls = isTiming ? mTimingControls : mPendingControls;
+
+    // The last value wins if one control is set twice in a frame
+    for (auto& control : controls) {
+        if (control.id == static_cast<uint32_t>(id)) {
+            control.value = value;
+            return OK;
+        }
+    }
+
+    v4l2_ext_control control = {};
+    control.id = id;
+    control.value = value;
+    controls.push_back(control);
+    return OK;
+}
+
+int SensorHwCtrl::writeControls(vector<v4l2_ext_control>* controls, uint32_t* ioctls) {
+    if (controls->empty()) return OK;
+
+    int status = OK;
+    bool batchDone = false;
+    if (mBatchSupported) {
+        uint32_t errorIdx = 0;
+        (*ioctls)++;
+        status = mPixelArraySubdev->SetControls(controls->data(), controls->size(), &errorIdx);
+        if (status == OK) {
+            batchDone = true;
+        } else {
+            // The driver supports the batch, so the failure comes from the values
+            LOGW("%s: batched write of %zu controls failed at %u, %s, write them one by one",
+                 __func__, controls->size(), errorIdx, strerror(-status));
+            mControlStats.fallbacks++;
+        }
+    }
+
+    if (!batchDone) {
+        status = OK;
+        for (const auto& control : *controls) {
+            (*ioctls)++;
+            const int ret = mPixelArraySubdev->SetControl(control.id, control.value);
+            CheckWarningNoReturn(ret != OK, "failed to set control 0x%x to %d", control.id,
+                                 control.value);
+            status |= ret;
+        }
+    }
+
+    controls->clear();
+    return status;
+}
+
 int SensorHwCtrl::getLineLengthPixels(int& llp) {
     int status = OK;
 
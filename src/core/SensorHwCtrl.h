@@ -47,6 +47,29 @@ class SensorHwCtrl {
     virtual int getActivePixelArraySize(int& width, int& height, int& pixelCode);
     virtual int getExposureRange(int& exposureMin, int& exposureMax, int& exposureStep);
 
+    /**
+     * Start to group the sensor controls of one frame.
+     * Until commitControls() is called, setExposure(), setAnalogGains(), setDigitalGains()
+     * and setFrameDuration() queue their controls instead of writing them one by one.
+     */
+    virtual void beginControls();
+
+    /**
+     * Write the queued controls with one VIDIOC_S_EXT_CTRLS, fall back to writing
+     * them one by one if the driver rejects the batched write.
+     *
+     *\return OK if all controls are written.
+     */
+    virtual int commitControls();
+
+    struct ControlStats {
+        uint64_t frames;            // committed control groups
+        uint64_t ioctls;            // ioctls used to write them
+        uint64_t fallbacks;         // batched writes rejected by driver
+        uint32_t lastFrameIoctls;   // ioctls used by the last committed group
+    };
+    ControlStats getControlStats() const { return mControlStats; }
+
     // HDR_FEATURE_S
     /**
      * Set WDR mode to sensor which is used to select WDR sensor settings or none-WDR settings.
@@ -77,6 +100,8 @@ class SensorHwCtrl {
     int getLineLengthPixels(int& llp);
     int setFrameLengthLines(int fll);
     int getFrameLengthLines(int& fll);
+    int setPixelArrayControl(int id, int value);
+    int writeControls(std::vector<v4l2_ext_control>* controls, uint32_t* ioctls);
 
     // CRL_MODULE_S
     int setMultiExposures(const std::vector<int>& coarseExposures,
@@ -110,6 +135,20 @@ class SensorHwCtrl {
      * use HBlank/VBlank to calculate it.
      */
     bool mCalculatingFrameDuration;
+
+    bool mGroupingControls;
+    /**
+     * Probed once with the pixel array sub device. If false, controls are written one by
+     * one. A failed batched write only falls back for that write.
+     */
+    bool mBatchSupported;
+    /**
+     * llp/fll controls are written ahead of the others, the driver may update the
+     * exposure range with them and the batched write validates all values first.
+     */
+    std::vector<v4l2_ext_control> mTimingControls;
+    std::vector<v4l2_ext_control> mPendingControls;
+    ControlStats mControlStats;
 };  // class SensorHwCtrl
 
 /**
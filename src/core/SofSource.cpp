@@ -22,6 +22,7 @@
 #include "PlatformData.h"
 #include "V4l2DeviceFactory.h"
 #include "iutils/CameraLog.h"
+#include "iutils/FrameTimeline.h"
 #include "iutils/Utils.h"
 
 namespace icamera {
@@ -188,6 +189,7 @@ int SofSource::poll() {
     LOG2("<seq%ld> %s:sof event, event.id %u", syncData.sequence, __func__, event.id);
     TRACE_LOG_POINT("SofSource", "receive sof event", MAKE_COLOR(syncData.sequence),
                     syncData.sequence);
+    FrameTimeline::mark(mCameraId, TIMELINE_SOF, syncData.sequence);
     EventData eventData;
     eventData.type = EVENT_ISYS_SOF;
     eventData.buffer = nullptr;
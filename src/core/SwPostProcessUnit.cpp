@@ -81,9 +81,12 @@ status_t SwPostProcessUnit::configure(const stream_t& srcStream, const stream_t&
         info.type = POST_PROCESS_ROTATE;
         info.inputInfo = inputStreamInfo;
         info.outputInfo = inputStreamInfo;
-        info.outputInfo.width = inputStreamInfo.height;
-        info.outputInfo.height = inputStreamInfo.width;
-        info.outputInfo.stride = inputStreamInfo.height;
+        // Only 90 and 270 swap the width and height
+        if (info.angle % 180 != 0) {
+            info.outputInfo.width = inputStreamInfo.height;
+            info.outputInfo.height = inputStreamInfo.width;
+            info.outputInfo.stride = inputStreamInfo.height;
+        }
         info.outputInfo.size =
             CameraUtils::getFrameSize(info.outputInfo.format, info.outputInfo.width,
                                       info.outputInfo.height, false, false, false);
@@ -23,6 +23,7 @@
 #include "StageDescriptor.h"
 #include "ia_pal_types_isp_ids_autogen.h"
 #include "iutils/CameraLog.h"
+#include "iutils/FrameTimeline.h"
 
 namespace icamera {
 
@@ -204,10 +205,10 @@ int32_t CBStage::processTask(StageTask* task) {
         item.second->setSequence(task->sequence);
     }
 
-    std::unordered_map<uint8_t, TerminalBuffer> terminalBuffers;
+    PSysTask psysTask;
 
     if (mInputPortTerminals.empty()) {
-        ret = addFrameTerminals(&terminalBuffers, task->inBuffers);
+        ret = addFrameTerminals(&psysTask, task->inBuffers);
         CheckAndLogError(ret != OK, ret, "Failed to add terminals for task->inBuffers");
     } else {
         std::map<uuid, std::shared_ptr<CameraBuffer>> inBuffers;
@@ -217,11 +218,11 @@ int32_t CBStage::processTask(StageTask* task) {
                              UNKNOWN_ERROR, "%s: wrong input port %d", getName(), item.first);
             inBuffers[mInputPortTerminals[item.first]] = item.second;
         }
-        ret = addFrameTerminals(&terminalBuffers, inBuffers);
+        ret = addFrameTerminals(&psysTask, inBuffers);
         CheckAndLogError(ret != OK, ret, "Failed to add terminals for inBuffers");
     }
 
-    ret = addFrameTerminals(&terminalBuffers, task->outBuffers, task->sequence);
+    ret = addFrameTerminals(&psysTask, task->outBuffers, task->sequence);
     CheckAndLogError(ret != OK, ret, "Failed to add terminals for  task->outBuffers");
 
     {
@@ -229,7 +230,7 @@ int32_t CBStage::processTask(StageTask* task) {
         mStageTaskList.push_back(*task);
     }
 
-    ret = addTask(&terminalBuffers, bufferMap, task->sequence);
+    ret = addTask(&psysTask, bufferMap, task->sequence);
     CheckAndLogError(ret != OK, ret, "Failed to add task ret %d", ret);
 
     if (mLinkStreamMode == LINK_STREAMING_MODE_BCLM) {
@@ -241,6 +242,7 @@ int32_t CBStage::processTask(StageTask* task) {
 }
 
 int CBStage::bufferDone(int64_t sequence) {
+    FrameTimeline::mark(mCameraId, TIMELINE_PSYS_NODE_DONE, sequence, mOuterNodeCtxId);
     std::lock_guard<std::mutex> l(mDataLock);
 
     if (mStageTaskList.size() > 0) {
@@ -841,7 +843,7 @@ int CBStage::registerPayloadBuffer(aic::IaAicBuffer** iaAicBuf, PacTerminalBufMa
     return OK;
 }
 
-int CBStage::addFrameTerminals(std::unordered_map<uint8_t, TerminalBuffer>* terminalBuffers,
+int CBStage::addFrameTerminals(PSysTask* psysTask,
                                const std::map<uuid, std::shared_ptr<CameraBuffer>>& buffers,
                                int64_t sequence) {
     for (auto it : buffers) {
@@ -879,7 +881,8 @@ int CBStage::addFrameTerminals(std::unordered_map<uint8_t, TerminalBuffer>* term
         int ret = mPSysDevice->registerBuffer(&terminalBuf);
         CheckAndLogError(ret != OK, ret, "Failed to register outBuffers ret %d", ret);
 
-        (*terminalBuffers)[terminalId] = terminalBuf;
+        CheckAndLogError(!psysTask->setTerminalBuffer(terminalId, terminalBuf), UNKNOWN_ERROR,
+                         "Failed to add terminal %u", terminalId);
 
         if (terminalBuf.isExtDmaBuf) {
             std::lock_guard<std::mutex> l(mDataLock);
@@ -904,13 +907,9 @@ void CBStage::unregisterExtDmaBuf(int64_t sequence) {
     }
 }
 
-int CBStage::addTask(std::unordered_map<uint8_t, TerminalBuffer>* terminalBuffers,
-                     const PacTerminalBufMap& bufferMap, int64_t sequence) {
-    PSysTask psysTask;
-
-    psysTask.nodeCtxId = mContextId;
-    psysTask.sequence = sequence;
-    psysTask.terminalBuffers = *terminalBuffers;
+int CBStage::addTask(PSysTask* psysTask, const PacTerminalBufMap& bufferMap, int64_t sequence) {
+    psysTask->nodeCtxId = mContextId;
+    psysTask->sequence = sequence;
 
     for (auto buf : bufferMap) {
         if (mUserToTerminalBuffer.find(buf.second.payloadPtr) == mUserToTerminalBuffer.end()) {
@@ -918,7 +917,9 @@ int CBStage::addTask(std::unordered_map<uint8_t, TerminalBuffer>* terminalBuffer
             return UNKNOWN_ERROR;
         }
 
-        psysTask.terminalBuffers[buf.first] = mUserToTerminalBuffer[buf.second.payloadPtr];
+        CheckAndLogError(
+            !psysTask->setTerminalBuffer(buf.first, mUserToTerminalBuffer[buf.second.payloadPtr]),
+            UNKNOWN_ERROR, "Failed to add payload terminal %u", buf.first);
     }
 
     if (mNode2SelfBuffers.size() > 0) {
@@ -928,15 +929,22 @@ int CBStage::addTask(std::unordered_map<uint8_t, TerminalBuffer>* terminalBuffer
         for (auto it : mNode2SelfBuffers) {
             TerminalBuffer& outBuf = it.second[referOutIdx];
             const TerminalBuffer& inBuf = it.second[referInIdx];
-            psysTask.terminalBuffers[it.first] = mUserToTerminalBuffer[outBuf.userPtr];
+            CheckAndLogError(
+                !psysTask->setTerminalBuffer(it.first, mUserToTerminalBuffer[outBuf.userPtr]),
+                UNKNOWN_ERROR, "Failed to add self terminal %u", it.first);
 
             for (auto link : mNode2SelfLinks[it.first]) {
                 if (link.delayedLink > 0) {
                     // Use output of the last frame as input
-                    psysTask.terminalBuffers[link.dstTermId] = inBuf;
+                    CheckAndLogError(!psysTask->setTerminalBuffer(link.dstTermId, inBuf),
+                                     UNKNOWN_ERROR, "Failed to add delayed link terminal %u",
+                                     link.dstTermId);
                 } else {
                     // Use output of the current frame as input (buffer chasing)
-                    psysTask.terminalBuffers[link.dstTermId] = mUserToTerminalBuffer[outBuf.userPtr];
+                    CheckAndLogError(!psysTask->setTerminalBuffer(
+                                         link.dstTermId, mUserToTerminalBuffer[outBuf.userPtr]),
+                                     UNKNOWN_ERROR, "Failed to add link terminal %u",
+                                     link.dstTermId);
                 }
             }
         }
@@ -944,7 +952,7 @@ int CBStage::addTask(std::unordered_map<uint8_t, TerminalBuffer>* terminalBuffer
 
     dumpTerminalData(bufferMap, sequence);
 
-    int ret = mPSysDevice->addTask(psysTask);
+    int ret = mPSysDevice->addTask(*psysTask);
     CheckAndLogError(ret != OK, ret, "Failed to add task ret %d", ret);
 
     return OK;
@@ -105,11 +105,10 @@ class CBStage : public IPipeStage, public IPSysDeviceCallback {
     int registerPayloadBuffer(aic::IaAicBuffer** iaAicBuf, PacTerminalBufMap& termBufMap);
 
     void unregisterExtDmaBuf(int64_t sequence);
-    int addFrameTerminals(std::unordered_map<uint8_t, TerminalBuffer>* terminalBuffers,
+    int addFrameTerminals(PSysTask* psysTask,
                           const std::map<uuid, std::shared_ptr<CameraBuffer>>& buffers,
                           int64_t sequence = -1);
-    int addTask(std::unordered_map<uint8_t, TerminalBuffer>* terminalBuffers,
-                const PacTerminalBufMap& bufferMap, int64_t sequence);
+    int addTask(PSysTask* psysTask, const PacTerminalBufMap& bufferMap, int64_t sequence);
     void dumpTerminalData(const PacTerminalBufMap& bufferMap, int64_t sequence);
 
  private:
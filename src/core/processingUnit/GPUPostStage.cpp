@@ -71,7 +71,7 @@ int GPUPostStage::qbuf(uuid port, const std::shared_ptr<CameraBuffer>& camBuffer
 
     int64_t sequence = -1;
     for (auto& item : mPendingOutBuffers) {
-        CameraBufQ& output = mOutputQueue[item.first];
+        CameraBufRing& output = mOutputQueue[item.first];
         output.push(item.second);
         if (item.second != nullptr) {
             sequence = item.second->getSettingSequence();
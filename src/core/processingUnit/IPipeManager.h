@@ -58,7 +58,7 @@ class PipeManagerCallback {
     virtual void onBufferDone(int64_t sequence, uuid port,
                               const std::shared_ptr<CameraBuffer>& camBuffer) = 0;
     virtual void onMetadataReady(int64_t sequence, const CameraBufferPortMap& outBuf) = 0;
-    virtual void onStatsReady(EventData& eventData) = 0;
+    virtual void onStatsReady(const EventData& eventData) = 0;
 };
 
 // Used to save all on-processing tasks.
@@ -19,11 +19,20 @@
 #include "src/core/processingUnit/IPipeManagerFactory.h"
 
 #include "PipeManager.h"
+// PNP_DEBUG_S
+#include "PipeManagerStub.h"
+#include "PnpDebugControl.h"
+// PNP_DEBUG_E
 
 namespace icamera {
 
 IPipeManager* IPipeManagerFactory::createIPipeManager(int cameraId, PipeManagerCallback* callback,
                                                       std::shared_ptr<CameraScheduler>& scheduler) {
+    // PNP_DEBUG_S
+    if (PnpDebugControl::useMockPipes()) {
+        return new PipeManagerStub(cameraId, callback);
+    }
+    // PNP_DEBUG_E
     return new PipeManager(cameraId, callback, scheduler);
 }
 }  // namespace icamera
@@ -23,6 +23,10 @@
 #include "GraphUtils.h"
 #include "iutils/CameraLog.h"
 #include "StageDescriptor.h"
+// PNP_DEBUG_S
+#include "MockPSysDevice.h"
+#include "PnpDebugControl.h"
+// PNP_DEBUG_E
 namespace icamera {
 
 PipeLine::PipeLine(int cameraId, int streamId, std::shared_ptr<GraphConfig> gc,
@@ -217,8 +221,16 @@ status_t PipeLine::createPipeStages() {
 
     if (mPSysDevice) {
         delete mPSysDevice;
+        mPSysDevice = nullptr;
+    }
+    // PNP_DEBUG_S
+    if (PnpDebugControl::isUsingMockPSys()) {
+        mPSysDevice = new MockPSysDevice(mCameraId);
+    }
+    // PNP_DEBUG_E
+    if (mPSysDevice == nullptr) {
+        mPSysDevice = new PSysDevice(mCameraId);
     }
-    mPSysDevice = new PSysDevice(mCameraId);
 
     ret = mPSysDevice->init();
     CheckAndLogError(ret != OK, ret, "%s: failed to initialize psys device", __func__);
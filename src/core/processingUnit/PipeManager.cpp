@@ -23,6 +23,7 @@
 
 #include "CameraContext.h"
 #include "iutils/CameraLog.h"
+#include "iutils/PerfStats.h"
 #include "GraphUtils.h"
 
 namespace icamera {
@@ -401,6 +402,7 @@ void PipeManager::setControl(int64_t sequence, const PipeControl& control) {
 
 void PipeManager::addTask(PipeTaskData taskParam) {
     LOG2("<id%d>@%s", mCameraId, __func__);
+    PERF_STAGE_STATS(mCameraId, PERF_STAGE_PIPE_MANAGER);
 
     TaskInfo task = {};
     // Save the task data into mOngoingTasks
@@ -725,7 +727,7 @@ int PipeManager::onBufferDone(uuid port, const std::shared_ptr<CameraBuffer>& bu
     return OK;
 }
 
-void PipeManager::handleEvent(EventData eventData) {
+void PipeManager::handleEvent(const EventData& eventData) {
     // Process registered events
     LOG2("%s  event %d", __func__, eventData.type);
     switch (eventData.type) {
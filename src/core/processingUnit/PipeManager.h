@@ -51,7 +51,7 @@ class PipeManager : public IPipeManager {
     /**
      * @brief handle bufferDone and metadata event from pipeStage
      */
-    virtual void handleEvent(EventData eventData);
+    virtual void handleEvent(const EventData& eventData);
     // handle bufferDone
     virtual int onBufferDone(uuid port, const std::shared_ptr<CameraBuffer>& camBuffer);
     // metadata handler
@@ -288,7 +288,7 @@ int PipeManagerStub::processTask(const PipeTaskData& task) {
             cOutBuffer = outputFrame.second;
 
             if (sequence < kStartingFrameCount) {
-                CameraBufferMapper mapper(cOutBuffer);
+                CameraBufferMapper mapper(mCameraId, cOutBuffer);
 
                 ImageScalerCore::downScaleImage(
                     mIntermBuffer->getBufferAddr(), mapper.addr(), cOutBuffer->getWidth(),
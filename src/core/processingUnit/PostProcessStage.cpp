@@ -20,6 +20,8 @@
 
 #include "PlatformData.h"
 #include "iutils/CameraLog.h"
+#include "iutils/FrameTimeline.h"
+#include "iutils/PerfStats.h"
 
 namespace icamera {
 
@@ -74,7 +76,7 @@ int PostProcessStage::qbuf(uuid port, const std::shared_ptr<CameraBuffer>& camBu
 
     int64_t sequence = -1;
     for (auto& item : mPendingOutBuffers) {
-        CameraBufQ& output = mOutputQueue[item.first];
+        CameraBufRing& output = mOutputQueue[item.first];
         output.push(item.second);
         if (item.second != nullptr) {
             sequence = item.second->getSettingSequence();
@@ -169,7 +171,9 @@ bool PostProcessStage::process(int64_t triggerId) {
 
         // Do processing only it is for usr request
         if (!control.stillTnrReferIn) {
-            CameraBufferMapper mapper(output.second);
+            PERF_STAGE_STATS(mCameraId, PERF_STAGE_POST_PROCESS);
+            FRAME_TIMELINE_SCOPE(mCameraId, TIMELINE_POST_PROCESS, sequence);
+            CameraBufferMapper mapper(mCameraId, output.second);
 
             int32_t ret = mPostProcessors[outPort]->doPostProcessing(inBuffer, output.second);
             CheckWarningNoReturn(ret != OK, false, "%s: Process errorfor port %d", getName(),
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the per-frame cost of the BufferQueue port queues, PortBufQueues
+// with CameraBufRing, against the std::map<uuid, CameraBufQ> they replaced.
+// Each frame pushes one buffer to every port, reads the front of every port
+// like getFreeBuffersInQueue() and pops them all. Prints the time and the
+// heap allocations per frame.
+//
+// Usage: BufferQueueBenchmark [frames]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "BufferQueue.h"
+
+using icamera::CameraBuffer;
+using icamera::CameraBufQ;
+using icamera::CameraBufRing;
+using icamera::PortBufQueues;
+using icamera::uuid;
+
+namespace {
+
+unsigned long gAllocations = 0;
+
+struct Result {
+    double nsPerFrame;
+    double allocationsPerFrame;
+};
+
+template <typename Queues, typename Queue>
+Result run(Queues* queues, const std::vector<uuid>& ports,
+           const std::vector<std::shared_ptr<CameraBuffer> >& buffers, int frames) {
+    uintptr_t sink = 0;
+    const unsigned long allocations = gAllocations;
+    const auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < frames; n++) {
+        for (size_t p = 0; p < ports.size(); p++) {
+            auto it = queues->find(ports[p]);
+            it->second.push(buffers[(n + p) % buffers.size()]);
+        }
+        for (auto& item : *queues) {
+            Queue& queue = item.second;
+            sink += reinterpret_cast<uintptr_t>(queue.front().get());
+        }
+        for (auto& item : *queues) {
+            item.second.pop();
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    // Keep the loop from being optimized out
+    if (sink == 1U) printf(" ");
+
+    Result result;
+    result.nsPerFrame = std::chrono::duration<double, std::nano>(end - start).count() / frames;
+    result.allocationsPerFrame = static_cast<double>(gAllocations - allocations) / frames;
+    return result;
+}
+
+}  // namespace
+
+void* operator new(size_t size) {
+    gAllocations++;
+    void* ptr = malloc(size ? size : 1);
+    if (ptr == nullptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+int main(int argc, char* argv[]) {
+    const int frames = (argc > 1) ? atoi(argv[1]) : 2000000;
+    if (frames <= 0) {
+        fprintf(stderr, "Usage: %s [frames]\n", argv[0]);
+        return 1;
+    }
+
+    const std::vector<uuid> portSets[] = {
+        {0x1007},
+        {0x1007, 0x2003, 0x5001},
+        {0x1007, 0x2003, 0x5001, 0x9004, 0x3002, 0x4003},
+    };
+    std::vector<std::shared_ptr<CameraBuffer> > buffers;
+    for (int i = 0; i < 8; i++) {
+        buffers.push_back(std::make_shared<CameraBuffer>(V4L2_MEMORY_USERPTR, 0, i));
+    }
+
+    for (const auto& ports : portSets) {
+        std::map<uuid, CameraBufQ> mapQueues;
+        PortBufQueues ringQueues;
+        for (uuid port : ports) {
+            mapQueues[port];
+            ringQueues[port];
+        }
+
+        const Result mapResult =
+            run<std::map<uuid, CameraBufQ>, CameraBufQ>(&mapQueues, ports, buffers, frames);
+        const Result ringResult =
+            run<PortBufQueues, CameraBufRing>(&ringQueues, ports, buffers, frames);
+        printf("%zu ports: map + queue %.1f ns, %.3f allocations; "
+               "PortBufQueues %.1f ns, %.3f allocations per frame\n",
+               ports.size(), mapResult.nsPerFrame, mapResult.allocationsPerFrame,
+               ringResult.nsPerFrame, ringResult.allocationsPerFrame);
+    }
+    return 0;
+}
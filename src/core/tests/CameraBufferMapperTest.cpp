@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks when CameraBufferMapper drops its cached DMA buffer mappings. A memfd
+// stands in for the dma-buf, its mappings are counted in /proc/self/maps.
+
+#include <linux/videodev2.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <memory>
+
+#include "CameraBuffer.h"
+
+using icamera::CameraBuffer;
+using icamera::CameraBufferMapper;
+using icamera::camera_buffer_t;
+
+namespace {
+
+const char kBufferName[] = "camhal-mapper-test";
+const int kBufferSize = 64 * 1024;
+const int kCameraId = 0;
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+int countMappings() {
+    FILE* maps = fopen("/proc/self/maps", "r");
+    if (maps == nullptr) {
+        return -1;
+    }
+    int count = 0;
+    char line[512];
+    while (fgets(line, sizeof(line), maps) != nullptr) {
+        if (strstr(line, kBufferName) != nullptr) {
+            count++;
+        }
+    }
+    fclose(maps);
+    return count;
+}
+
+int createFd() {
+    const int fd = static_cast<int>(syscall(SYS_memfd_create, kBufferName, 0));
+    if (fd >= 0 && ftruncate(fd, kBufferSize) != 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+std::shared_ptr<CameraBuffer> wrap(camera_buffer_t* ubuffer, int fd) {
+    memset(ubuffer, 0, sizeof(*ubuffer));
+    ubuffer->s.memType = V4L2_MEMORY_DMABUF;
+    ubuffer->s.size = kBufferSize;
+    ubuffer->dmafd = fd;
+    return CameraBuffer::create(V4L2_MEMORY_DMABUF, kBufferSize, 0, ubuffer);
+}
+
+// The mapping is reused for each frame, and dropped with its CameraBuffer
+void testOwnerDestroyed() {
+    const int fd = createFd();
+    camera_buffer_t ubuffer;
+    std::shared_ptr<CameraBuffer> buffer = wrap(&ubuffer, fd);
+
+    void* first = nullptr;
+    {
+        CameraBufferMapper mapper(kCameraId, buffer);
+        first = mapper.addr();
+        static_cast<char*>(first)[0] = 1;
+    }
+    {
+        CameraBufferMapper mapper(kCameraId, buffer);
+        expect(mapper.addr() == first, "the mapping is reused");
+    }
+    expect(countMappings() == 1, "the idle mapping is cached");
+
+    buffer.reset();
+    expect(countMappings() == 0, "the mapping is dropped with its buffer");
+    close(fd);
+}
+
+// A mapping in use when its owner goes away is unmapped by the last user
+void testOwnerDestroyedInUse() {
+    const int fd = createFd();
+    camera_buffer_t ubuffer;
+    std::shared_ptr<CameraBuffer> owner = wrap(&ubuffer, fd);
+    camera_buffer_t other;
+    std::shared_ptr<CameraBuffer> user = wrap(&other, fd);
+
+    {
+        CameraBufferMapper mapper(kCameraId, owner);
+    }
+    {
+        CameraBufferMapper mapper(kCameraId, user);
+        // The owner is now the second buffer, destroying the first one is a no-op
+        owner.reset();
+        expect(countMappings() == 1, "a mapping of another owner is kept");
+        user.reset();
+        expect(countMappings() == 1, "a mapping in use is not unmapped");
+    }
+    expect(countMappings() == 0, "the last user unmaps the dropped mapping");
+    close(fd);
+}
+
+// Reconfiguring the streams releases the mappings of the camera
+void testReleaseCache() {
+    const int fd = createFd();
+    camera_buffer_t ubuffer;
+    std::shared_ptr<CameraBuffer> buffer = wrap(&ubuffer, fd);
+    {
+        CameraBufferMapper mapper(kCameraId, buffer);
+    }
+    CameraBufferMapper::releaseCache(kCameraId + 1);
+    expect(countMappings() == 1, "another camera keeps its mappings");
+    CameraBufferMapper::releaseCache(kCameraId);
+    expect(countMappings() == 0, "the camera mappings are released");
+    close(fd);
+}
+
+}  // namespace
+
+int main() {
+    testOwnerDestroyed();
+    testOwnerDestroyedInUse();
+    testReleaseCache();
+
+    if (gFailures == 0) {
+        printf("CameraBufferMapperTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
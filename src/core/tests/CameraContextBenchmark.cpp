@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Counts CameraContext::getDataContextBySeq() lookups of the recent
+// sequences on 1, 2, 4 and 8 reader threads, while the request thread
+// acquires a DataContext every 500 us. Prints millions of lookups per second
+// of all readers.
+//
+// The DataContexts are initialized from PlatformData, a camera must be in
+// the config files of CAMERA_CFG_PATH.
+//
+// Usage: CameraContextBenchmark [milliseconds]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "CameraContext.h"
+#include "PlatformData.h"
+
+using icamera::CameraContext;
+using icamera::DataContext;
+
+namespace {
+
+double run(int readerNum, int milliseconds) {
+    CameraContext context(0);
+    std::atomic<int64_t> latest(-1);
+    std::atomic<bool> stop(false);
+
+    std::thread writer([&]() {
+        for (int64_t fn = 0; !stop; fn++) {
+            DataContext* dataContext = context.acquireDataContext();
+            context.updateDataContextMapByFn(fn, dataContext);
+            context.updateDataContextMapBySeq(fn, dataContext);
+            context.updateDataContextMapByCcaId(fn, dataContext);
+            latest.store(fn, std::memory_order_release);
+            std::this_thread::sleep_for(std::chrono::microseconds(500));
+        }
+    });
+    while (latest.load(std::memory_order_acquire) < 50) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    std::atomic<uint64_t> total(0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < readerNum; t++) {
+        readers.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            uint64_t count = 0;
+            uint64_t found = 0;
+            while (!stop) {
+                for (int i = 0; i < 256; i++) {
+                    const int64_t seq = latest.load(std::memory_order_relaxed) - (rng() % 30);
+                    found += (context.getDataContextBySeq(seq)->mSequence == seq) ? 1 : 0;
+                }
+                count += 256;
+            }
+            if (found > count) printf("unreachable\n");  // Keeps the lookups
+            total += count;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+    stop = true;
+    for (auto& reader : readers) reader.join();
+    writer.join();
+
+    return static_cast<double>(total) / milliseconds / 1000.0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int milliseconds = (argc > 1) ? atoi(argv[1]) : 1000;
+    if (milliseconds <= 0) {
+        fprintf(stderr, "Usage: %s [milliseconds]\n", argv[0]);
+        return 1;
+    }
+
+    // The sensors of the config files are taken without a media device
+    setenv("cameraInjectFile", "/dev/null", 0);
+    if (icamera::PlatformData::numberOfCameras() == 0) {
+        fprintf(stderr, "No camera in the config files\n");
+        return 1;
+    }
+
+    const int readerNums[] = {1, 2, 4, 8};
+    for (int readerNum : readerNums) {
+        printf("%d readers: %7.1f M lookups/s\n", readerNum, run(readerNum, milliseconds));
+    }
+    return 0;
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks the DataContext lookups of CameraContext by frame number, sequence
+// and CCA id: the ids of the last MAX_SETTING_COUNT DataContexts are found,
+// also when they share an entry of the id index, the ids of a reused
+// DataContext are evicted, a sequence without DataContext gets the newest one
+// before it, and reset() forgets all ids. Then reader threads look up recent
+// sequences while the request thread acquires DataContexts.
+//
+// The DataContexts are initialized from PlatformData, the test returns 77,
+// its skip code, when no camera is configured.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "CameraContext.h"
+#include "PlatformData.h"
+
+using icamera::CameraContext;
+using icamera::DataContext;
+
+namespace {
+
+const int kSkipped = 77;
+const int kCameraId = 0;
+const int64_t kContextSize = MAX_SETTING_COUNT;
+// The size of the id index of CameraContext
+const int64_t kIdIndexSize = 64;
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what, int64_t id) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s, id %ld\n", what, static_cast<long>(id));
+        gFailures++;
+    }
+}
+
+// Like the request and the result threads, sequence is 2 * fn and CCA id is fn + 1000
+DataContext* addRequest(CameraContext* context, int64_t fn) {
+    DataContext* dataContext = context->acquireDataContext();
+    context->updateDataContextMapByFn(fn, dataContext);
+    context->updateDataContextMapBySeq(fn * 2, dataContext);
+    context->updateDataContextMapByCcaId(fn + 1000, dataContext);
+    return dataContext;
+}
+
+void testEviction() {
+    CameraContext context(kCameraId);
+    const int64_t requests = kContextSize * 2 + 5;
+    std::vector<DataContext*> dataContexts;
+    for (int64_t fn = 0; fn < requests; fn++) {
+        dataContexts.push_back(addRequest(&context, fn));
+    }
+
+    for (int64_t fn = requests - kContextSize; fn < requests; fn++) {
+        DataContext* dataContext = dataContexts[fn];
+        expect(context.acquireDataContextByFn(fn) == dataContext, "found by fn", fn);
+        expect(context.getDataContextBySeq(fn * 2) == dataContext, "found by seq", fn * 2);
+        expect(context.checkUserRequestBySeq(fn * 2), "a user request", fn * 2);
+        expect(context.getDataContextByCcaId(fn + 1000) == dataContext, "found by CCA id",
+               fn + 1000);
+        expect(dataContext->mFrameNumber == fn && dataContext->mSequence == fn * 2 &&
+                   dataContext->mCcaId == fn + 1000,
+               "the ids of the DataContext", fn);
+
+        // A sequence without request gets the DataContext of the sequence before it
+        expect(context.getDataContextBySeq(fn * 2 + 1) == dataContext, "the sequence before",
+               fn * 2 + 1);
+        expect(!context.checkUserRequestBySeq(fn * 2 + 1), "not a user request", fn * 2 + 1);
+    }
+
+    // The DataContexts of these requests are reused
+    DataContext* latest = dataContexts[requests - 1];
+    for (int64_t fn = 0; fn < requests - kContextSize; fn++) {
+        expect(context.acquireDataContextByFn(fn)->mFrameNumber != fn, "evicted fn", fn);
+        expect(!context.checkUserRequestBySeq(fn * 2), "evicted seq", fn * 2);
+        expect(context.getDataContextByCcaId(fn + 1000) == nullptr, "evicted CCA id",
+               fn + 1000);
+    }
+    const int64_t evictedSeq = (requests - kContextSize - 1) * 2;
+    expect(context.getDataContextBySeq(evictedSeq) == latest,
+           "a sequence older than all gets the latest", evictedSeq);
+    expect(context.getDataContextBySeq(requests * 2 + 10) == latest,
+           "a newer sequence gets the latest", requests * 2 + 10);
+
+    context.reset();
+    for (int64_t fn = requests - kContextSize; fn < requests; fn++) {
+        expect(!context.checkUserRequestBySeq(fn * 2), "no seq after reset", fn * 2);
+        expect(context.getDataContextByCcaId(fn + 1000) == nullptr, "no CCA id after reset",
+               fn + 1000);
+    }
+}
+
+// Ids which differ by kIdIndexSize take the same entry of the id index
+void testSharedIndexEntry() {
+    CameraContext context(kCameraId);
+    std::vector<DataContext*> dataContexts;
+    for (int64_t i = 0; i < kContextSize; i++) {
+        DataContext* dataContext = context.acquireDataContext();
+        const int64_t id = (i % 4) + (i / 4) * kIdIndexSize;
+        context.updateDataContextMapBySeq(id, dataContext);
+        context.updateDataContextMapByCcaId(id, dataContext);
+        dataContexts.push_back(dataContext);
+    }
+
+    for (int64_t i = 0; i < kContextSize; i++) {
+        const int64_t id = (i % 4) + (i / 4) * kIdIndexSize;
+        expect(context.getDataContextBySeq(id) == dataContexts[i], "a shared entry by seq", id);
+        expect(context.getDataContextByCcaId(id) == dataContexts[i], "a shared entry by CCA id",
+               id);
+    }
+
+    // A new sequence of a DataContext replaces its old one
+    context.updateDataContextMapBySeq(5000, dataContexts[0]);
+    expect(!context.checkUserRequestBySeq(0), "the old sequence is replaced", 0);
+    expect(context.getDataContextBySeq(5000) == dataContexts[0], "the new sequence", 5000);
+}
+
+void testReprocessing() {
+    CameraContext context(kCameraId);
+    for (int64_t fn = 0; fn < 10; fn++) {
+        addRequest(&context, fn)->mFaceDetectMode = static_cast<uint8_t>(fn);
+    }
+
+    DataContext* found = context.getReprocessingDataContextBySeq(8);
+    expect(found != nullptr && found->mSequence == 8, "reprocess a known sequence", 8);
+
+    // A missing sequence gets a new DataContext with the settings of the nearest one before it
+    DataContext* created = context.getReprocessingDataContextBySeq(13);
+    expect(created != nullptr && created->mSequence == 13 && created->mFaceDetectMode == 6,
+           "reprocess a missing sequence", 13);
+    expect(context.checkUserRequestBySeq(13), "the reprocessing sequence is added", 13);
+    expect(context.getDataContextBySeq(13) == created, "found by the reprocessing sequence", 13);
+}
+
+void testReadersDuringRequests(int seconds, int readerNum) {
+    CameraContext context(kCameraId);
+    std::atomic<int64_t> latestFn(-1);
+    std::atomic<bool> stop(false);
+    std::atomic<long> lookups(0);
+    std::atomic<long> wrong(0);
+
+    std::thread writer([&]() {
+        for (int64_t fn = 0; !stop; fn++) {
+            addRequest(&context, fn);
+            latestFn.store(fn, std::memory_order_release);
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    });
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < readerNum; t++) {
+        readers.emplace_back([&]() {
+            long count = 0;
+            while (!stop) {
+                const int64_t latest = latestFn.load(std::memory_order_acquire);
+                if (latest < kContextSize) continue;
+                const int64_t fn = latest - (count % 8);
+                const DataContext* bySeq = context.getDataContextBySeq(fn * 2);
+                const DataContext* byCcaId = context.getDataContextByCcaId(fn + 1000);
+                const int64_t sequence = bySeq->mSequence;
+                count++;
+                // A reader preempted for a ring period gets reused DataContexts
+                if (latestFn.load(std::memory_order_acquire) - latest >= kContextSize / 2) {
+                    continue;
+                }
+                if ((sequence != fn * 2) || (byCcaId != bySeq)) wrong++;
+            }
+            lookups += count;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    stop = true;
+    writer.join();
+    for (auto& reader : readers) reader.join();
+
+    printf("%d readers, %ld lookups, %ld wrong\n", readerNum, lookups.load(), wrong.load());
+    expect(lookups > 0, "the readers ran", latestFn);
+    expect(wrong == 0, "the DataContext of the sequence", latestFn);
+}
+
+}  // namespace
+
+int main() {
+    // The sensors of the config files are taken without a media device
+    setenv("cameraInjectFile", "/dev/null", 0);
+    if (icamera::PlatformData::numberOfCameras() == 0) {
+        printf("CameraContextTest skipped, no camera in the config files\n");
+        return kSkipped;
+    }
+
+    testEviction();
+    testSharedIndexEntry();
+    testReprocessing();
+    testReadersDuringRequests(1, 4);
+
+    if (gFailures == 0) {
+        printf("CameraContextTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times EventSource::notifyListeners() for SOF: while a 2 ms stats listener
+// runs on another thread, with a 2 ms listener of SOF itself delivered
+// asynchronously, and the cost of a dispatch to 3 listeners on 1 and 4
+// threads.
+//
+// Usage: CameraEventBenchmark [notifications]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "CameraEvent.h"
+
+using icamera::EventData;
+using icamera::EventListener;
+using icamera::EventSource;
+using icamera::EventType;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double elapsedUs(const Clock::time_point& start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+EventData makeEvent(EventType type) {
+    EventData eventData;
+    eventData.type = type;
+    return eventData;
+}
+
+class FastListener : public EventListener {
+ public:
+    void handleEvent(const EventData& eventData) override { mEvents++; }
+
+    std::atomic<int> mEvents{0};
+};
+
+class SlowListener : public EventListener {
+ public:
+    explicit SlowListener(bool async) {
+        if (async) enableAsyncDelivery("SlowListener", 64);
+    }
+    ~SlowListener() { disableAsyncDelivery(); }
+
+    void handleEvent(const EventData& eventData) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+};
+
+void report(const char* name, std::vector<double>* latencies) {
+    std::sort(latencies->begin(), latencies->end());
+    printf("%-44s p50 %9.2f us, p99 %9.2f us, max %9.2f us\n", name,
+           (*latencies)[latencies->size() / 2], (*latencies)[latencies->size() * 99 / 100],
+           latencies->back());
+}
+
+void sofWithSlowStatsListener(int notifications) {
+    EventSource source;
+    FastListener sof;
+    SlowListener stats(false);
+    source.registerListener(icamera::EVENT_ISYS_SOF, &sof);
+    source.registerListener(icamera::EVENT_PSYS_STATS_BUF_READY, &stats);
+
+    std::atomic<bool> running(true);
+    std::thread statsThread([&source, &running]() {
+        while (running) source.notifyListeners(makeEvent(icamera::EVENT_PSYS_STATS_BUF_READY));
+    });
+    std::vector<double> latencies;
+    for (int i = 0; i < notifications; i++) {
+        const Clock::time_point start = Clock::now();
+        source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF));
+        latencies.push_back(elapsedUs(start));
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    running = false;
+    statsThread.join();
+    report("SOF, slow stats listener on another thread", &latencies);
+
+    source.removeListener(icamera::EVENT_ISYS_SOF, &sof);
+    source.removeListener(icamera::EVENT_PSYS_STATS_BUF_READY, &stats);
+}
+
+void sofWithSlowAsyncListener(int notifications) {
+    EventSource source;
+    FastListener sof;
+    SlowListener slow(true);
+    source.registerListener(icamera::EVENT_ISYS_SOF, &sof);
+    source.registerListener(icamera::EVENT_ISYS_SOF, &slow);
+
+    std::vector<double> latencies;
+    for (int i = 0; i < notifications; i++) {
+        const Clock::time_point start = Clock::now();
+        source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF));
+        latencies.push_back(elapsedUs(start));
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+    report("SOF, slow asynchronous listener of SOF", &latencies);
+
+    source.removeListener(icamera::EVENT_ISYS_SOF, &sof);
+    source.removeListener(icamera::EVENT_ISYS_SOF, &slow);
+}
+
+void dispatchCost(int notifications) {
+    EventSource source;
+    FastListener listeners[3];
+    for (auto& listener : listeners) source.registerListener(icamera::EVENT_ISYS_SOF, &listener);
+    const EventData sof = makeEvent(icamera::EVENT_ISYS_SOF);
+
+    for (int threadNum : {1, 4}) {
+        std::vector<std::thread> threads;
+        const Clock::time_point start = Clock::now();
+        for (int t = 0; t < threadNum; t++) {
+            threads.emplace_back([&source, &sof, notifications, threadNum]() {
+                for (int i = 0; i < notifications / threadNum; i++) source.notifyListeners(sof);
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        printf("%-44s %7.1f ns per notification on %d thread(s)\n", "SOF to 3 listeners",
+               elapsedUs(start) * 1000 / notifications, threadNum);
+    }
+
+    for (auto& listener : listeners) source.removeListener(icamera::EVENT_ISYS_SOF, &listener);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int notifications = (argc > 1) ? atoi(argv[1]) : 1000;
+    if (notifications <= 0) {
+        fprintf(stderr, "Usage: %s [notifications]\n", argv[0]);
+        return 1;
+    }
+
+    sofWithSlowStatsListener(notifications);
+    sofWithSlowAsyncListener(notifications / 2);
+    dispatchCost(notifications * 1000);
+    return 0;
+}
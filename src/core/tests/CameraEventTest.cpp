@@ -0,0 +1,257 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks that EventSource dispatches without holding its listener lock: a
+// handleEvent blocked on one thread doesn't block the notifications of the
+// other threads, removeListener() returns only once no dispatch can call the
+// listener any more, and a listener can remove itself in handleEvent. Then
+// runs threads that notify while others register, remove and delete
+// listeners, with asynchronous ones among them.
+
+#include <stdio.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "CameraEvent.h"
+
+using icamera::EventData;
+using icamera::EventListener;
+using icamera::EventSource;
+using icamera::EventType;
+
+namespace {
+
+const int kMagic = 0x1234;
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+EventData makeEvent(EventType type) {
+    EventData eventData;
+    eventData.type = type;
+    return eventData;
+}
+
+// Holds the threads that pass it until it is opened
+class Gate {
+ public:
+    Gate() : mOpen(false), mWaiters(0) {}
+
+    void pass() {
+        std::unique_lock<std::mutex> l(mLock);
+        mWaiters++;
+        mCondition.notify_all();
+        mCondition.wait(l, [this]() { return mOpen; });
+    }
+    void waitForWaiter() {
+        std::unique_lock<std::mutex> l(mLock);
+        mCondition.wait(l, [this]() { return mWaiters > 0; });
+    }
+    void open() {
+        std::lock_guard<std::mutex> l(mLock);
+        mOpen = true;
+        mCondition.notify_all();
+    }
+
+ private:
+    std::mutex mLock;
+    std::condition_variable mCondition;
+    bool mOpen;
+    int mWaiters;
+};
+
+class CountingListener : public EventListener {
+ public:
+    explicit CountingListener(Gate* gate = nullptr) : mGate(gate), mMagic(kMagic), mEvents(0) {}
+    ~CountingListener() { mMagic = 0; }
+
+    void handleEvent(const EventData& eventData) override {
+        if (mMagic != kMagic) gFailures++;
+        if (mGate != nullptr) mGate->pass();
+        mEvents++;
+    }
+
+    Gate* mGate;
+    int mMagic;
+    std::atomic<int> mEvents;
+};
+
+class AsyncListener : public CountingListener {
+ public:
+    AsyncListener(Gate* gate, size_t queueDepth) : CountingListener(gate) {
+        enableAsyncDelivery("AsyncListener", queueDepth);
+    }
+    ~AsyncListener() { disableAsyncDelivery(); }
+};
+
+void testBlockedListenerDoesNotBlockOthers() {
+    EventSource source;
+    Gate gate;
+    CountingListener slow(&gate);
+    CountingListener sof;
+    source.registerListener(icamera::EVENT_PSYS_STATS_BUF_READY, &slow);
+    source.registerListener(icamera::EVENT_ISYS_SOF, &sof);
+
+    std::thread stats(
+        [&source]() { source.notifyListeners(makeEvent(icamera::EVENT_PSYS_STATS_BUF_READY)); });
+    gate.waitForWaiter();
+    // Returns while the stats listener is still in handleEvent
+    source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF));
+    expect(sof.mEvents == 1, "SOF is dispatched while another listener is blocked");
+    gate.open();
+    stats.join();
+    expect(slow.mEvents == 1, "the blocked listener gets its event");
+
+    source.removeListener(icamera::EVENT_PSYS_STATS_BUF_READY, &slow);
+    source.removeListener(icamera::EVENT_ISYS_SOF, &sof);
+}
+
+void testRemoveWaitsForDispatch() {
+    EventSource source;
+    Gate gate;
+    CountingListener listener(&gate);
+    source.registerListener(icamera::EVENT_ISYS_SOF, &listener);
+
+    std::thread notifier(
+        [&source]() { source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF)); });
+    gate.waitForWaiter();
+
+    std::atomic<bool> removed(false);
+    std::thread remover([&source, &listener, &removed]() {
+        source.removeListener(icamera::EVENT_ISYS_SOF, &listener);
+        removed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    expect(!removed, "removeListener waits for the dispatch in progress");
+    gate.open();
+    remover.join();
+    notifier.join();
+    expect(listener.mEvents == 1, "the dispatch in progress finishes");
+
+    source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF));
+    expect(listener.mEvents == 1, "a removed listener gets no event");
+}
+
+class SelfRemovingListener : public EventListener {
+ public:
+    explicit SelfRemovingListener(EventSource* source) : mSource(source), mEvents(0) {}
+
+    void handleEvent(const EventData& eventData) override {
+        mEvents++;
+        mSource->removeListener(eventData.type, this);
+    }
+
+    EventSource* mSource;
+    int mEvents;
+};
+
+void testRemoveInHandleEvent() {
+    EventSource source;
+    SelfRemovingListener listener(&source);
+    CountingListener other;
+    source.registerListener(icamera::EVENT_ISYS_SOF, &listener);
+    source.registerListener(icamera::EVENT_ISYS_SOF, &other);
+
+    source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF));
+    source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF));
+    expect(listener.mEvents == 1, "a listener can remove itself in handleEvent");
+    expect(other.mEvents == 2, "the other listeners keep their events");
+    source.removeListener(icamera::EVENT_ISYS_SOF, &other);
+}
+
+void testAsyncDeliveryDrops() {
+    EventSource source;
+    Gate gate;
+    AsyncListener listener(&gate, 2);
+    source.registerListener(icamera::EVENT_ISYS_SOF, &listener);
+
+    // One event in handleEvent, two queued, the others dropped
+    source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF));
+    gate.waitForWaiter();
+    for (int i = 0; i < 5; i++) {
+        source.notifyListeners(makeEvent(icamera::EVENT_ISYS_SOF));
+    }
+    gate.open();
+    for (int i = 0; i < 1000 && listener.mEvents < 3; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    expect(listener.mEvents == 3, "the events beyond the queue depth are dropped");
+    source.removeListener(icamera::EVENT_ISYS_SOF, &listener);
+}
+
+// A deleted listener that is still called fails its magic check
+void testConcurrentRemoveAndDelete() {
+    const EventType types[] = {icamera::EVENT_ISYS_SOF, icamera::EVENT_PSYS_STATS_BUF_READY,
+                               icamera::EVENT_ISYS_FRAME};
+    EventSource source;
+    std::atomic<bool> running(true);
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < 3; t++) {
+        threads.emplace_back([&source, &running, &types]() {
+            int i = 0;
+            while (running) {
+                source.notifyListeners(makeEvent(types[i++ % 3]));
+            }
+        });
+    }
+    for (int t = 0; t < 2; t++) {
+        threads.emplace_back([&source, &running, &types, t]() {
+            std::mt19937 rng(t);
+            while (running) {
+                CountingListener* listener = ((rng() % 3) == 0)
+                                                 ? new AsyncListener(nullptr, 4)
+                                                 : new CountingListener();
+                const EventType type = types[rng() % 3];
+                source.registerListener(type, listener);
+                std::this_thread::sleep_for(std::chrono::microseconds(rng() % 200));
+                source.removeListener(type, listener);
+                delete listener;
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    running = false;
+    for (auto& thread : threads) thread.join();
+}
+
+}  // namespace
+
+int main() {
+    testBlockedListenerDoesNotBlockOthers();
+    testRemoveWaitsForDispatch();
+    testRemoveInHandleEvent();
+    testAsyncDeliveryDrops();
+    testConcurrentRemoveAndDelete();
+
+    if (gFailures == 0) {
+        printf("CameraEventTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
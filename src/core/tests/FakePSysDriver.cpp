@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// The fortified open() of fcntl.h is an inline function, it can't be replaced
+#undef _FORTIFY_SOURCE
+
+#include "FakePSysDriver.h"
+
+#include <fcntl.h>
+#include <stdarg.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <atomic>
+
+namespace icamera {
+namespace FakePSysDriver {
+
+// DRIVER_NAME of PSysDevice.cpp
+static const char* kDriverName = "/dev/ipu7-psys0";
+
+static std::atomic<int> sFd(-1);
+static bool sRecording = true;
+static int sTaskRequestCount = 0;
+static std::vector<TaskRequest> sTaskRequests;
+
+void setRecording(bool recording) {
+    sRecording = recording;
+}
+
+int getTaskRequestCount() {
+    return sTaskRequestCount;
+}
+
+std::vector<TaskRequest> takeTaskRequests() {
+    std::vector<TaskRequest> requests;
+    requests.swap(sTaskRequests);
+    return requests;
+}
+
+static int openFile(const char* pathname, int flags, mode_t mode) {
+    if (strcmp(pathname, kDriverName) == 0) {
+        const int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        sFd = fd;
+        return fd;
+    }
+    return static_cast<int>(syscall(SYS_openat, AT_FDCWD, pathname, flags, mode));
+}
+
+// PSysDevice casts the requests to int, the driver takes them as unsigned int
+static int psysIoctl(unsigned int request, void* arg) {
+    if (request == IPU_IOC_GRAPH_OPEN) {
+        static_cast<ipu_psys_graph_info*>(arg)->graph_id = kGraphId;
+    } else if (request == IPU_IOC_TASK_REQUEST) {
+        sTaskRequestCount++;
+        if (sRecording) {
+            const ipu_psys_task_request* taskRequest = static_cast<ipu_psys_task_request*>(arg);
+            TaskRequest record;
+            record.request = *taskRequest;
+            record.termBuffers.assign(taskRequest->task_buffers,
+                                      taskRequest->task_buffers + taskRequest->term_buf_count);
+            sTaskRequests.push_back(record);
+        }
+    }
+    return 0;
+}
+
+}  // namespace FakePSysDriver
+}  // namespace icamera
+
+using icamera::FakePSysDriver::openFile;
+using icamera::FakePSysDriver::psysIoctl;
+using icamera::FakePSysDriver::sFd;
+
+extern "C" int open(const char* pathname, int flags, ...) {
+    va_list ap;
+    va_start(ap, flags);
+    const mode_t mode = ((flags & O_CREAT) != 0) ? va_arg(ap, mode_t) : 0;
+    va_end(ap);
+    return openFile(pathname, flags, mode);
+}
+
+extern "C" int open64(const char* pathname, int flags, ...) {
+    va_list ap;
+    va_start(ap, flags);
+    const mode_t mode = ((flags & O_CREAT) != 0) ? va_arg(ap, mode_t) : 0;
+    va_end(ap);
+    return openFile(pathname, flags, mode);
+}
+
+extern "C" int ioctl(int fd, unsigned long request, ...) noexcept {
+    va_list ap;
+    va_start(ap, request);
+    void* arg = va_arg(ap, void*);
+    va_end(ap);
+
+    if ((fd >= 0) && (fd == sFd)) {
+        return psysIoctl(static_cast<unsigned int>(request), arg);
+    }
+    return static_cast<int>(syscall(SYS_ioctl, fd, request, arg));
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "modules/ipu_desc/ipu-psys.h"
+
+namespace icamera {
+
+/**
+ * The PSYS driver of the PSysDevice tests.
+ *
+ * PSysDevice opens the driver and calls ioctl() without SysCall, so the test
+ * executables linking FakePSysDriver.cpp replace open() and ioctl() of libc.
+ * The PSYS node is opened as an eventfd which never has events, its ioctls
+ * succeed and the task requests are recorded. Other files go to the kernel.
+ */
+namespace FakePSysDriver {
+
+// The graph id returned by IPU_IOC_GRAPH_OPEN
+static const uint8_t kGraphId = 3;
+
+struct TaskRequest {
+    ipu_psys_task_request request;
+    std::vector<ipu_psys_term_buffers> termBuffers;  // The term_buf_count buffers
+};
+
+// Record the task requests, or only count them when it's false
+void setRecording(bool recording);
+int getTaskRequestCount();
+// The task requests recorded since the last call
+std::vector<TaskRequest> takeTaskRequests();
+
+}  // namespace FakePSysDriver
+}  // namespace icamera
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Runs IpuPacAdaptor on MockIntelCca and checks the per stream locking: the
+// video AIC and stats decode go on while a still AIC is held in the CCA,
+// deinit() waits for the AIC in progress, a sequence runs once per stream,
+// and getAllBuffers() returns the terminals of the requested sequence from
+// the result ring until it is overwritten.
+//
+// PlatformData is loaded from CAMERA_CFG_PATH with the sensors taken
+// without probing (cameraInjectFile), it returns 77, the skip code of the
+// test, when no camera is configured.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "CameraContext.h"
+#include "IpuPacAdaptor.h"
+#include "MockIntelCca.h"
+#include "PlatformData.h"
+
+using icamera::AiqResult;
+using icamera::AiqResultStorage;
+using icamera::IpuPacAdaptor;
+using icamera::MockIntelCca;
+using icamera::PacTerminalBufMap;
+using icamera::STILL_STREAM_ID;
+using icamera::VIDEO_STREAM_ID;
+
+namespace {
+
+const int kSkipped = 77;
+const int kCameraId = 0;
+const uint8_t kContextId = 0;
+const uint8_t kTerminalId = 1;
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+// Waits up to 2 s for done, the calls under test take far less
+bool waitFor(const std::atomic<bool>& done) {
+    for (int i = 0; i < 2000 && !done; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return done;
+}
+
+void storeAiqResults(int64_t first, int64_t last) {
+    AiqResultStorage* storage =
+        icamera::CameraContext::getInstance(kCameraId)->getAiqResultStorage();
+    for (int64_t sequence = first; sequence <= last; sequence++) {
+        AiqResult* result = storage->acquireAiqResult();
+        result->mSequence = sequence;
+        result->mFrameId = sequence;
+        storage->updateAiqResult(sequence);
+    }
+}
+
+void testStillAicDoesNotBlockVideo(IpuPacAdaptor* adaptor, MockIntelCca* cca) {
+    cca->holdRuns(STILL_STREAM_ID);
+    std::thread still([adaptor]() { adaptor->runAIC(nullptr, 1, STILL_STREAM_ID); });
+    cca->waitForHeldRun();
+
+    std::atomic<bool> videoDone(false);
+    std::thread video([adaptor, &videoDone]() {
+        adaptor->runAIC(nullptr, 1, VIDEO_STREAM_ID);
+        adaptor->decodeStats(VIDEO_STREAM_ID, kContextId, 1, 0);
+        videoDone = true;
+    });
+    expect(waitFor(videoDone), "the video AIC and decode run while a still AIC is held");
+
+    cca->releaseRuns();
+    still.join();
+    video.join();
+    expect(cca->getRunCount(STILL_STREAM_ID) == 1, "the still AIC runs");
+}
+
+void testRunOncePerSequence(IpuPacAdaptor* adaptor, MockIntelCca* cca) {
+    const int runs = cca->getRunCount(VIDEO_STREAM_ID);
+    expect(adaptor->runAIC(nullptr, 2, VIDEO_STREAM_ID) == icamera::OK, "run sequence 2");
+    expect(adaptor->runAIC(nullptr, 2, VIDEO_STREAM_ID) == icamera::OK, "run sequence 2 again");
+    expect(cca->getRunCount(VIDEO_STREAM_ID) == runs + 1, "a sequence runs once");
+}
+
+void testTerminalResultRing(IpuPacAdaptor* adaptor) {
+    PacTerminalBufMap terminals;
+    terminals[kTerminalId].size = 64;
+    expect(adaptor->setPacTerminalData(VIDEO_STREAM_ID, kContextId, terminals) == icamera::OK,
+           "set the terminal data");
+
+    const int64_t first = 10;
+    const int64_t last = first + MAX_SETTING_COUNT + 5;
+    for (int64_t sequence = first; sequence <= last; sequence++) {
+        adaptor->runAIC(nullptr, sequence, VIDEO_STREAM_ID);
+    }
+
+    PacTerminalBufMap result;
+    expect(adaptor->getAllBuffers(VIDEO_STREAM_ID, kContextId, last - 1, result) ==
+                   icamera::OK &&
+               result[kTerminalId].payloadPtr ==
+                   MockIntelCca::getPayload(VIDEO_STREAM_ID, last - 1),
+           "the terminals of a sequence");
+    result.clear();
+    expect(adaptor->getAllBuffers(VIDEO_STREAM_ID, kContextId, -1, result) == icamera::OK &&
+               result[kTerminalId].payloadPtr == MockIntelCca::getPayload(VIDEO_STREAM_ID, last),
+           "the terminals of the latest sequence");
+    expect(adaptor->getAllBuffers(VIDEO_STREAM_ID, kContextId, first, result) ==
+               icamera::INVALID_OPERATION,
+           "an overwritten sequence is not found");
+}
+
+void testDeinitWaitsForAic(IpuPacAdaptor* adaptor, MockIntelCca* cca) {
+    cca->holdRuns(STILL_STREAM_ID);
+    std::thread still([adaptor]() { adaptor->runAIC(nullptr, 100, STILL_STREAM_ID); });
+    cca->waitForHeldRun();
+
+    std::atomic<bool> deinitDone(false);
+    std::thread deinit([adaptor, &deinitDone]() {
+        adaptor->deinit();
+        deinitDone = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    expect(!deinitDone, "deinit waits for the AIC in progress");
+
+    cca->releaseRuns();
+    still.join();
+    deinit.join();
+    expect(adaptor->runAIC(nullptr, 101, VIDEO_STREAM_ID) != icamera::OK,
+           "no AIC runs after deinit");
+}
+
+}  // namespace
+
+int main() {
+    // The sensors of the config files are taken without a media device
+    setenv("cameraInjectFile", "/dev/null", 0);
+    if (icamera::PlatformData::numberOfCameras() == 0) {
+        printf("IpuPacAdaptorTest skipped, no camera in the config files\n");
+        return kSkipped;
+    }
+
+    MockIntelCca* cca = new MockIntelCca(kCameraId);
+    icamera::IntelCca::updateInstance(kCameraId, icamera::TUNING_MODE_VIDEO, cca);
+    storeAiqResults(0, 200);
+
+    IpuPacAdaptor adaptor(kCameraId);
+    expect(adaptor.init({VIDEO_STREAM_ID, STILL_STREAM_ID}) == icamera::OK, "init");
+    testStillAicDoesNotBlockVideo(&adaptor, cca);
+    testRunOncePerSequence(&adaptor, cca);
+    testTerminalResultRing(&adaptor);
+    testDeinitWaitsForAic(&adaptor, cca);
+
+    icamera::IntelCca::releaseInstance(kCameraId, icamera::TUNING_MODE_VIDEO);
+    icamera::CameraContext::releaseInstance(kCameraId);
+
+    if (gFailures == 0) {
+        printf("IpuPacAdaptorTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
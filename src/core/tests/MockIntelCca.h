@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "modules/algowrapper/IntelCca.h"
+
+namespace icamera {
+
+/**
+ * \class MockIntelCca
+ *
+ * The AIC calls of IpuPacAdaptor without the CCA library, installed with
+ * IntelCca::updateInstance() in a MODULE_TEST build.
+ * runAIC of a stream takes the time set by setRunTime(), or waits in holdRuns()
+ * until releaseRuns(). getAicBuf gives each terminal getPayload() of the last
+ * sequence run by the stream.
+ */
+class MockIntelCca : public IntelCca {
+ public:
+    explicit MockIntelCca(int cameraId)
+            : IntelCca(cameraId, TUNING_MODE_VIDEO),
+              mHeldStream(-1),
+              mHeldRuns(0) {}
+    ~MockIntelCca() {}
+
+    static void* getPayload(int32_t aicId, int64_t sequence) {
+        return reinterpret_cast<void*>((static_cast<uintptr_t>(aicId) << 20) +
+                                       static_cast<uintptr_t>(sequence) + 1U);
+    }
+
+    void setRunTime(int32_t aicId, std::chrono::microseconds runTime) {
+        std::lock_guard<std::mutex> l(mLock);
+        mRunTime[aicId] = runTime;
+    }
+
+    // Hold the runAIC calls of aicId, and wait until one of them is held
+    void holdRuns(int32_t aicId) {
+        std::lock_guard<std::mutex> l(mLock);
+        mHeldStream = aicId;
+    }
+    void waitForHeldRun() {
+        std::unique_lock<std::mutex> l(mLock);
+        mCondition.wait(l, [this]() { return mHeldRuns > 0; });
+    }
+    void releaseRuns() {
+        std::lock_guard<std::mutex> l(mLock);
+        mHeldStream = -1;
+        mCondition.notify_all();
+    }
+
+    int getRunCount(int32_t aicId) {
+        std::lock_guard<std::mutex> l(mLock);
+        return mRunCount[aicId];
+    }
+
+    void* allocMem(int streamId, const std::string& name, int index, int size) override {
+        return calloc(1, size);
+    }
+    void freeMem(void* addr) override { free(addr); }
+
+    ia_err reinitAic(const int32_t aicId) override { return ia_err_none; }
+    ia_err configAic(const cca::cca_aic_config& aicConf,
+                     const cca::cca_aic_kernel_offset& kernelOffset, uint32_t* offsetPtr,
+                     cca::cca_aic_terminal_config& termConfig, int32_t aicId,
+                     const int32_t* statsBufToTermIds) override {
+        return ia_err_none;
+    }
+    ia_err registerAicBuf(const cca::cca_aic_terminal_config& termConfig,
+                          int32_t aicId) override {
+        return ia_err_none;
+    }
+
+    ia_err getAicBuf(cca::cca_aic_terminal_config& termConfig, int32_t aicId) override {
+        int64_t sequence = -1;
+        {
+            std::lock_guard<std::mutex> l(mLock);
+            sequence = mLastSequence[aicId];
+        }
+        for (uint32_t i = 0U; i < termConfig.cb_num; i++) {
+            cca::cca_cb_termal_buf& cbBuf = termConfig.cb_terminal_buf[i];
+            for (uint32_t j = 0U; j < cbBuf.num_terminal; j++) {
+                aic::IaAicBuffer* payload = cbBuf.terminal_buf[j].payload;
+                payload->size = cbBuf.terminal_buf[j].buf_size;
+                payload->payloadPtr = getPayload(aicId, sequence);
+                payload->sequence = sequence;
+            }
+        }
+        return ia_err_none;
+    }
+
+    ia_err decodeStats(int32_t groupId, int64_t sequence, int32_t aicId,
+                       cca::cca_out_stats* outStats) override {
+        return ia_err_none;
+    }
+
+    ia_err runAIC(uint64_t frameId, const cca::cca_pal_input_params* params, uint8_t bitmap,
+                  int32_t aicId) override {
+        std::chrono::microseconds runTime(0);
+        {
+            std::unique_lock<std::mutex> l(mLock);
+            mRunCount[aicId]++;
+            mLastSequence[aicId] = params->seq_id;
+            if (mHeldStream == aicId) {
+                mHeldRuns++;
+                mCondition.notify_all();
+                mCondition.wait(l, [this, aicId]() { return mHeldStream != aicId; });
+                mHeldRuns--;
+            }
+            runTime = mRunTime[aicId];
+        }
+        std::this_thread::sleep_for(runTime);
+        return ia_err_none;
+    }
+
+    ia_err updateConfigurationResolutions(const cca::cca_aic_config& aicConf, int32_t aicId,
+                                          bool isKeyResChanged) override {
+        return ia_err_none;
+    }
+
+ private:
+    std::mutex mLock;  // for the members below
+    std::condition_variable mCondition;
+    int32_t mHeldStream;
+    int mHeldRuns;
+    std::map<int32_t, std::chrono::microseconds> mRunTime;
+    std::map<int32_t, int> mRunCount;
+    std::map<int32_t, int64_t> mLastSequence;
+};
+
+}  // namespace icamera
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times the submission of PSYS tasks of 12 terminals across 3 node contexts,
+// from filling PSysTask to the task request ioctl of FakePSysDriver, with the
+// same terminals in each task and with the terminals changed in every task,
+// which rebuilds the request template. Prints ns per task.
+//
+// Usage: PSysDeviceBenchmark [tasks]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "FakePSysDriver.h"
+#include "PSysDevice.h"
+#include "iutils/Errors.h"
+
+using icamera::PSysDevice;
+using icamera::PSysTask;
+using icamera::TerminalBuffer;
+namespace FakePSysDriver = icamera::FakePSysDriver;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+const int kTerminalNum = 12;
+const int kContextNum = 3;
+
+void run(PSysDevice* device, const TerminalBuffer* buffers, int tasks, bool changeTerminals) {
+    std::vector<double> ns;
+    ns.reserve(tasks);
+    for (int n = 0; n < tasks; n++) {
+        const Clock::time_point start = Clock::now();
+        PSysTask task;
+        task.nodeCtxId = static_cast<uint8_t>(n % kContextNum);
+        task.sequence = n;
+        // Rotating the terminals changes the order of their ids in each task
+        const int first = changeTerminals ? (n % kTerminalNum) : 0;
+        for (int i = 0; i < kTerminalNum; i++) {
+            const int t = (first + i) % kTerminalNum;
+            task.setTerminalBuffer(static_cast<uint8_t>(t * 2 + 1), buffers[t]);
+        }
+        device->addTask(task);
+        ns.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+    }
+
+    std::sort(ns.begin(), ns.end());
+    double sum = 0;
+    for (double v : ns) sum += v;
+    printf("%-20s mean %6.0f ns, p50 %6.0f ns, p99 %6.0f ns\n",
+           changeTerminals ? "changed terminals" : "same terminals", sum / tasks, ns[tasks / 2],
+           ns[static_cast<size_t>(tasks) * 99 / 100]);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int tasks = (argc > 1) ? atoi(argv[1]) : 200000;
+    if (tasks <= 0) {
+        fprintf(stderr, "Usage: %s [tasks]\n", argv[0]);
+        return 1;
+    }
+
+    PSysDevice device(0);
+    if (device.init() != icamera::OK) {
+        fprintf(stderr, "Failed to init the PSysDevice\n");
+        return 1;
+    }
+    FakePSysDriver::setRecording(false);
+
+    TerminalBuffer buffers[kTerminalNum];
+    memset(buffers, 0, sizeof(buffers));
+    for (int i = 0; i < kTerminalNum; i++) {
+        buffers[i].psysBuf.base.fd = 100 + i;
+        buffers[i].psysBuf.len = 4096U;
+    }
+
+    run(&device, buffers, tasks, false);
+    run(&device, buffers, tasks, true);
+    printf("%d task requests\n", FakePSysDriver::getTaskRequestCount());
+
+    device.deinit();
+    return 0;
+}
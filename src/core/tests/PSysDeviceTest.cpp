@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks the task requests PSysDevice::addTask() gives to the PSYS driver,
+// recorded by FakePSysDriver: the terminals are in the order they are set in
+// PSysTask, the buffers of each task are patched into the request template of
+// the node context, and the template is rebuilt when the terminals change,
+// per node context and after closeGraph().
+
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#include "FakePSysDriver.h"
+#include "PSysDevice.h"
+#include "iutils/Errors.h"
+
+using icamera::PSysDevice;
+using icamera::PSysGraph;
+using icamera::PSysTask;
+using icamera::TerminalBuffer;
+namespace FakePSysDriver = icamera::FakePSysDriver;
+
+namespace {
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+struct Terminal {
+    uint8_t id;
+    int fd;
+};
+
+TerminalBuffer makeBuffer(int fd) {
+    TerminalBuffer buf;
+    memset(&buf, 0, sizeof(buf));
+    buf.psysBuf.base.fd = fd;
+    buf.psysBuf.len = 4096U + static_cast<uint32_t>(fd);
+    buf.psysBuf.flags = IPU_BUFFER_FLAG_DMA_HANDLE;
+    return buf;
+}
+
+PSysTask makeTask(uint8_t ctxId, int64_t sequence, const std::vector<Terminal>& terminals) {
+    PSysTask task;
+    task.nodeCtxId = ctxId;
+    task.sequence = sequence;
+    for (const Terminal& terminal : terminals) {
+        task.setTerminalBuffer(terminal.id, makeBuffer(terminal.fd));
+    }
+    return task;
+}
+
+// Submits the task and checks the one request given to the driver
+void submit(PSysDevice* device, uint8_t ctxId, const std::vector<Terminal>& terminals,
+            const char* what) {
+    static int64_t sequence = 0;
+    expect(device->addTask(makeTask(ctxId, sequence++, terminals)) == icamera::OK, what);
+
+    const std::vector<FakePSysDriver::TaskRequest> requests = FakePSysDriver::takeTaskRequests();
+    expect(requests.size() == 1U, what);
+    if (requests.size() != 1U) return;
+
+    const FakePSysDriver::TaskRequest& taskRequest = requests[0];
+    expect(taskRequest.request.node_ctx_id == ctxId, what);
+    expect(taskRequest.request.term_buf_count == terminals.size(), what);
+    for (size_t i = 0; i < terminals.size() && i < taskRequest.termBuffers.size(); i++) {
+        const ipu_psys_term_buffers& termBuffer = taskRequest.termBuffers[i];
+        expect(termBuffer.term_id == terminals[i].id, what);
+        expect(termBuffer.term_buf.base.fd == terminals[i].fd, what);
+        expect(termBuffer.term_buf.len == 4096U + static_cast<uint32_t>(terminals[i].fd), what);
+    }
+}
+
+void testTemplate(PSysDevice* device) {
+    submit(device, 0, {{1, 10}, {2, 11}, {5, 12}}, "the first task builds the template");
+    submit(device, 0, {{1, 20}, {2, 21}, {5, 22}}, "the same terminals patch the buffers");
+    submit(device, 0, {{1, 30}, {5, 31}}, "less terminals rebuild the template");
+    submit(device, 0, {{5, 40}, {1, 41}}, "the terminals in another order");
+    submit(device, 0, {{5, 50}, {1, 51}, {7, 52}, {8, 53}}, "more terminals");
+
+    // Each node context has its own template
+    submit(device, 1, {{3, 60}}, "another node context");
+    submit(device, 0, {{5, 70}, {1, 71}, {7, 72}, {8, 73}}, "the template of context 0 is kept");
+    submit(device, 1, {{3, 80}}, "the template of context 1 is kept");
+}
+
+void testReplacedTerminal(PSysDevice* device) {
+    PSysTask task = makeTask(2, 100, {{4, 90}, {6, 91}});
+    expect(task.setTerminalBuffer(4, makeBuffer(92)), "replace the buffer of terminal 4");
+    expect(task.terminalCount == 2U, "a terminal is set once");
+    expect(device->addTask(task) == icamera::OK, "add the task with a replaced buffer");
+
+    const std::vector<FakePSysDriver::TaskRequest> requests = FakePSysDriver::takeTaskRequests();
+    expect(requests.size() == 1U && requests[0].termBuffers.size() == 2U &&
+               requests[0].termBuffers[0].term_buf.base.fd == 92,
+           "the replaced buffer is submitted");
+}
+
+void testFrameIdAndGraph(PSysDevice* device) {
+    PSysGraph graph;
+    expect(device->addGraph(graph) == icamera::OK, "add the graph");
+
+    // Frame ids count from 0 after the graph is closed, and wrap after 255
+    expect(device->closeGraph() == icamera::OK, "close the graph");
+    expect(device->addGraph(graph) == icamera::OK, "add the graph again");
+    for (int i = 0; i < 258; i++) {
+        expect(device->addTask(makeTask(3, 1000 + i, {{1, 200}})) == icamera::OK, "add a task");
+    }
+    const std::vector<FakePSysDriver::TaskRequest> requests = FakePSysDriver::takeTaskRequests();
+    expect(requests.size() == 258U, "all tasks are submitted");
+    for (size_t i = 0; i < requests.size(); i++) {
+        expect(requests[i].request.graph_id == FakePSysDriver::kGraphId, "the graph id");
+        expect(requests[i].request.frame_id == i % 256U, "the frame id");
+    }
+
+    // The terminals are the same as before closeGraph(), the template is rebuilt anyway
+    expect(device->closeGraph() == icamera::OK, "close the graph again");
+    submit(device, 0, {{5, 300}, {1, 301}, {7, 302}, {8, 303}}, "a task after closeGraph()");
+}
+
+void testInvalidContext(PSysDevice* device) {
+    expect(device->addTask(makeTask(MAX_GRAPH_NODES, 0, {{1, 1}})) == icamera::BAD_VALUE,
+           "an invalid node context is rejected");
+    expect(FakePSysDriver::takeTaskRequests().empty(), "nothing is submitted");
+}
+
+}  // namespace
+
+int main() {
+    PSysDevice device(0);
+    expect(device.addTask(makeTask(0, 0, {{1, 1}})) == icamera::INVALID_OPERATION,
+           "no task before init()");
+    if (device.init() != icamera::OK) {
+        fprintf(stderr, "FAIL: init the PSysDevice\n");
+        return 1;
+    }
+
+    testTemplate(&device);
+    testReplacedTerminal(&device);
+    testFrameIdAndGraph(&device);
+    testInvalidContext(&device);
+    device.deinit();
+
+    if (gFailures == 0) {
+        printf("PSysDeviceTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks the batched sensor control writes of SensorHwCtrl against a fake
+// pixel array sub device. The extended control ioctls go through a SysCall
+// replaced by SysCall::updateInstance(), which needs a MODULE_TEST build.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+
+#include <map>
+
+#include "SensorHwCtrl.h"
+#include "SysCall.h"
+#include "iutils/Errors.h"
+#include "modules/v4l2/v4l2_device.h"
+
+using icamera::OK;
+using icamera::SensorHwCtrl;
+using icamera::SysCall;
+using icamera::V4L2Subdevice;
+
+namespace {
+
+const int kMaxVBlank = 1000;
+
+class FakeSubdevSysCall : public SysCall {
+ public:
+    explicit FakeSubdevSysCall(bool extControls)
+            : mExtControls(extControls),
+              mTryCalls(0),
+              mSetCalls(0) {}
+    ~FakeSubdevSysCall() {}
+
+    int ioctl(int fd, int request, struct v4l2_ext_controls* arg) override {
+        // The request codes don't fit in an int, compare them unsigned
+        const unsigned int code = static_cast<unsigned int>(request);
+        if (code == VIDIOC_TRY_EXT_CTRLS) {
+            mTryCalls++;
+        } else if (code == VIDIOC_S_EXT_CTRLS) {
+            mSetCalls++;
+        } else {
+            return SysCall::ioctl(fd, request, arg);
+        }
+
+        if (!mExtControls) {
+            errno = ENOTTY;
+            return -1;
+        }
+        // Like the driver, validate every value before any is applied
+        for (uint32_t i = 0; i < arg->count; i++) {
+            if (arg->controls[i].id == V4L2_CID_VBLANK && arg->controls[i].value > kMaxVBlank) {
+                arg->error_idx = i;
+                errno = EINVAL;
+                return -1;
+            }
+        }
+        if (code == VIDIOC_S_EXT_CTRLS) {
+            for (uint32_t i = 0; i < arg->count; i++) {
+                mValues[arg->controls[i].id] = arg->controls[i].value;
+            }
+        }
+        return 0;
+    }
+
+    bool mExtControls;
+    int mTryCalls;
+    int mSetCalls;
+    std::map<uint32_t, int32_t> mValues;
+};
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+// A bad value in the first batch must not turn batching off
+void testBadValueKeepsBatching() {
+    FakeSubdevSysCall sysCall(true);
+    SysCall::updateInstance(&sysCall);
+
+    V4L2Subdevice subdev("/dev/null");
+    subdev.Open(O_RDWR);
+    SensorHwCtrl ctrl(0, &subdev, nullptr);
+    expect(sysCall.mTryCalls == 1, "batch support is probed once");
+
+    ctrl.beginControls();
+    ctrl.setFrameDuration(2000, kMaxVBlank + 100);
+    ctrl.commitControls();
+    SensorHwCtrl::ControlStats stats = ctrl.getControlStats();
+    expect(sysCall.mSetCalls == 1, "the first frame is batched");
+    expect(stats.fallbacks == 1U, "the rejected batch falls back");
+
+    ctrl.beginControls();
+    ctrl.setFrameDuration(2100, 800);
+    const int ret = ctrl.commitControls();
+    stats = ctrl.getControlStats();
+    expect(ret == OK, "the second frame is written");
+    expect(sysCall.mSetCalls == 2, "the second frame is still batched");
+    expect(stats.lastFrameIoctls == 1U, "the second frame uses one ioctl");
+    expect(sysCall.mValues[V4L2_CID_HBLANK] == 2100, "hblank is written");
+    expect(sysCall.mValues[V4L2_CID_VBLANK] == 800, "vblank is written");
+
+    SysCall::updateInstance(nullptr);
+}
+
+// A device without extended controls is detected by the probe, not by a write
+void testUnsupportedWritesOneByOne() {
+    FakeSubdevSysCall sysCall(false);
+    SysCall::updateInstance(&sysCall);
+
+    V4L2Subdevice subdev("/dev/null");
+    subdev.Open(O_RDWR);
+    SensorHwCtrl ctrl(0, &subdev, nullptr);
+
+    ctrl.beginControls();
+    ctrl.setFrameDuration(2000, 800);
+    ctrl.commitControls();
+    const SensorHwCtrl::ControlStats stats = ctrl.getControlStats();
+    expect(sysCall.mTryCalls == 1, "batch support is probed");
+    expect(sysCall.mSetCalls == 0, "no batched write is tried");
+    expect(stats.fallbacks == 0U, "nothing falls back");
+    expect(stats.lastFrameIoctls == 2U, "each control uses one ioctl");
+
+    SysCall::updateInstance(nullptr);
+}
+
+// An early failure without any ioctl reports its own error code
+void testClosedDeviceNoIoctl() {
+    FakeSubdevSysCall sysCall(true);
+    SysCall::updateInstance(&sysCall);
+
+    V4L2Subdevice subdev("/dev/null");
+    struct v4l2_ext_control control = {};
+    control.id = V4L2_CID_VBLANK;
+    control.value = 100;
+    expect(subdev.SetControls(&control, 1) == -EINVAL, "closed device returns -EINVAL");
+    expect(subdev.ProbeExtControls() == -EINVAL, "closed device probe returns -EINVAL");
+    expect(sysCall.mTryCalls == 0 && sysCall.mSetCalls == 0, "no ioctl on closed device");
+
+    subdev.Open(O_RDWR);
+    uint32_t errorIdx = 0;
+    control.value = kMaxVBlank + 1;
+    expect(subdev.SetControls(&control, 1, &errorIdx) == -EINVAL, "bad value returns -EINVAL");
+    expect(errorIdx == 0U, "error index of the bad value");
+
+    SysCall::updateInstance(nullptr);
+}
+
+}  // namespace
+
+int main() {
+    testBadValueKeepsBatching();
+    testUnsupportedWritesOneByOne();
+    testClosedDeviceNoIoctl();
+
+    if (gFailures == 0) {
+        printf("SensorHwCtrlTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
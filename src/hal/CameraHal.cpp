@@ -24,7 +24,10 @@
 #include "Parameters.h"
 #include "PlatformData.h"
 #include "ParameterConvert.h"
+#include "iutils/CameraDump.h"
 #include "iutils/CameraLog.h"
+#include "iutils/FrameTimeline.h"
+#include "iutils/PerfStats.h"
 
 namespace icamera {
 
@@ -124,92 +127,137 @@ int CameraHal::deinit() {
 
 int CameraHal::deviceOpen(int cameraId, int vcNum) {
     LOG1("<id%d> @%s SENSORCTRLINFO: vcNum %d", cameraId, __func__, vcNum);
-    AutoMutex l(mLock);
-    CheckAndLogError(mState == HAL_UNINIT, NO_INIT, "HAL is not initialized");
-
-    // Create the camera device that will be freed in close
-    if (mCameraDevices[cameraId]) {
-        LOGI("<id%d> has already opened", cameraId);
-        return INVALID_OPERATION;
-    }
-
-    // VIRTUAL_CHANNEL_S
-    CheckAndLogError(mCameraOpenNum && vcNum != mVcNum, INVALID_OPERATION,
-                     "New vcNum %d dismatch the previous %d", vcNum, mVcNum);
-
-    vc_info_t vc;
-    CLEAR(vc);
-    PlatformData::getVCInfo(cameraId, vc);
-    if (vc.total_num) {
-        // Open as vc sensor
-        int groupId = vc.group >= 0 ? vc.group : 0;
-        CheckAndLogError(mCurrentGroupId >= 0 && groupId != mCurrentGroupId, INVALID_OPERATION,
-                         "Open group %d fail because group %d already opened!", groupId,
-                         mCurrentGroupId);
-        mCurrentGroupId = groupId;
-    }
-    mVcNum = vcNum;
-    // VIRTUAL_CHANNEL_E
+    AutoMutex cameraLock(mCameraLock[cameraId]);
+    {
+        AutoMutex l(mLock);
+        CheckAndLogError(mState == HAL_UNINIT, NO_INIT, "HAL is not initialized");
+
+        // Create the camera device that will be freed in close
+        if (mCameraDevices[cameraId]) {
+            LOGI("<id%d> has already opened", cameraId);
+            return INVALID_OPERATION;
+        }
 
-    // Create CameraContext instance
-    CameraContext::getInstance(cameraId);
+        // VIRTUAL_CHANNEL_S
+        CheckAndLogError(mCameraOpenNum && vcNum != mVcNum, INVALID_OPERATION,
+                         "New vcNum %d dismatch the previous %d", vcNum, mVcNum);
+
+        vc_info_t vc;
+        CLEAR(vc);
+        PlatformData::getVCInfo(cameraId, vc);
+        if (vc.total_num) {
+            // Open as vc sensor
+            int groupId = vc.group >= 0 ? vc.group : 0;
+            CheckAndLogError(mCurrentGroupId >= 0 && groupId != mCurrentGroupId,
+                             INVALID_OPERATION,
+                             "Open group %d fail because group %d already opened!", groupId,
+                             mCurrentGroupId);
+            mCurrentGroupId = groupId;
+        }
+        mVcNum = vcNum;
+        // VIRTUAL_CHANNEL_E
 
-    if (mCameraShm.CameraDeviceOpen(cameraId) != OK) {
-        return INVALID_OPERATION;
-    }
+        // Create CameraContext instance
+        CameraContext::getInstance(cameraId);
 
-    mCameraDevices[cameraId] = new CameraDevice(cameraId);
-    // The check is to handle dual camera cases
-    mCameraOpenNum = mCameraShm.cameraDeviceOpenNum();
-    CheckAndLogError(mCameraOpenNum == 0, INVALID_OPERATION, "camera open num couldn't be 0");
+        if (mCameraShm.CameraDeviceOpen(cameraId) != OK) {
+            return INVALID_OPERATION;
+        }
 
-    if (mCameraOpenNum == 1) {
-        MediaControl* mc = MediaControl::getInstance();
-        CheckAndLogError(!mc, UNKNOWN_ERROR, "MediaControl init failed");
+        mCameraDevices[cameraId] = new CameraDevice(cameraId);
+        // The check is to handle dual camera cases
+        mCameraOpenNum = mCameraShm.cameraDeviceOpenNum();
+        CheckAndLogError(mCameraOpenNum == 0, INVALID_OPERATION,
+                         "camera open num couldn't be 0");
+
+        if (mCameraOpenNum == 1) {
+            MediaControl* mc = MediaControl::getInstance();
+            bool needMediaControl = true;
+            // FILE_SOURCE_S
+            // The frames are injected from files, no media device is needed
+            needMediaControl = !PlatformData::isFileSourceEnabled();
+            // FILE_SOURCE_E
+            CheckAndLogError(needMediaControl && !mc, UNKNOWN_ERROR, "MediaControl init failed");
+        }
     }
 
+    // The device init is protected by the camera lock only
     return mCameraDevices[cameraId]->init();
 }
 
 void CameraHal::deviceClose(int cameraId) {
     LOG1("<id%d> @%s", cameraId, __func__);
-    AutoMutex l(mLock);
+    ConditionLock cameraLock(mCameraLock[cameraId]);
 
-    if (mCameraDevices[cameraId]) {
-        if (mVcNum <= 0) {
-            mCameraDevices[cameraId]->deinit();
-            delete mCameraDevices[cameraId];
-            mCameraDevices[cameraId] = nullptr;
-            mCameraOpenNum--;
-        } else if (!mDeviceClosing[cameraId]) {
-            // only deinit vc camera here
-            mCameraDevices[cameraId]->deinit();
-            mCameraOpenNum--;
-            mDeviceClosing[cameraId] = true;
-        }
-        mCameraShm.CameraDeviceClose(cameraId);
+    CameraDevice* device = mCameraDevices[cameraId];
+    bool vcDevice = false;
+    bool needDeinit = false;
+    {
+        AutoMutex l(mLock);
+        vcDevice = mVcNum > 0;
+        needDeinit = (device != nullptr) && !mDeviceClosing[cameraId];
     }
+
+    // The device deinit is protected by the camera lock only
+    if (needDeinit) {
+        device->deinit();
+    }
+
     // VIRTUAL_CHANNEL_S
-    // Destroy all closed vc cameras
-    if (mVcNum > 0 && mCameraOpenNum == 0) {
-        for (int i = 0; i < MAX_CAMERA_NUMBER; i++) {
-            if (mDeviceClosing[i]) {
-                delete mCameraDevices[i];
-                mCameraDevices[i] = nullptr;
-                mDeviceClosing[i] = false;
+    bool destroyVc[MAX_CAMERA_NUMBER] = {};
+    // VIRTUAL_CHANNEL_E
+    {
+        AutoMutex l(mLock);
+        if (device) {
+            // The closed vc camera is destroyed when all the vc cameras are closed
+            if (!vcDevice && !mDeviceClosing[cameraId]) {
+                delete device;
+                mCameraDevices[cameraId] = nullptr;
+                mCameraOpenNum--;
+            } else if (needDeinit) {
+                // only deinit vc camera here
+                mCameraOpenNum--;
+                mDeviceClosing[cameraId] = true;
+            }
+            mCameraShm.CameraDeviceClose(cameraId);
+        }
+        // VIRTUAL_CHANNEL_S
+        if (mVcNum > 0 && mCameraOpenNum == 0) {
+            for (int i = 0; i < MAX_CAMERA_NUMBER; i++) {
+                destroyVc[i] = mDeviceClosing[i];
             }
+            mVcNum = 0;
         }
-        mVcNum = 0;
+        // VIRTUAL_CHANNEL_E
+
+        // Release CameraContext instance
+        CameraContext::releaseInstance(cameraId);
     }
-    // VIRTUAL_CHANNEL_E
+    cameraLock.unlock();
 
-    // Release CameraContext instance
-    CameraContext::releaseInstance(cameraId);
+    // VIRTUAL_CHANNEL_S
+    /**
+     * Destroy all closed vc cameras, each one with its camera lock since the other cameras
+     * may be still called. The own camera lock is released above to keep the lock order.
+     */
+    for (int i = 0; i < MAX_CAMERA_NUMBER; i++) {
+        if (!destroyVc[i]) continue;
+
+        AutoMutex closedCameraLock(mCameraLock[i]);
+        AutoMutex l(mLock);
+        // It may be destroyed by another close already
+        if (!mDeviceClosing[i]) continue;
+
+        delete mCameraDevices[i];
+        mCameraDevices[i] = nullptr;
+        mDeviceClosing[i] = false;
+    }
+    // VIRTUAL_CHANNEL_E
 }
 
 void CameraHal::deviceCallbackRegister(int cameraId, const camera_callback_ops_t* callback) {
     LOG1("<id%d> @%s", cameraId, __func__);
-    AutoMutex l(mLock);
+    AutoMutex cameraLock(mCameraLock[cameraId]);
 
     CameraDevice* device = mCameraDevices[cameraId];
     checkCameraDevice(device, VOID_VALUE);
@@ -219,7 +267,7 @@ void CameraHal::deviceCallbackRegister(int cameraId, const camera_callback_ops_t
 // Assume the inputConfig is already checked in upper layer
 int CameraHal::deviceConfigInput(int cameraId, const stream_t* inputConfig) {
     LOG1("<id%d> @%s", cameraId, __func__);
-    AutoMutex lock(mLock);
+    AutoMutex cameraLock(mCameraLock[cameraId]);
 
     CameraDevice* device = mCameraDevices[cameraId];
     checkCameraDevice(device, BAD_VALUE);
@@ -232,7 +280,7 @@ int CameraHal::deviceConfigInput(int cameraId, const stream_t* inputConfig) {
 // Assume the streamList is already checked in upper layer
 int CameraHal::deviceConfigStreams(int cameraId, stream_config_t* streamList) {
     LOG1("<id%d> @%s", cameraId, __func__);
-    AutoMutex lock(mLock);
+    AutoMutex cameraLock(mCameraLock[cameraId]);
 
     CameraDevice* device = mCameraDevices[cameraId];
     checkCameraDevice(device, BAD_VALUE);
@@ -246,6 +294,7 @@ int CameraHal::deviceConfigStreams(int cameraId, stream_config_t* streamList) {
     ParameterConvert::getConfigInfo(streamList, mConfigInfo[cameraId]);
 
     // VIRTUAL_CHANNEL_S
+    AutoMutex l(mLock);
     if (mVcNum > 0) {
         mConfigTimes++;
         LOG1("<id%d> @%s, mConfigTimes:%d, before signal", cameraId, __func__, mConfigTimes);
@@ -258,12 +307,13 @@ int CameraHal::deviceConfigStreams(int cameraId, stream_config_t* streamList) {
 
 int CameraHal::deviceStart(int cameraId) {
     LOG1("<id%d> @%s", cameraId, __func__);
-    std::unique_lock<std::mutex> lock(mLock);
+    AutoMutex cameraLock(mCameraLock[cameraId]);
 
     CameraDevice* device = mCameraDevices[cameraId];
     checkCameraDevice(device, BAD_VALUE);
 
     // VIRTUAL_CHANNEL_S
+    ConditionLock lock(mLock);
     if (mVcNum > 0) {
         LOG1("<id%d>@%s, mConfigTimes:%d, mVcNum:%d", cameraId, __func__, mConfigTimes, mVcNum);
         int timeoutCnt = 10;
@@ -280,6 +330,7 @@ int CameraHal::deviceStart(int cameraId) {
                              cameraId, mConfigTimes);
         }
     }
+    lock.unlock();
     // VIRTUAL_CHANNEL_E
 
     return device->start();
@@ -287,14 +338,19 @@ int CameraHal::deviceStart(int cameraId) {
 
 int CameraHal::deviceStop(int cameraId) {
     LOG1("<id%d> @%s", cameraId, __func__);
-    AutoMutex lock(mLock);
+    AutoMutex cameraLock(mCameraLock[cameraId]);
 
     CameraDevice* device = mCameraDevices[cameraId];
     checkCameraDevice(device, BAD_VALUE);
 
     mFrameNumber[cameraId] = -1;
 
-    return device->stop();
+    const int ret = device->stop();
+    PerfStats::report(cameraId);
+    FrameTimeline::save(cameraId);
+    CameraDump::flush();
+
+    return ret;
 }
 
 int CameraHal::deviceAllocateMemory(int cameraId, camera_buffer_t* ubuffer) {
@@ -329,6 +385,8 @@ int CameraHal::streamQbuf(int cameraId, camera_buffer_t** ubuffer, int bufferNum
     for (int id = 0; id < bufferNum; id++) {
         ubuffer[id]->frameNumber = mFrameNumber[cameraId];
     }
+    PerfStats::onRequestQueued(cameraId, mFrameNumber[cameraId]);
+    FrameTimeline::mark(cameraId, TIMELINE_QBUF, mFrameNumber[cameraId]);
 
     return device->qbuf(ubuffer, bufferNum);
 }
@@ -341,6 +399,9 @@ int CameraHal::streamDqbuf(int cameraId, int streamId, camera_buffer_t** ubuffer
 
     int ret = device->dqbuf(streamId, ubuffer);
     CheckAndLogError(ret != OK, ret, "dqbuf failed: %d", ret);
+    PerfStats::onResultDequeued(cameraId, (*ubuffer)->frameNumber);
+    FrameTimeline::mark(cameraId, TIMELINE_DQBUF, (*ubuffer)->frameNumber,
+                        static_cast<uint8_t>(streamId));
 
     if (settings != nullptr) {
         settings->merge(mParameters[cameraId]);
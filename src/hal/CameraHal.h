@@ -72,7 +72,12 @@ class CameraHal {
 
     CameraDevice* mCameraDevices[MAX_CAMERA_NUMBER];
     int mInitTimes;
-    // Guard for CameraHal public API.
+    /**
+     * Guard for the device API of each camera, so one camera doesn't block the others.
+     * Lock order: mCameraLock[cameraId] before mLock.
+     */
+    Mutex mCameraLock[MAX_CAMERA_NUMBER];
+    // Guard for the state shared by all cameras: init, open num, shm and virtual channel.
     Mutex mLock;
     // VIRTUAL_CHANNEL_S
     int mCurrentGroupId;
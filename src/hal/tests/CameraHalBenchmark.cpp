@@ -0,0 +1,367 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Headless benchmark of the HAL API: open, configure, then queue and dequeue
+// requests on one or more cameras, and report the qbuf to dqbuf latency of
+// each stream, the frame rate and the process CPU time.
+//
+// Without IPU, run it on the PnP mocks:
+//   cameraInjectFile=<raw file>   feeds the frames by FileSource instead of ISYS
+//   pnp_profiles.json in CAMERA_CFG_PATH, in "PnpDebugConfig":
+//     "useMockPSys": true         runs PSYS tasks on MockPSysDevice
+//     "useMockPipes": true        replaces the pipe managers with PipeManagerStub
+// Adding the CAMERA_DEBUG_LOG_PERF_TRACES_BREAKDOWN bit to cameraPerf prints
+// the per stage breakdown of PerfStats when each camera is stopped.
+//
+// Usage: CameraHalBenchmark [-c ids] [-s WxH:FORMAT[:usage]]... [-n frames]
+//                           [-b buffers] [-w warmup]
+//   -c  comma separated camera ids, each runs in its own thread (default 0)
+//   -s  one stream, format is a V4L2 short name such as NV12 or JPG, usage is
+//       preview, video, still or app (default 1920x1080:NV12:preview)
+//   -n  measured frames per camera (default 300)
+//   -b  requests in flight per camera (default 4)
+//   -w  frames dropped before measuring (default 10)
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ICamera.h"
+#include "iutils/Utils.h"
+
+using icamera::camera_buffer_t;
+using icamera::nsecs_t;
+using icamera::stream_config_t;
+using icamera::stream_t;
+namespace CameraUtils = icamera::CameraUtils;
+
+namespace {
+
+const int kMaxStreams = 4;
+
+struct Options {
+    std::vector<int> cameraIds;
+    std::vector<stream_t> streams;
+    int frames;
+    int buffers;
+    int warmup;
+};
+
+struct Request {
+    camera_buffer_t buffers[kMaxStreams];
+    nsecs_t queuedAt;
+};
+
+struct CameraResult {
+    int cameraId;
+    bool ok;
+    nsecs_t openTime;
+    nsecs_t configTime;
+    nsecs_t runTime;
+    int frames;
+    std::vector<stream_t> streams;
+    std::vector<std::vector<nsecs_t>> latencies;  // Per stream
+};
+
+nsecs_t processCpuTime() {
+    struct rusage usage = {};
+    getrusage(RUSAGE_SELF, &usage);
+    return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000000LL +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1000LL;
+}
+
+bool parseStream(const char* spec, stream_t* stream) {
+    int width = 0;
+    int height = 0;
+    char format[32] = {};
+    char usage[32] = "preview";
+    if (sscanf(spec, "%dx%d:%31[^:]:%31s", &width, &height, format, usage) < 3) {
+        fprintf(stderr, "Bad stream %s, expect WxH:FORMAT[:usage]\n", spec);
+        return false;
+    }
+
+    const int v4l2Fmt = CameraUtils::string2PixelCode(format);
+    if (v4l2Fmt < 0) {
+        fprintf(stderr, "Unknown format %s\n", format);
+        return false;
+    }
+
+    CLEAR(*stream);
+    stream->format = v4l2Fmt;
+    stream->width = width;
+    stream->height = height;
+    stream->field = V4L2_FIELD_ANY;
+    stream->memType = V4L2_MEMORY_USERPTR;
+    stream->streamType = icamera::CAMERA_STREAM_OUTPUT;
+    if (strcmp(usage, "preview") == 0) {
+        stream->usage = icamera::CAMERA_STREAM_PREVIEW;
+    } else if (strcmp(usage, "video") == 0) {
+        stream->usage = icamera::CAMERA_STREAM_VIDEO_CAPTURE;
+    } else if (strcmp(usage, "still") == 0) {
+        stream->usage = icamera::CAMERA_STREAM_STILL_CAPTURE;
+    } else if (strcmp(usage, "app") == 0) {
+        stream->usage = icamera::CAMERA_STREAM_APP;
+    } else {
+        fprintf(stderr, "Unknown usage %s\n", usage);
+        return false;
+    }
+    return true;
+}
+
+bool parseOptions(int argc, char* argv[], Options* options) {
+    options->frames = 300;
+    options->buffers = 4;
+    options->warmup = 10;
+
+    int opt = 0;
+    while ((opt = getopt(argc, argv, "c:s:n:b:w:")) != -1) {
+        switch (opt) {
+            case 'c': {
+                std::string ids(optarg);
+                size_t start = 0;
+                while (start <= ids.size()) {
+                    size_t end = ids.find(',', start);
+                    if (end == std::string::npos) end = ids.size();
+                    options->cameraIds.push_back(atoi(ids.substr(start, end - start).c_str()));
+                    start = end + 1;
+                }
+                break;
+            }
+            case 's': {
+                stream_t stream;
+                if (!parseStream(optarg, &stream)) return false;
+                options->streams.push_back(stream);
+                break;
+            }
+            case 'n':
+                options->frames = atoi(optarg);
+                break;
+            case 'b':
+                options->buffers = atoi(optarg);
+                break;
+            case 'w':
+                options->warmup = atoi(optarg);
+                break;
+            default:
+                return false;
+        }
+    }
+
+    if (options->cameraIds.empty()) options->cameraIds.push_back(0);
+    if (options->streams.empty()) {
+        stream_t stream;
+        parseStream("1920x1080:NV12:preview", &stream);
+        options->streams.push_back(stream);
+    }
+    if (options->streams.size() > kMaxStreams) {
+        fprintf(stderr, "At most %d streams are supported\n", kMaxStreams);
+        return false;
+    }
+    return options->frames > 0 && options->buffers > 0 && options->warmup >= 0;
+}
+
+bool allocateRequests(int cameraId, const std::vector<stream_t>& streams,
+                      std::vector<Request>* requests) {
+    for (Request& request : *requests) {
+        for (size_t i = 0; i < streams.size(); i++) {
+            camera_buffer_t& buffer = request.buffers[i];
+            CLEAR(buffer);
+            buffer.s = streams[i];
+
+            int bpp = 0;
+            const int size = icamera::get_frame_size(cameraId, streams[i].format,
+                                                     streams[i].width, streams[i].height,
+                                                     streams[i].field, &bpp);
+            if (size <= 0 || posix_memalign(&buffer.addr, getpagesize(), size) != 0) {
+                fprintf(stderr, "Camera %d: failed to allocate %d bytes\n", cameraId, size);
+                return false;
+            }
+            buffer.s.size = size;
+        }
+    }
+    return true;
+}
+
+void freeRequests(size_t streamNum, std::vector<Request>* requests) {
+    for (Request& request : *requests) {
+        for (size_t i = 0; i < streamNum; i++) {
+            free(request.buffers[i].addr);
+            request.buffers[i].addr = nullptr;
+        }
+    }
+}
+
+int queueRequest(int cameraId, size_t streamNum, Request* request) {
+    camera_buffer_t* buffers[kMaxStreams];
+    for (size_t i = 0; i < streamNum; i++) {
+        buffers[i] = &request->buffers[i];
+    }
+    request->queuedAt = CameraUtils::systemTime();
+    return icamera::camera_stream_qbuf(cameraId, buffers, streamNum);
+}
+
+// Requests complete in order, so the next one to dequeue is always the oldest
+bool runFrames(int cameraId, const Options& options, std::vector<Request>* requests,
+               CameraResult* result) {
+    const size_t streamNum = result->streams.size();
+    const int total = options.warmup + options.frames;
+    nsecs_t startTime = 0;
+
+    for (int frame = 0; frame < total; frame++) {
+        if (frame == options.warmup) startTime = CameraUtils::systemTime();
+
+        Request& request = (*requests)[frame % requests->size()];
+        for (size_t i = 0; i < streamNum; i++) {
+            camera_buffer_t* buffer = nullptr;
+            int ret = icamera::camera_stream_dqbuf(cameraId, result->streams[i].id, &buffer);
+            if (ret != 0 || buffer != &request.buffers[i]) {
+                fprintf(stderr, "Camera %d: dqbuf of stream %d failed at frame %d\n", cameraId,
+                        result->streams[i].id, frame);
+                return false;
+            }
+            if (frame >= options.warmup) {
+                result->latencies[i].push_back(CameraUtils::systemTime() - request.queuedAt);
+            }
+        }
+
+        // Keep the pipeline full until the last request is queued
+        if (frame + static_cast<int>(requests->size()) < total &&
+            queueRequest(cameraId, streamNum, &request) != 0) {
+            fprintf(stderr, "Camera %d: qbuf failed at frame %d\n", cameraId, frame);
+            return false;
+        }
+    }
+
+    result->runTime = CameraUtils::systemTime() - startTime;
+    result->frames = options.frames;
+    return true;
+}
+
+void runCamera(const Options& options, CameraResult* result) {
+    const int cameraId = result->cameraId;
+    result->ok = false;
+    result->streams = options.streams;
+    result->latencies.resize(options.streams.size());
+
+    nsecs_t start = CameraUtils::systemTime();
+    if (icamera::camera_device_open(cameraId) != 0) {
+        fprintf(stderr, "Camera %d: open failed\n", cameraId);
+        return;
+    }
+    result->openTime = CameraUtils::systemTime() - start;
+
+    stream_config_t config;
+    config.num_streams = result->streams.size();
+    config.streams = result->streams.data();
+    config.operation_mode = icamera::CAMERA_STREAM_CONFIGURATION_MODE_AUTO;
+    start = CameraUtils::systemTime();
+    if (icamera::camera_device_config_streams(cameraId, &config) != 0) {
+        fprintf(stderr, "Camera %d: stream configuration failed\n", cameraId);
+        icamera::camera_device_close(cameraId);
+        return;
+    }
+    result->configTime = CameraUtils::systemTime() - start;
+
+    const int total = options.warmup + options.frames;
+    std::vector<Request> requests(std::min(options.buffers, total));
+    bool ok = allocateRequests(cameraId, result->streams, &requests);
+    for (size_t i = 0; ok && i < requests.size(); i++) {
+        ok = queueRequest(cameraId, result->streams.size(), &requests[i]) == 0;
+    }
+
+    if (ok && icamera::camera_device_start(cameraId) == 0) {
+        result->ok = runFrames(cameraId, options, &requests, result);
+        icamera::camera_device_stop(cameraId);
+    } else {
+        fprintf(stderr, "Camera %d: failed to start\n", cameraId);
+    }
+
+    icamera::camera_device_close(cameraId);
+    freeRequests(result->streams.size(), &requests);
+}
+
+double toMs(nsecs_t time) {
+    return time / 1000000.0;
+}
+
+void printResult(CameraResult* result) {
+    if (!result->ok) {
+        printf("camera %d: FAILED\n", result->cameraId);
+        return;
+    }
+
+    printf("camera %d: open %.2f ms, configure %.2f ms, %d frames at %.2f fps\n",
+           result->cameraId, toMs(result->openTime), toMs(result->configTime), result->frames,
+           result->frames * 1000.0 / toMs(result->runTime));
+    for (size_t i = 0; i < result->streams.size(); i++) {
+        const stream_t& s = result->streams[i];
+        std::vector<nsecs_t>& latency = result->latencies[i];
+        std::sort(latency.begin(), latency.end());
+        const size_t p99 = std::min(latency.size() - 1, latency.size() * 99 / 100);
+        printf("  stream %d %dx%d %s: qbuf to dqbuf p50 %.2f ms, p99 %.2f ms, max %.2f ms\n",
+               s.id, s.width, s.height, CameraUtils::format2string(s.format).c_str(),
+               toMs(latency[latency.size() / 2]), toMs(latency[p99]), toMs(latency.back()));
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parseOptions(argc, argv, &options)) {
+        fprintf(stderr, "Usage: %s [-c ids] [-s WxH:FORMAT[:usage]]... [-n frames] "
+                "[-b buffers] [-w warmup]\n", argv[0]);
+        return 1;
+    }
+
+    if (icamera::camera_hal_init() != 0) {
+        fprintf(stderr, "camera_hal_init failed\n");
+        return 1;
+    }
+
+    std::vector<CameraResult> results(options.cameraIds.size());
+    std::vector<std::thread> threads;
+    const nsecs_t cpuStart = processCpuTime();
+    const nsecs_t wallStart = CameraUtils::systemTime();
+    for (size_t i = 0; i < options.cameraIds.size(); i++) {
+        results[i].cameraId = options.cameraIds[i];
+        threads.push_back(std::thread(runCamera, std::cref(options), &results[i]));
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const nsecs_t wallTime = CameraUtils::systemTime() - wallStart;
+    const nsecs_t cpuTime = processCpuTime() - cpuStart;
+
+    icamera::camera_hal_deinit();
+
+    bool ok = true;
+    for (CameraResult& result : results) {
+        printResult(&result);
+        ok = ok && result.ok;
+    }
+    printf("process: wall %.2f ms, cpu %.2f ms (%.1f%% of one core)\n", toMs(wallTime),
+           toMs(cpuTime), cpuTime * 100.0 / wallTime);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Runs the camera API of several cameras at once, now that CameraHal locks
+// each camera separately: one thread per camera opens, configures, starts,
+// dequeues, stops and closes its camera in a loop, while another thread reads
+// the camera info. Every call of the camera threads must succeed, and the
+// process must neither crash nor hang.
+//
+// It needs two cameras that can be opened. Without IPU, set up the PnP mocks
+// as described in CameraHalBenchmark.cpp. It returns 77, the skip code of the
+// test, when the HAL has fewer cameras.
+//
+// Usage: CameraHalTest [cycles]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "ICamera.h"
+#include "iutils/Utils.h"
+
+using icamera::camera_buffer_t;
+using icamera::stream_config_t;
+using icamera::stream_t;
+
+namespace {
+
+const int kSkipped = 77;
+const int kMaxCameras = 4;
+const int kBuffers = 2;
+
+std::atomic<int> gFailures(0);
+
+void expect(bool cond, const char* what, int cameraId, int cycle) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s, camera %d cycle %d\n", what, cameraId, cycle);
+        gFailures++;
+    }
+}
+
+stream_t getStream() {
+    stream_t stream;
+    CLEAR(stream);
+    stream.format = V4L2_PIX_FMT_NV12;
+    stream.width = 1920;
+    stream.height = 1080;
+    stream.field = V4L2_FIELD_ANY;
+    stream.memType = V4L2_MEMORY_USERPTR;
+    stream.streamType = icamera::CAMERA_STREAM_OUTPUT;
+    stream.usage = icamera::CAMERA_STREAM_PREVIEW;
+    return stream;
+}
+
+// One cycle from open to close, it stops at the first failed step
+void runCycle(int cameraId, int cycle) {
+    if (icamera::camera_device_open(cameraId) != 0) {
+        expect(false, "open", cameraId, cycle);
+        return;
+    }
+
+    stream_t stream = getStream();
+    stream_config_t config;
+    config.num_streams = 1;
+    config.streams = &stream;
+    config.operation_mode = icamera::CAMERA_STREAM_CONFIGURATION_MODE_AUTO;
+    bool ok = icamera::camera_device_config_streams(cameraId, &config) == 0;
+    expect(ok, "config streams", cameraId, cycle);
+
+    int bpp = 0;
+    const int size = icamera::get_frame_size(cameraId, stream.format, stream.width,
+                                             stream.height, stream.field, &bpp);
+    camera_buffer_t buffers[kBuffers];
+    for (camera_buffer_t& buffer : buffers) {
+        CLEAR(buffer);
+        buffer.s = stream;
+        buffer.s.size = size;
+        if (ok && (size <= 0 || posix_memalign(&buffer.addr, getpagesize(), size) != 0)) {
+            expect(false, "allocate buffer", cameraId, cycle);
+            ok = false;
+        }
+    }
+    for (int i = 0; ok && i < kBuffers; i++) {
+        camera_buffer_t* buffer = &buffers[i];
+        ok = icamera::camera_stream_qbuf(cameraId, &buffer) == 0;
+        expect(ok, "qbuf", cameraId, cycle);
+    }
+
+    if (ok && icamera::camera_device_start(cameraId) == 0) {
+        for (int i = 0; i < kBuffers; i++) {
+            camera_buffer_t* buffer = nullptr;
+            const int ret = icamera::camera_stream_dqbuf(cameraId, stream.id, &buffer);
+            expect(ret == 0 && buffer == &buffers[i], "dqbuf in order", cameraId, cycle);
+        }
+        expect(icamera::camera_device_stop(cameraId) == 0, "stop", cameraId, cycle);
+    } else if (ok) {
+        expect(false, "start", cameraId, cycle);
+    }
+
+    icamera::camera_device_close(cameraId);
+    for (camera_buffer_t& buffer : buffers) free(buffer.addr);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int cycles = (argc > 1) ? atoi(argv[1]) : 20;
+    if (cycles <= 0) {
+        fprintf(stderr, "Usage: %s [cycles]\n", argv[0]);
+        return 1;
+    }
+
+    if (icamera::camera_hal_init() != 0) {
+        printf("CameraHalTest skipped, camera_hal_init failed\n");
+        return kSkipped;
+    }
+    const int cameraNum = std::min(icamera::get_number_of_cameras(), kMaxCameras);
+    if (cameraNum < 2) {
+        printf("CameraHalTest skipped, %d camera(s)\n", cameraNum);
+        icamera::camera_hal_deinit();
+        return kSkipped;
+    }
+
+    std::atomic<bool> running(true);
+    std::thread infoReader([&running, cameraNum]() {
+        std::mt19937 rng(1);
+        while (running) {
+            icamera::camera_info_t info;
+            icamera::get_camera_info(rng() % cameraNum, info);
+        }
+    });
+
+    std::vector<std::thread> cameras;
+    for (int cameraId = 0; cameraId < cameraNum; cameraId++) {
+        cameras.emplace_back([cameraId, cycles]() {
+            for (int cycle = 0; cycle < cycles; cycle++) runCycle(cameraId, cycle);
+        });
+    }
+    for (auto& thread : cameras) thread.join();
+    running = false;
+    infoReader.join();
+
+    icamera::camera_hal_deinit();
+
+    if (gFailures == 0) {
+        printf("CameraHalTest passed, %d cameras, %d cycles each\n", cameraNum, cycles);
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
@@ -30,6 +30,8 @@ public:
 
     static std::unique_ptr<IImageProcessor> createImageProcessor();
     static bool isProcessingTypeSupported(PostProcessType type);
+    // If cropScaleConvertFrame() can replace the crop, scale and convert from input to output
+    static bool isCropScaleConvertSupported(const stream_t &input, const stream_t &output);
 
     virtual status_t cropFrame(const std::shared_ptr<CameraBuffer> &input,
                                std::shared_ptr<CameraBuffer> &output) = 0;
@@ -40,6 +42,9 @@ public:
                                  int angle, std::vector<uint8_t> &rotateBuf) = 0;
     virtual status_t convertFrame(const std::shared_ptr<CameraBuffer> &input,
                                   std::shared_ptr<CameraBuffer> &output) = 0;
+    // Crop, scale and convert in one pass, without the intermediate frames
+    virtual status_t cropScaleConvertFrame(const std::shared_ptr<CameraBuffer> &input,
+                                           std::shared_ptr<CameraBuffer> &output) = 0;
 private:
     DISALLOW_COPY_AND_ASSIGN(IImageProcessor);
 };
@@ -23,6 +23,8 @@
 #endif
 
 #include "iutils/CameraLog.h"
+#include "iutils/FrameTimeline.h"
+#include "iutils/PerfStats.h"
 #include "stdlib.h"
 
 using std::shared_ptr;
@@ -64,9 +66,8 @@ status_t RotateProcess::doPostProcessing(const shared_ptr<CameraBuffer>& inBuf,
     LOG1("@%s processor name: %s", __func__, mName.c_str());
     CheckAndLogError(!inBuf, UNKNOWN_ERROR, "%s, the inBuf is nullptr", __func__);
     CheckAndLogError(!outBuf, UNKNOWN_ERROR, "%s, the outBuf is nullptr", __func__);
-    std::vector<uint8_t> rotateBuf;
 
-    int ret = mProcessor->rotateFrame(inBuf, outBuf, mAngle, rotateBuf);
+    int ret = mProcessor->rotateFrame(inBuf, outBuf, mAngle, mRotateBuf);
     CheckAndLogError(ret != OK, UNKNOWN_ERROR, "Failed to do post processing, name: %s",
                      mName.c_str());
 
@@ -111,6 +112,25 @@ status_t ConvertProcess::doPostProcessing(const shared_ptr<CameraBuffer>& inBuf,
     return OK;
 }
 
+CropScaleConvertProcess::CropScaleConvertProcess() : PostProcessorBase("CropScaleConvert") {
+    LOG1("@%s create crop scale convert processor", __func__);
+    mProcessor = IImageProcessor::createImageProcessor();
+}
+
+status_t CropScaleConvertProcess::doPostProcessing(const shared_ptr<CameraBuffer>& inBuf,
+                                                   shared_ptr<CameraBuffer>& outBuf) {
+    PERF_CAMERA_ATRACE_PARAM1(mName.c_str(), 0);
+    LOG1("@%s processor name: %s", __func__, mName.c_str());
+    CheckAndLogError(!inBuf, UNKNOWN_ERROR, "%s, the inBuf is nullptr", __func__);
+    CheckAndLogError(!outBuf, UNKNOWN_ERROR, "%s, the outBuf is nullptr", __func__);
+
+    int ret = mProcessor->cropScaleConvertFrame(inBuf, outBuf);
+    CheckAndLogError(ret != OK, UNKNOWN_ERROR, "Failed to do post processing, name: %s",
+                     mName.c_str());
+
+    return OK;
+}
+
 // JPEG_ENCODE_S
 JpegProcess::JpegProcess(int cameraId)
         : PostProcessorBase("JpegEncode"),
@@ -239,6 +259,8 @@ void JpegProcess::fillEncodeInfo(const shared_ptr<CameraBuffer>& inBuf,
 status_t JpegProcess::doPostProcessing(const shared_ptr<CameraBuffer>& inBuf,
                                        shared_ptr<CameraBuffer>& outBuf) {
     PERF_CAMERA_ATRACE_PARAM1(mName.c_str(), 0);
+    PERF_STAGE_STATS(mCameraId, PERF_STAGE_JPEG);
+    FRAME_TIMELINE_SCOPE(mCameraId, TIMELINE_JPEG, inBuf->getSequence());
     LOG1("@%s processor name: %s", __func__, mName.c_str());
 
     bool isEncoded = false;
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "CameraBuffer.h"
 #include "IImageProcessor.h"
@@ -70,6 +71,8 @@ class RotateProcess : public PostProcessorBase {
 
  private:
     int mAngle;
+    // Scratch buffer of the processor, kept to avoid allocating it for each frame
+    std::vector<uint8_t> mRotateBuf;
 };
 
 class CropProcess : public PostProcessorBase {
@@ -88,6 +91,15 @@ class ConvertProcess : public PostProcessorBase {
                                       std::shared_ptr<CameraBuffer>& outBuf);
 };
 
+// Replace the consecutive crop, scale and convert processors by one pass
+class CropScaleConvertProcess : public PostProcessorBase {
+ public:
+    CropScaleConvertProcess();
+
+    virtual status_t doPostProcessing(const std::shared_ptr<CameraBuffer>& inBuf,
+                                      std::shared_ptr<CameraBuffer>& outBuf);
+};
+
 // JPEG_ENCODE_S
 class JpegProcess : public PostProcessorBase {
  public:
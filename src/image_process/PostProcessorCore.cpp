@@ -32,33 +32,73 @@ bool PostProcessorCore::isPostProcessTypeSupported(PostProcessType type) {
     return IImageProcessor::isProcessingTypeSupported(type);
 }
 
+void PostProcessorCore::fuseProcessors() {
+    const int fusibleTypes = POST_PROCESS_CROP | POST_PROCESS_SCALING | POST_PROCESS_CONVERT;
+    std::vector<PostProcessInfo> infos;
+
+    for (size_t i = 0; i < mProcessorsInfo.size();) {
+        size_t end = i;
+        int types = POST_PROCESS_NONE;
+        while (end < mProcessorsInfo.size() && (mProcessorsInfo[end].type & fusibleTypes)) {
+            types |= mProcessorsInfo[end].type;
+            end++;
+        }
+
+        if (end - i >= 2 && IImageProcessor::isCropScaleConvertSupported(
+                                mProcessorsInfo[i].inputInfo, mProcessorsInfo[end - 1].outputInfo)) {
+            PostProcessInfo info = mProcessorsInfo[end - 1];
+            info.inputInfo = mProcessorsInfo[i].inputInfo;
+            info.fusedTypes = types;
+            infos.push_back(info);
+
+            // The intermediate frames aren't written and read back any more
+            size_t savedSize = 0;
+            for (size_t j = i; j < end - 1; j++) {
+                savedSize += mProcessorsInfo[j].outputInfo.size;
+            }
+            LOG1("<id%d>@%s, fuse %zu processors (0x%x), %zu bytes of intermediate frames saved",
+                 mCameraId, __func__, end - i, types, savedSize);
+            i = end;
+        } else {
+            infos.push_back(mProcessorsInfo[i]);
+            i++;
+        }
+    }
+
+    mProcessorsInfo = infos;
+}
+
 status_t PostProcessorCore::createProcessor() {
     mProcessorVector.clear();
     for (const auto& order : mProcessorsInfo) {
         shared_ptr<PostProcessorBase> processor = nullptr;
-        switch (order.type) {
-            case POST_PROCESS_SCALING:
-                processor = std::make_shared<ScaleProcess>();
-                break;
-            case POST_PROCESS_ROTATE:
-                processor = std::make_shared<RotateProcess>(order.angle);
-                break;
-            case POST_PROCESS_CROP:
-                processor = std::make_shared<CropProcess>();
-                break;
-            case POST_PROCESS_CONVERT:
-                processor = std::make_shared<ConvertProcess>();
-                break;
+        if (order.fusedTypes != POST_PROCESS_NONE) {
+            processor = std::make_shared<CropScaleConvertProcess>();
+        } else {
+            switch (order.type) {
+                case POST_PROCESS_SCALING:
+                    processor = std::make_shared<ScaleProcess>();
+                    break;
+                case POST_PROCESS_ROTATE:
+                    processor = std::make_shared<RotateProcess>(order.angle);
+                    break;
+                case POST_PROCESS_CROP:
+                    processor = std::make_shared<CropProcess>();
+                    break;
+                case POST_PROCESS_CONVERT:
+                    processor = std::make_shared<ConvertProcess>();
+                    break;
 // JPEG_ENCODE_S
-            case POST_PROCESS_JPEG_ENCODING:
-                processor = std::make_shared<JpegProcess>(mCameraId);
-                break;
+                case POST_PROCESS_JPEG_ENCODING:
+                    processor = std::make_shared<JpegProcess>(mCameraId);
+                    break;
 // JPEG_ENCODE_E
-            case POST_PROCESS_NONE:
-                break;
-            default:
-                LOGE("%s, Doesn't support this kind of post-processor", __func__);
-                return UNKNOWN_ERROR;
+                case POST_PROCESS_NONE:
+                    break;
+                default:
+                    LOGE("%s, Doesn't support this kind of post-processor", __func__);
+                    return UNKNOWN_ERROR;
+            }
         }
 
         CheckAndLogError(!processor, UNKNOWN_ERROR, "%s, Failed to create the post processor: 0x%x",
@@ -83,6 +123,7 @@ status_t PostProcessorCore::configure(const std::vector<PostProcessInfo>& proces
     }
 
     mProcessorsInfo = processorOrder;
+    fuseProcessors();
     int ret = createProcessor();
     CheckAndLogError(ret != OK, ret, "%s, Failed to create the post processor", __func__);
 
@@ -31,7 +31,9 @@ struct PostProcessInfo {
     stream_t outputInfo;
     PostProcessType type;
     int angle;
-    PostProcessInfo() : type(POST_PROCESS_NONE), angle(0) {
+    // The types done in one pass by this processor, POST_PROCESS_NONE if not fused
+    int fusedTypes;
+    PostProcessInfo() : type(POST_PROCESS_NONE), angle(0), fusedTypes(POST_PROCESS_NONE) {
         CLEAR(inputInfo);
         CLEAR(outputInfo);
     }
@@ -57,6 +59,8 @@ class PostProcessorCore {
                               std::shared_ptr<CameraBuffer> outBuf);
 
  private:
+    // Merge the consecutive crop, scale and convert into one pass if supported
+    void fuseProcessors();
     status_t createProcessor();
     status_t allocateInternalBuffers();
 
@@ -51,6 +51,10 @@ bool IImageProcessor::isProcessingTypeSupported(PostProcessType type) {
     return supportedType & type;
 }
 
+bool IImageProcessor::isCropScaleConvertSupported(const stream_t& input, const stream_t& output) {
+    return false;
+}
+
 status_t ImageProcessorCore::cropFrame(const std::shared_ptr<CameraBuffer>& input,
                                        std::shared_ptr<CameraBuffer>& output) {
     LOG2("%s: src: %dx%d,format 0x%x, dest: %dx%d format 0x%x", __func__, input->getWidth(),
@@ -175,4 +179,10 @@ status_t ImageProcessorCore::convertFrame(const std::shared_ptr<CameraBuffer>& i
          output->getFormat());
     return UNKNOWN_ERROR;
 }
+
+status_t ImageProcessorCore::cropScaleConvertFrame(const std::shared_ptr<CameraBuffer>& input,
+                                                   std::shared_ptr<CameraBuffer>& output) {
+    LOGE("Doesn't support the crop, scale and convert in one pass");
+    return INVALID_OPERATION;
+}
 } /* namespace icamera */
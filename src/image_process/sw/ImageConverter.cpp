@@ -19,14 +19,39 @@
 #include <sys/types.h>
 #include <linux/videodev2.h>
 
+#include <algorithm>
+
 #include "iutils/CameraLog.h"
 #include "iutils/Utils.h"
 #include "iutils/Errors.h"
 #include "ImageConverter.h"
+#include "PixelKernels.h"
 
 namespace icamera {
 namespace ImageConverter {
 
+namespace {
+// Pixels of one YUYV row split at a time, so the chroma fits in a stack buffer
+const int YUYV_CHUNK_PIXELS = 256;
+
+// Split one YUYV row into its Y, U and V, u or v can be nullptr if not needed
+void splitYUYVRow(const unsigned char *src, unsigned char *y, unsigned char *u,
+                  unsigned char *v, int width)
+{
+    unsigned char chroma[YUYV_CHUNK_PIXELS];
+    unsigned char unused[YUYV_CHUNK_PIXELS / 2];
+
+    for (int x = 0; x < width; x += YUYV_CHUNK_PIXELS) {
+        int n = std::min(YUYV_CHUNK_PIXELS, width - x);
+        PixelKernels::deinterleaveRow(src + x * 2, y + x, chroma, n);
+        if (u || v) {
+            PixelKernels::deinterleaveRow(chroma, u ? u + x / 2 : unused,
+                                          v ? v + x / 2 : unused, n / 2);
+        }
+    }
+}
+} // namespace
+
 void YUV420ToRGB565(int width, int height, void *src, void *dst)
 {
     int line, col, linewidth;
@@ -154,13 +179,7 @@ void convertYV12ToNV21(int width, int height, int srcStride, int dstStride, void
     unsigned char *srcPtrU = srcPtrV + cStride*hhalf;
     dstPtr = (unsigned char *)dst + dstStride*height;
     for (int i = 0; i < hhalf; ++i) {
-        unsigned char *pDstVU = dstPtr;
-        unsigned char *pSrcV = srcPtrV;
-        unsigned char *pSrcU = srcPtrU;
-        for (int j = 0; j < whalf; ++j) {
-            *pDstVU ++ = *pSrcV ++;
-            *pDstVU ++ = *pSrcU ++;
-        }
+        PixelKernels::interleaveRow(srcPtrV, srcPtrU, dstPtr, whalf);
         dstPtr += vuStride;
         srcPtrV += cStride;
         srcPtrU += cStride;
@@ -233,85 +252,7 @@ void trimConvertNV12ToNV21(int width, int height, int srcStride, void *src, void
     pSrc = (unsigned char *)src + srcStride * height;
     pDst = (unsigned char *)dst + width * height;
     for (int j = 0; j < height / 2; j++) {
-        if (width >= 16) {
-            const uint32_t *ptr0 = (const uint32_t *)(pSrc);
-            uint32_t *ptr1 = (uint32_t *)(pDst);
-            int bNotLastLine = ((j+1) == (height/2)) ? 0 : 1;
-            int width_16 = (width + 15 * bNotLastLine) & ~0xf;
-            if ((((uint64_t)(pSrc)) & 0xf) == 0 && (((uint64_t)(pDst)) & 0xf) == 0) { // 16 bytes aligned for both src and dest
-                __asm__ volatile(\
-                                 "movl       %0,  %%eax      \n\t"
-                                 "movl       %1,  %%edx      \n\t"
-                                 "movl       %2,  %%ecx      \n\t"
-                                 "1:     \n\t"
-                                 "movdqa (%%eax), %%xmm1     \n\t"
-                                 "movdqa  %%xmm1, %%xmm0     \n\t"
-                                 "psllw       $8, %%xmm1     \n\t"
-                                 "psrlw       $8, %%xmm0     \n\t"
-                                 "por     %%xmm0, %%xmm1     \n\t"
-                                 "movdqa  %%xmm1, (%%edx)    \n\t"
-                                 "add        $16, %%eax      \n\t"
-                                 "add        $16, %%edx      \n\t"
-                                 "sub        $16, %%ecx      \n\t"
-                                 "jnz   1b \n\t"
-                                 : "+m"(ptr0), "+m"(ptr1), "+m"(width_16)
-                                 :
-                                 : "eax", "ecx", "edx", "xmm0", "xmm1"
-                                );
-            }
-            else { // either src or dest is not 16-bytes aligned
-                __asm__ volatile(\
-                                 "movl       %0,  %%eax      \n\t"
-                                 "movl       %1,  %%edx      \n\t"
-                                 "movl       %2,  %%ecx      \n\t"
-                                 "1:     \n\t"
-                                 "lddqu  (%%eax), %%xmm1     \n\t"
-                                 "movdqa  %%xmm1, %%xmm0     \n\t"
-                                 "psllw       $8, %%xmm1     \n\t"
-                                 "psrlw       $8, %%xmm0     \n\t"
-                                 "por     %%xmm0, %%xmm1     \n\t"
-                                 "movdqu  %%xmm1, (%%edx)    \n\t"
-                                 "add        $16, %%eax      \n\t"
-                                 "add        $16, %%edx      \n\t"
-                                 "sub        $16, %%ecx      \n\t"
-                                 "jnz   1b \n\t"
-                                 : "+m"(ptr0), "+m"(ptr1), "+m"(width_16)
-                                 :
-                                 : "eax", "ecx", "edx", "xmm0", "xmm1"
-                                );
-            }
-
-            // process remaining data of less than 16 bytes of last row
-            for (int i = width_16; i < width; i += 2) {
-                pDst[i] = pSrc[i + 1];
-                pDst[i + 1] = pSrc[i];
-            }
-        }
-        else if ((((uint64_t)(pSrc)) & 0x3) == 0 && (((uint64_t)(pDst)) & 0x3) == 0){  // 4 bytes aligned for both src and dest
-            const uint32_t *ptr0 = (const uint32_t *)(pSrc);
-            uint32_t *ptr1 = (uint32_t *)(pDst);
-            int width_4 = width & ~3;
-            for (int i = 0; i < width_4; i += 4) {
-                uint32_t data0 = *ptr0++;
-                uint32_t data1 = (data0 >> 8) & 0x00ff00ff;
-                uint32_t data2 = (data0 << 8) & 0xff00ff00;
-                *ptr1++ = data1 | data2;
-            }
-            // process remaining data of less than 4 bytes at end of each row
-            for (int i = width_4; i < width; i += 2) {
-                pDst[i] = pSrc[i + 1];
-                pDst[i + 1] = pSrc[i];
-            }
-        }
-        else {
-            unsigned const char *ptr0 = pSrc;
-            unsigned char *ptr1 = pDst;
-            for (int i = 0; i < width; i += 2) {
-                *ptr1++ = ptr0[1];
-                *ptr1++ = ptr0[0];
-                ptr0 += 2;
-            }
-        }
+        PixelKernels::swapPairsRow(pSrc, pDst, (width + 1) / 2);
         pDst += width;
         pSrc += srcStride;
     }
@@ -350,10 +291,7 @@ void convertNV12ToYV12(int width, int height, int srcStride, void *src, void *ds
     int halfHeight = height / 2;
     int halfWidth = width / 2;
     for ( int i = 0; i < halfHeight; ++i) {
-        for ( int j = 0; j < halfWidth; ++j) {
-            dstPtrV[j] = srcPtr[j * 2 + 1];
-            dstPtrU[j] = srcPtr[j * 2];
-        }
+        PixelKernels::deinterleaveRow(srcPtr, dstPtrU, dstPtrV, halfWidth);
         srcPtr += srcStride;
         dstPtrV += cStride;
         dstPtrU += cStride;
@@ -391,10 +329,7 @@ void align16ConvertNV12ToYV12(int width, int height, int srcStride, void *src, v
 
     // deinterlace the UV data
     for ( int i = 0; i < height / 2; ++i) {
-        for ( int j = 0; j < width / 2; ++j) {
-            dstPtrV[j] = srcPtr[j * 2 + 1];
-            dstPtrU[j] = srcPtr[j * 2];
-        }
+        PixelKernels::deinterleaveRow(srcPtr, dstPtrU, dstPtrV, width / 2);
         srcPtr += srcStride;
         dstPtrV += cStride;
         dstPtrU += cStride;
@@ -415,22 +350,12 @@ void YUY2ToP411(int width, int height, int stride, void *src, void *dst)
 
     for (int i = 0; i < height; i++) {
         //The first line of the source
-        //Copy first Y Plane first
-        for (int j=0; j < width; j++) {
-            dstPtr[j] = srcPtr[j*2];
-        }
-
+        //Copy Y plane, and the V plane for odd lines, the U plane for even lines
         if (i & 1) {
-            //Copy the V plane
-            for (int k = 0; k < wHalf; k++) {
-                dstPtrV[k] = srcPtr[k * 4 + 3];
-            }
+            splitYUYVRow(srcPtr, dstPtr, nullptr, dstPtrV, width);
             dstPtrV = dstPtrV + wHalf;
         } else {
-            //Copy the U plane
-            for (int k = 0; k< wHalf; k++) {
-                dstPtrU[k] = srcPtr[k * 4 + 1];
-            }
+            splitYUYVRow(srcPtr, dstPtr, dstPtrU, nullptr, width);
             dstPtrU = dstPtrU + wHalf;
         }
 
@@ -443,7 +368,7 @@ void YUY2ToP411(int width, int height, int stride, void *src, void *dst)
 void NV12ToP411Separate(int width, int height, int stride,
                                 void *srcY, void *srcUV, void *dst)
 {
-    int i, j, p, q;
+    int i;
     unsigned char *psrcY = (unsigned char *) srcY;
     unsigned char *pdstY = (unsigned char *) dst;
     unsigned char *pdstU, *pdstV;
@@ -460,17 +385,9 @@ void NV12ToP411Separate(int width, int height, int stride,
     psrcUV = (unsigned char *)srcUV;
     pdstU = (unsigned char *)dst + width * height;
     pdstV = pdstU + width * height / 4;
-    p = q = 0;
     for (i = 0; i < height / 2; i++) {
-        for (j = 0; j < width; j++) {
-            if (j % 2 == 0) {
-                pdstU[p] = (psrcUV[i * stride + j] & 0xFF);
-                p++;
-           } else {
-                pdstV[q] = (psrcUV[i * stride + j] & 0xFF);
-                q++;
-            }
-        }
+        PixelKernels::deinterleaveRow(psrcUV + i * stride, pdstU + i * (width / 2),
+                                      pdstV + i * (width / 2), width / 2);
     }
 }
 
@@ -485,7 +402,7 @@ void NV12ToP411(int width, int height, int stride, void *src, void *dst)
 void NV21ToP411Separate(int width, int height, int stride,
                         void *srcY, void *srcUV, void *dst)
 {
-    int i, j, p, q;
+    int i;
     unsigned char *psrcY = (unsigned char *) srcY;
     unsigned char *pdstY = (unsigned char *) dst;
     unsigned char *pdstU, *pdstV;
@@ -502,17 +419,9 @@ void NV21ToP411Separate(int width, int height, int stride,
     psrcUV = (unsigned char *)srcUV;
     pdstU = (unsigned char *)dst + width * height;
     pdstV = pdstU + width * height / 4;
-    p = q = 0;
     for (i = 0; i < height / 2; i++) {
-        for (j = 0; j < width; j++) {
-            if ((j & 1) == 0) {
-                pdstV[p] = (psrcUV[i * stride + j] & 0xFF);
-                p++;
-           } else {
-                pdstU[q] = (psrcUV[i * stride + j] & 0xFF);
-                q++;
-            }
-        }
+        PixelKernels::deinterleaveRow(psrcUV + i * stride, pdstV + i * (width / 2),
+                                      pdstU + i * (width / 2), width / 2);
     }
 }
 
@@ -528,7 +437,7 @@ void NV21ToP411(int width, int height, int stride, void *src, void *dst)
 // But the NV12's U and V are interleaved.
 void NV12ToIMC3(int width, int height, int stride, void *srcY, void *srcUV, void *dst)
 {
-    int i, j, p, q;
+    int i;
     unsigned char *pdstU, *pdstV;
     unsigned char *psrcUV;
 
@@ -538,19 +447,9 @@ void NV12ToIMC3(int width, int height, int stride, void *srcY, void *srcUV, void
     psrcUV = (unsigned char *)srcUV;
     pdstU = (unsigned char *)dst + stride * height;
     pdstV = pdstU + stride * height / 2;
-    p = q = 0;
     for (i = 0; i < height / 2; i++) {
-        for (j = 0; j < width; j++) {
-            if (j % 2 == 0) {
-                pdstU[p]= (psrcUV[i * stride + j] & 0xFF) ;
-                p++;
-           } else {
-                pdstV[q]= (psrcUV[i * stride + j] & 0xFF);
-                q++;
-            }
-        }
-        p += stride - width/2;
-        q += stride - width/2;
+        PixelKernels::deinterleaveRow(psrcUV + i * stride, pdstU + i * stride,
+                                      pdstV + i * stride, width / 2);
     }
 }
 
@@ -559,7 +458,7 @@ void NV12ToIMC3(int width, int height, int stride, void *srcY, void *srcUV, void
 // But the NV12's U and V are interleaved.
 void NV12ToIMC1(int width, int height, int stride, void *srcY, void *srcUV, void *dst)
 {
-    int i, j, p, q;
+    int i;
     unsigned char *pdstU, *pdstV;
     unsigned char *psrcUV;
 
@@ -569,19 +468,9 @@ void NV12ToIMC1(int width, int height, int stride, void *srcY, void *srcUV, void
     psrcUV = (unsigned char *)srcUV;
     pdstV = (unsigned char *)dst + stride * height;
     pdstU = pdstV + stride * height / 2;
-    p = q = 0;
     for (i = 0; i < height / 2; i++) {
-        for (j = 0; j < width; j++) {
-            if (j % 2 == 0) {
-                pdstU[p]= (psrcUV[i * stride + j] & 0xFF) ;
-                p++;
-           } else {
-                pdstV[q]= (psrcUV[i * stride + j] & 0xFF);
-                q++;
-            }
-        }
-        p += stride - width/2;
-        q += stride - width/2;
+        PixelKernels::deinterleaveRow(psrcUV + i * stride, pdstU + i * stride,
+                                      pdstV + i * stride, width / 2);
     }
 }
 
@@ -646,7 +535,6 @@ void convertYUYVToYV12(int width, int height, int srcStride, int dstStride, void
 {
     int ySize = width * height;
     int cSize = ALIGN_16(dstStride/2) * height / 2;
-    int wHalf = width >> 1;
 
     unsigned char *srcPtr = (unsigned char *) src;
     unsigned char *dstPtr = (unsigned char *) dst;
@@ -655,22 +543,12 @@ void convertYUYVToYV12(int width, int height, int srcStride, int dstStride, void
 
     for (int i = 0; i < height; i++) {
         //The first line of the source
-        //Copy first Y Plane first
-        for (int j=0; j < width; j++) {
-            dstPtr[j] = srcPtr[j*2];
-        }
-
+        //Copy Y plane, and the V plane for odd lines, the U plane for even lines
         if (i & 1) {
-            //Copy the V plane
-            for (int k = 0; k< wHalf; k++) {
-                dstPtrV[k] = srcPtr[k * 4 + 3];
-            }
+            splitYUYVRow(srcPtr, dstPtr, nullptr, dstPtrV, width);
             dstPtrV = dstPtrV + ALIGN_16(dstStride>>1);
         } else {
-            //Copy the U plane
-            for (int k = 0; k< wHalf; k++) {
-                dstPtrU[k] = srcPtr[k * 4 + 1];
-            }
+            splitYUYVRow(srcPtr, dstPtr, dstPtrU, nullptr, width);
             dstPtrU = dstPtrU + ALIGN_16(dstStride>>1);
         }
 
@@ -683,30 +561,24 @@ void convertYUYVToYV12(int width, int height, int srcStride, int dstStride, void
 void convertYUYVToNV21(int width, int height, int srcStride, void *src, void *dst)
 {
     int ySize = width * height;
-    int u_counter=1, v_counter=0;
+    unsigned char chroma[YUYV_CHUNK_PIXELS];
 
     unsigned char *srcPtr = (unsigned char *) src;
     unsigned char *dstPtr = (unsigned char *) dst;
     unsigned char *dstPtrUV = (unsigned char *) dst + ySize;
 
     for (int i=0; i < height; i++) {
-        //The first line of the source
-        //Copy first Y Plane first
-        for (int j=0; j < width * 2; j++) {
-            if (j % 2 == 0) {
-                dstPtr[j/2] = srcPtr[j];
-            }
-            if (i%2) {
-                if (( j % 4 ) == 3) {
-                    dstPtrUV[v_counter] = srcPtr[j]; //V plane
-                    v_counter += 2;
-                }
-                if (( j % 4 ) == 1) {
-                    dstPtrUV[u_counter] = srcPtr[j]; //U plane
-                    u_counter += 2;
-                }
+        //Copy Y plane, and the VU of odd lines
+        for (int x = 0; x < width; x += YUYV_CHUNK_PIXELS) {
+            int n = std::min(YUYV_CHUNK_PIXELS, width - x);
+            PixelKernels::deinterleaveRow(srcPtr + x * 2, dstPtr + x, chroma, n);
+            if (i % 2) {
+                PixelKernels::swapPairsRow(chroma, dstPtrUV + x, n / 2);
             }
         }
+        if (i % 2) {
+            dstPtrUV = dstPtrUV + width;
+        }
 
         srcPtr = srcPtr + srcStride * 2;
         dstPtr = dstPtr + width;
@@ -715,31 +587,19 @@ void convertYUYVToNV21(int width, int height, int srcStride, void *src, void *ds
 
 void convertNV12ToYUYV(int srcWidth, int srcHeight, int srcStride, int dstStride, const void *src, void *dst)
 {
-    int y_counter = 0, u_counter = 1, v_counter = 3, uv_counter = 0;
     unsigned char *srcYPtr = (unsigned char *) src;
     unsigned char *srcUVPtr = (unsigned char *)src + srcWidth * srcHeight;
     unsigned char *dstPtr = (unsigned char *) dst;
 
     for (int i = 0; i < srcHeight; i++) {
-        for (int k = 0; k < srcWidth; k++) {
-                dstPtr[y_counter] = srcYPtr[k];
-                y_counter += 2;
-                dstPtr[u_counter] = srcUVPtr[uv_counter];
-                u_counter += 4;
-                dstPtr[v_counter] = srcUVPtr[uv_counter + 1];
-                v_counter += 4;
-                uv_counter += 2;
-        }
+        // Y0 U0 Y1 V0 ... is the Y line interleaved with the UV line
+        PixelKernels::interleaveRow(srcYPtr, srcUVPtr, dstPtr, srcWidth);
         if ((i % 2) == 0) {
             srcUVPtr = srcUVPtr + srcStride;
         }
 
         dstPtr = dstPtr + 2 * dstStride;
         srcYPtr = srcYPtr + srcStride;
-        u_counter = 1;
-        v_counter = 3;
-        y_counter = 0;
-        uv_counter = 0;
     }
 }
 
@@ -0,0 +1,148 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ImageRotator.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "PixelKernels.h"
+
+namespace icamera {
+namespace ImageRotator {
+
+namespace {
+// Elements per side of a tile: 64 lines of 64 bytes (or pairs) stay in L1
+const int TILE_SIZE = 64;
+
+/**
+ * Rotate a plane of 1 or 2 (elementSize) bytes elements.
+ * 90:  dst[y][x] = src[height - 1 - x][y], the transpose of the vertically flipped source
+ * 270: dst[y][x] = src[x][width - 1 - y], the transpose written to a vertically flipped dest
+ */
+void rotatePlane(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                 int width, int height, int elementSize, int angle)
+{
+    if (angle == 0 || angle == 180) {
+        for (int y = 0; y < height; y++) {
+            uint8_t *dstLine = dst + y * dstStride;
+            if (angle == 0) {
+                memcpy(dstLine, src + y * srcStride, width * elementSize);
+            } else if (elementSize == 1) {
+                PixelKernels::reverseRow(src + (height - 1 - y) * srcStride, dstLine, width);
+            } else {
+                PixelKernels::reversePairsRow(src + (height - 1 - y) * srcStride, dstLine, width);
+            }
+        }
+        return;
+    }
+
+    if (angle == 90) {
+        src += (height - 1) * srcStride;
+        srcStride = -srcStride;
+    } else {
+        dst += (width - 1) * dstStride;
+        dstStride = -dstStride;
+    }
+
+    for (int ty = 0; ty < height; ty += TILE_SIZE) {
+        int th = std::min(TILE_SIZE, height - ty);
+        for (int tx = 0; tx < width; tx += TILE_SIZE) {
+            int tw = std::min(TILE_SIZE, width - tx);
+            const uint8_t *tileSrc = src + ty * srcStride + tx * elementSize;
+            uint8_t *tileDst = dst + tx * dstStride + ty * elementSize;
+            if (elementSize == 1) {
+                PixelKernels::transposeRect(tileSrc, srcStride, tileDst, dstStride, tw, th);
+            } else {
+                PixelKernels::transposePairRect(tileSrc, srcStride, tileDst, dstStride, tw, th);
+            }
+        }
+    }
+}
+} // namespace
+
+void rotateNV12(int width, int height, int srcStride, int dstStride, const uint8_t *src,
+                uint8_t *dst, int angle)
+{
+    bool swap = (angle == 90 || angle == 270);
+    int dstHeight = swap ? width : height;
+
+    rotatePlane(src, srcStride, dst, dstStride, width, height, 1, angle);
+    rotatePlane(src + srcStride * height, srcStride, dst + dstStride * dstHeight, dstStride,
+                width / 2, height / 2, 2, angle);
+}
+
+void rotateYUYV(int width, int height, int srcStride, int dstStride, const uint8_t *src,
+                uint8_t *dst, int angle, std::vector<uint8_t> &rotateBuf)
+{
+    if (angle == 0) {
+        for (int y = 0; y < height; y++) {
+            memcpy(dst + y * dstStride, src + y * srcStride, width * 2);
+        }
+        return;
+    }
+
+    if (angle == 180) {
+        // Y0 U Y1 V -> Y1 U Y0 V, with the pairs in reverse order
+        for (int y = 0; y < height; y++) {
+            const uint8_t *s = src + (height - 1 - y) * srcStride + (width - 2) * 2;
+            uint8_t *d = dst + y * dstStride;
+            for (int x = 0; x < width; x += 2, s -= 4, d += 4) {
+                d[0] = s[2];
+                d[1] = s[1];
+                d[2] = s[0];
+                d[3] = s[3];
+            }
+        }
+        return;
+    }
+
+    /*
+     * The chroma of a YUYV pair is shared by 2 horizontal pixels, which become 2 vertical
+     * pixels after rotating. So split the luma and the chroma, rotate them separately,
+     * and average the chroma of the 2 pixels of each dest pair when packing them back.
+     */
+    size_t planeSize = static_cast<size_t>(width) * height;
+    if (rotateBuf.size() < planeSize * 4 + height) {
+        rotateBuf.resize(planeSize * 4 + height);
+    }
+    uint8_t *luma = rotateBuf.data();
+    uint8_t *chroma = luma + planeSize;
+    uint8_t *rotatedLuma = chroma + planeSize;
+    uint8_t *rotatedChroma = rotatedLuma + planeSize;
+    uint8_t *chromaLine = rotatedChroma + planeSize;
+
+    for (int y = 0; y < height; y++) {
+        PixelKernels::deinterleaveRow(src + y * srcStride, luma + y * width, chroma + y * width,
+                                      width);
+    }
+    rotatePlane(luma, width, rotatedLuma, height, width, height, 1, angle);
+    rotatePlane(chroma, width, rotatedChroma, height * 2, width / 2, height, 2, angle);
+
+    for (int y = 0; y < width; y++) {
+        const uint8_t *uv = rotatedChroma + (y / 2) * height * 2;
+        for (int x = 0; x < height; x += 2) {
+            chromaLine[x] = (uv[x * 2] + uv[x * 2 + 2] + 1) >> 1;
+            chromaLine[x + 1] = (uv[x * 2 + 1] + uv[x * 2 + 3] + 1) >> 1;
+        }
+        PixelKernels::interleaveRow(rotatedLuma + y * height, chromaLine, dst + y * dstStride,
+                                    height);
+    }
+}
+
+} // namespace ImageRotator
+} // namespace icamera
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace icamera {
+
+/**
+ * Clockwise rotation of 0, 90, 180 or 270 degrees. width and height are the ones of
+ * the source, they are swapped in the dest for 90 and 270. The strides are in bytes.
+ *
+ * The 90 and 270 rotations are done by transposing the planes tile by tile, so that
+ * the source and dest lines of a tile stay in the cache.
+ */
+namespace ImageRotator {
+
+// Also works for NV21, width and height must be even
+void rotateNV12(int width, int height, int srcStride, int dstStride, const uint8_t *src,
+                uint8_t *dst, int angle);
+// width and height must be even, rotateBuf is reused by the 90 and 270 rotations
+void rotateYUYV(int width, int height, int srcStride, int dstStride, const uint8_t *src,
+                uint8_t *dst, int angle, std::vector<uint8_t> &rotateBuf);
+
+} // namespace ImageRotator
+} // namespace icamera
@@ -17,11 +17,13 @@
 #define LOG_TAG ImageScalerCore
 
 #include <memory>
+#include <vector>
 #include <linux/videodev2.h>
 #include "iutils/Errors.h"
 #include "iutils/Utils.h"
 #include "iutils/CameraLog.h"
 #include "ImageScalerCore.h"
+#include "PixelKernels.h"
 
 #define RESOLUTION_VGA_WIDTH    640
 #define RESOLUTION_VGA_HEIGHT   480
@@ -33,6 +35,151 @@
 
 namespace icamera {
 
+namespace {
+// The sizes downScaleAndCropNv12Image() has dedicated implementations for
+bool isSpecialNv12Scale(int dest_w, int dest_h, int src_w, int src_h)
+{
+    if (src_w == 800 && src_h == 600
+        && dest_w == RESOLUTION_QVGA_WIDTH && dest_h == RESOLUTION_QVGA_HEIGHT) {
+        return true;
+    }
+    if (src_w == RESOLUTION_VGA_WIDTH && src_h == RESOLUTION_VGA_HEIGHT
+        && dest_w == RESOLUTION_QVGA_WIDTH && dest_h == RESOLUTION_QVGA_HEIGHT) {
+        return true;
+    }
+    return src_w == RESOLUTION_VGA_WIDTH && src_h == RESOLUTION_VGA_HEIGHT
+           && dest_w == RESOLUTION_QCIF_WIDTH && dest_h == RESOLUTION_QCIF_WIDTH;
+}
+
+// Positions and weights of the bilinear scale done by downScaleAndCropNv12Image()
+struct Nv12ScaleGeometry {
+    int lSkip;          // source columns cropped on the left
+    int scalingH;       // vertical step in 1/256 of source line
+    int srcYData;       // offset of the UV plane in the source
+    std::vector<int> xPos;
+    std::vector<int> xFrac;
+};
+
+bool getNv12ScaleGeometry(int dest_w, int dest_h, int src_w, int src_h, int src_stride,
+                          int src_skip_lines_top, int src_skip_lines_bottom,
+                          Nv12ScaleGeometry *geometry)
+{
+    if (0 == dest_w || 0 == dest_h) {
+        LOGE("%s,dest_w or dest_h should not be 0", __func__);
+        return false;
+    }
+
+    // Correct aspect ratio is defined by destination buffer
+    long int aspect_ratio = (dest_w << 16) / dest_h;
+    // Then, we calculate what should be the width of source image
+    // (should be multiple by four)
+    int proper_source_width = (aspect_ratio * (long int)(src_h) + 0x8000L) >> 16;
+    proper_source_width = (proper_source_width + 2) & ~0x3;
+    // Now, the source image should have some surplus width
+    if (src_w < proper_source_width) {
+        LOGE("%s: source image too narrow", __func__);
+    }
+    // Let's divide the surplus to both sides
+    int l_skip = src_w < proper_source_width ? 0 : ((src_w - proper_source_width) >> 1);
+    int r_skip = src_w < proper_source_width ? 0 : (src_w - proper_source_width - l_skip);
+    int skip = l_skip + r_skip;
+    const int scaling_w = ((src_w - skip) << 8) / dest_w;
+
+    geometry->lSkip = l_skip;
+    geometry->scalingH = (src_h << 8) / dest_h;
+    geometry->srcYData = src_stride * (src_h + src_skip_lines_bottom + (src_skip_lines_top >> 1));
+    // The horizontal positions and weights are the same for all the lines
+    geometry->xPos.resize(dest_w);
+    geometry->xFrac.resize(dest_w);
+    for (int j = 0; j < dest_w; j++) {
+        int x1 = j * scaling_w;
+        geometry->xFrac[j] = x1 & 0xff;
+        geometry->xPos[j] = x1 >> 8;
+    }
+    return true;
+}
+
+// Line sinks of scaleNv12Plane(): getLine() is where the line is scaled to,
+// putLine() moves it to its final place if it isn't there yet.
+struct PlaneLineSink {
+    unsigned char *dest;
+    int stride;
+
+    unsigned char *getLine(int i) { return dest + i * stride; }
+    void putLine(int i, const unsigned char *line) {}
+};
+
+// Scaled UV line to the U and V planes of YV12
+struct SplitUVLineSink {
+    unsigned char *destU;
+    unsigned char *destV;
+    int stride;
+    int pairs;
+    std::vector<unsigned char> line;
+
+    unsigned char *getLine(int i) { return line.data(); }
+    void putLine(int i, const unsigned char *uv) {
+        PixelKernels::deinterleaveRow(uv, destU + i * stride, destV + i * stride, pairs);
+    }
+};
+
+// Scaled UV line to the VU plane of NV21
+struct SwapUVLineSink {
+    unsigned char *destVU;
+    int stride;
+    int pairs;
+    std::vector<unsigned char> line;
+
+    unsigned char *getLine(int i) { return line.data(); }
+    void putLine(int i, const unsigned char *uv) {
+        PixelKernels::swapPairsRow(uv, destVU + i * stride, pairs);
+    }
+};
+
+/**
+ * Bilinear scale of one NV12 plane, with `components` interleaved bytes per sample.
+ * The horizontal pass of each source line is done once and kept while the next
+ * dest line still needs it, the vertical pass is done by PixelKernels::blendRows.
+ */
+template <typename LineSink>
+void scaleNv12Plane(LineSink *sink, const unsigned char *src, int srcStride,
+                    const Nv12ScaleGeometry &geometry, int width, int height, int components)
+{
+    const std::vector<int> &xPos = geometry.xPos;
+    const std::vector<int> &xFrac = geometry.xFrac;
+    const int count = width * components;
+    // Line y is kept in slot y & 1, so a line and the next one never evict each other
+    std::vector<uint16_t> rows[2] = {std::vector<uint16_t>(count), std::vector<uint16_t>(count)};
+    int rowIndex[2] = {-1, -1};
+
+    auto getRow = [&](int y) -> const uint16_t * {
+        uint16_t *row = rows[y & 1].data();
+        if (rowIndex[y & 1] != y) {
+            const unsigned char *line = src + y * srcStride;
+            for (int j = 0; j < width; j++) {
+                const unsigned char *p = line + xPos[j] * components;
+                unsigned int dx = xFrac[j];
+                for (int c = 0; c < components; c++) {
+                    row[j * components + c] = (p[c] * (256 - dx) + p[c + components] * dx) >> 8;
+                }
+            }
+            rowIndex[y & 1] = y;
+        }
+        return row;
+    };
+
+    for (int i = 0; i < height; i++) {
+        int y1 = i * geometry.scalingH;
+        int y2 = y1 >> 8;
+        const uint16_t *row0 = getRow(y2);
+        const uint16_t *row1 = getRow(y2 + 1);
+        unsigned char *line = sink->getLine(i);
+        PixelKernels::blendRows(row0, row1, y1 & 0xff, line, count);
+        sink->putLine(i, line);
+    }
+}
+} // namespace
+
 void ImageScalerCore::downScaleImage(void *src, void *dest,
     int dest_w, int dest_h, int dest_stride,
     int src_w, int src_h, int src_stride,
@@ -229,77 +376,73 @@ void ImageScalerCore::downScaleAndCropNv12Image(unsigned char *dest, const unsig
         src += src_skip_lines_top * src_stride;
     }
 
-    // Correct aspect ratio is defined by destination buffer
-    long int aspect_ratio = (dest_w << 16) / dest_h;
-    // Then, we calculate what should be the width of source image
-    // (should be multiple by four)
-    int proper_source_width = (aspect_ratio * (long int)(src_h) + 0x8000L) >> 16;
-    proper_source_width = (proper_source_width + 2) & ~0x3;
-    // Now, the source image should have some surplus width
-    if (src_w < proper_source_width) {
-        LOGE("%s: source image too narrow", __func__);
-    }
-    // Let's divide the surplus to both sides
-    int l_skip = src_w < proper_source_width ? 0 : ((src_w - proper_source_width) >> 1);
-    int r_skip = src_w < proper_source_width ? 0 : (src_w - proper_source_width - l_skip);
-    int skip = l_skip + r_skip;
-
-    int i, j, x1, y1, x2, y2;
-    unsigned int val_1, val_2;
-    int dx, dy;
-    int src_Y_data = src_stride * (src_h + src_skip_lines_bottom + (src_skip_lines_top >> 1));
-    int dest_Y_data = dest_stride * dest_h;
-    int width, height;
-    if (0 == dest_w || 0 == dest_h) {
-        LOGE("%s,dest_w or dest_h should not be 0", __func__);
+    Nv12ScaleGeometry geometry;
+    if (!getNv12ScaleGeometry(dest_w, dest_h, src_w, src_h, src_stride, src_skip_lines_top,
+                              src_skip_lines_bottom, &geometry)) {
         return;
     }
-    const int scaling_w = ((src_w - skip) << 8) / dest_w;
-    const int scaling_h = (src_h << 8) / dest_h;
-    dx = 0;
-    dy = 0;
+
     // get Y data
-    for (i = 0; i < dest_h; i++) {
-        y1 = i * scaling_h;
-        dy = y1 & 0xff;
-        y2 = y1 >> 8;
-        for (j = 0; j < dest_w; j++) {
-            x1 = j * scaling_w;
-            dx = x1 & 0xff;
-            x2 = (x1 >> 8) + l_skip;
-            val_1 = ((unsigned int)src[y2 * src_stride + x2] * (256 - dx)
-                    + (unsigned int)src[y2 * src_stride + x2 + 1] * dx) >> 8;
-            val_2 = ((unsigned int)src[(y2 + 1) * src_stride + x2] * (256 - dx)
-                    + (unsigned int)src[(y2 + 1) * src_stride + x2 + 1] * dx) >> 8;
-            dest[i * dest_stride + j] = MIN(((val_1 * (256 - dy) + val_2 * dy) >> 8), 0xff);
-        }
-    }
-    i = 0;
-    j = 0;
-    width = dest_w >> 1;
-    height = dest_h >> 1;
+    PlaneLineSink ySink = {dest, dest_stride};
+    scaleNv12Plane(&ySink, src + geometry.lSkip, src_stride, geometry, dest_w, dest_h, 1);
+
     //get UV data
-    for (i = 0; i < height; i++) {
-        y1 = i * scaling_h;
-        dy = y1 & 0xff;
-        y2 = y1 >> 8;
-        for (j = 0; j < width; j++) {
-            x1 = j * scaling_w;
-            dx = x1 & 0xff;
-            x2 = (x1 >> 8) + l_skip / 2;
-            //fill U data
-            val_1 = ((unsigned int)src[y2 * src_stride + (x2 << 1) + src_Y_data] * (256 - dx)
-                     + (unsigned int)src[y2 * src_stride + ((x2 + 1) << 1) + src_Y_data] * dx) >> 8;
-            val_2 = ((unsigned int)src[(y2 + 1) * src_stride + (x2 << 1) + src_Y_data] * (256 -dx)
-                     + (unsigned int)src[(y2 +1) * src_stride + ((x2 + 1) << 1) + src_Y_data] * dx) >> 8;
-            dest[i * dest_stride + (j << 1) + dest_Y_data] = MIN(((val_1 * (256 - dy) + val_2 * dy) >> 8), 0xff);
-            //fill V data
-            val_1 = ((unsigned int)src[y2 * src_stride + (x2 << 1) + 1 + src_Y_data] * (256 - dx)
-                     + (unsigned int)src[y2 * src_stride + ((x2 + 1) << 1) + 1 + src_Y_data] * dx) >> 8;
-            val_2 = ((unsigned int)src[(y2 + 1) * src_stride + (x2 << 1) + 1 + src_Y_data] * (256 -dx)
-                     + (unsigned int)src[(y2 +1) * src_stride + ((x2 + 1) << 1) + 1 + src_Y_data] * dx) >> 8;
-            dest[i * dest_stride + (j << 1) + 1 + dest_Y_data] = MIN(((val_1 * (256 - dy) + val_2 * dy) >> 8), 0xff);
-        }
+    PlaneLineSink uvSink = {dest + dest_stride * dest_h, dest_stride};
+    scaleNv12Plane(&uvSink, src + geometry.srcYData + (geometry.lSkip / 2) * 2, src_stride,
+                   geometry, dest_w >> 1, dest_h >> 1, 2);
+}
+
+bool ImageScalerCore::isDownScaleAndConvertSupported(int src_w, int src_h, int src_format,
+                                                     int dest_w, int dest_h, int dest_format)
+{
+    if (src_format != V4L2_PIX_FMT_NV12 ||
+        (dest_format != V4L2_PIX_FMT_NV21 && dest_format != V4L2_PIX_FMT_YVU420)) {
+        return false;
+    }
+    if (dest_w <= 0 || dest_h <= 0 || (src_w & 1) || (src_h & 1) || (dest_w & 1) || (dest_h & 1)) {
+        return false;
+    }
+    // Only the generic path of downScaleImage() is done in one pass
+    if ((dest_w == src_w && dest_h <= src_h) || (dest_w <= src_w && dest_h == src_h)) {
+        return false;
+    }
+    return !isSpecialNv12Scale(dest_w, dest_h, src_w, src_h);
+}
+
+void ImageScalerCore::downScaleAndConvertNv12Image(unsigned char *dest, const unsigned char *src,
+                                                   const int dest_w, const int dest_h,
+                                                   const int dest_format, const int src_w,
+                                                   const int src_h, const int src_stride)
+{
+    LOG2("@%s: dest_w: %d, dest_h: %d, dest_format: 0x%x, src_w: %d, src_h: %d, src_stride: %d",
+         __func__, dest_w, dest_h, dest_format, src_w, src_h, src_stride);
+
+    Nv12ScaleGeometry geometry;
+    if (!getNv12ScaleGeometry(dest_w, dest_h, src_w, src_h, src_stride, 0, 0, &geometry)) {
+        return;
+    }
+    const unsigned char *srcY = src + geometry.lSkip;
+    const unsigned char *srcUV = src + geometry.srcYData + (geometry.lSkip / 2) * 2;
+
+    // Same layouts as ImageConverter::convertBuftoNV21() and convertBuftoYV12()
+    if (dest_format == V4L2_PIX_FMT_NV21) {
+        PlaneLineSink ySink = {dest, dest_w};
+        scaleNv12Plane(&ySink, srcY, src_stride, geometry, dest_w, dest_h, 1);
+
+        SwapUVLineSink vuSink = {dest + dest_w * dest_h, dest_w, dest_w / 2,
+                                   std::vector<unsigned char>(dest_w)};
+        scaleNv12Plane(&vuSink, srcUV, src_stride, geometry, dest_w / 2, dest_h / 2, 2);
+    } else {
+        int yStride = ALIGN_16(dest_w);
+        int cStride = ALIGN_16(yStride / 2);
+        PlaneLineSink ySink = {dest, yStride};
+        scaleNv12Plane(&ySink, srcY, src_stride, geometry, dest_w, dest_h, 1);
+
+        unsigned char *destV = dest + yStride * dest_h;
+        unsigned char *destU = destV + cStride * dest_h / 2;
+        SplitUVLineSink uvSink = {destU, destV, cStride, dest_w / 2,
+                                   std::vector<unsigned char>(dest_w)};
+        scaleNv12Plane(&uvSink, srcUV, src_stride, geometry, dest_w / 2, dest_h / 2, 2);
     }
 }
 
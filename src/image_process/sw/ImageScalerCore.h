@@ -35,6 +35,18 @@ public:
                                unsigned int width, unsigned int height, unsigned int stride, int format,
                                unsigned int srcCropW, unsigned int srcCropH, unsigned int srcCropLeft, unsigned int srcCropTop);
 
+    /**
+     * Same result as downScaleImage() followed by ImageConverter::convertBuftoXXX(),
+     * in one pass without the intermediate frame. The scaled lines are written in the
+     * dest format directly. Only for the sizes and formats the check below accepts.
+     */
+    static bool isDownScaleAndConvertSupported(int src_w, int src_h, int src_format,
+                                               int dest_w, int dest_h, int dest_format);
+    static void downScaleAndConvertNv12Image(unsigned char *dest, const unsigned char *src,
+                                             const int dest_w, const int dest_h,
+                                             const int dest_format, const int src_w,
+                                             const int src_h, const int src_stride);
+
 protected:
     static void downScaleYUY2Image(unsigned char *dest, const unsigned char *src,
                                    const int dest_w, const int dest_h, const int dest_stride,
@@ -0,0 +1,457 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PixelKernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PIXEL_KERNELS_X86
+#endif
+
+namespace icamera {
+namespace PixelKernels {
+
+namespace Scalar {
+
+void deinterleaveRow(const uint8_t *src, uint8_t *even, uint8_t *odd, int pairs)
+{
+    for (int i = 0; i < pairs; i++) {
+        even[i] = src[i * 2];
+        odd[i] = src[i * 2 + 1];
+    }
+}
+
+void swapPairsRow(const uint8_t *src, uint8_t *dst, int pairs)
+{
+    for (int i = 0; i < pairs; i++) {
+        uint8_t first = src[i * 2];
+        dst[i * 2] = src[i * 2 + 1];
+        dst[i * 2 + 1] = first;
+    }
+}
+
+void interleaveRow(const uint8_t *even, const uint8_t *odd, uint8_t *dst, int pairs)
+{
+    for (int i = 0; i < pairs; i++) {
+        dst[i * 2] = even[i];
+        dst[i * 2 + 1] = odd[i];
+    }
+}
+
+void blendRows(const uint16_t *row0, const uint16_t *row1, int weight, uint8_t *dst, int count)
+{
+    for (int i = 0; i < count; i++) {
+        dst[i] = (row0[i] * (256 - weight) + row1[i] * weight) >> 8;
+    }
+}
+
+void transposeRect(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                   int width, int height)
+{
+    for (int y = 0; y < height; y++) {
+        const uint8_t *s = src + y * srcStride;
+        for (int x = 0; x < width; x++) {
+            dst[x * dstStride + y] = s[x];
+        }
+    }
+}
+
+void transposePairRect(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                       int width, int height)
+{
+    for (int y = 0; y < height; y++) {
+        const uint8_t *s = src + y * srcStride;
+        for (int x = 0; x < width; x++) {
+            dst[x * dstStride + y * 2] = s[x * 2];
+            dst[x * dstStride + y * 2 + 1] = s[x * 2 + 1];
+        }
+    }
+}
+
+void reverseRow(const uint8_t *src, uint8_t *dst, int count)
+{
+    for (int i = 0; i < count; i++) {
+        dst[i] = src[count - 1 - i];
+    }
+}
+
+void reversePairsRow(const uint8_t *src, uint8_t *dst, int pairs)
+{
+    for (int i = 0; i < pairs; i++) {
+        dst[i * 2] = src[(pairs - 1 - i) * 2];
+        dst[i * 2 + 1] = src[(pairs - 1 - i) * 2 + 1];
+    }
+}
+
+} // namespace Scalar
+
+#ifdef PIXEL_KERNELS_X86
+namespace {
+
+// SSE2 is the baseline of x86_64, so it needs no target attribute there
+__attribute__((target("sse2")))
+void deinterleaveRowSse2(const uint8_t *src, uint8_t *even, uint8_t *odd, int pairs)
+{
+    const __m128i mask = _mm_set1_epi16(0x00ff);
+    int i = 0;
+    for (; i + 16 <= pairs; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2 + 16));
+        __m128i e = _mm_packus_epi16(_mm_and_si128(a, mask), _mm_and_si128(b, mask));
+        __m128i o = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(even + i), e);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(odd + i), o);
+    }
+    Scalar::deinterleaveRow(src + i * 2, even + i, odd + i, pairs - i);
+}
+
+__attribute__((target("sse2")))
+void swapPairsRowSse2(const uint8_t *src, uint8_t *dst, int pairs)
+{
+    int i = 0;
+    for (; i + 8 <= pairs; i += 8) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * 2));
+        a = _mm_or_si128(_mm_slli_epi16(a, 8), _mm_srli_epi16(a, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2), a);
+    }
+    Scalar::swapPairsRow(src + i * 2, dst + i * 2, pairs - i);
+}
+
+__attribute__((target("sse2")))
+void interleaveRowSse2(const uint8_t *even, const uint8_t *odd, uint8_t *dst, int pairs)
+{
+    int i = 0;
+    for (; i + 16 <= pairs; i += 16) {
+        __m128i e = _mm_loadu_si128(reinterpret_cast<const __m128i *>(even + i));
+        __m128i o = _mm_loadu_si128(reinterpret_cast<const __m128i *>(odd + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2), _mm_unpacklo_epi8(e, o));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2 + 16), _mm_unpackhi_epi8(e, o));
+    }
+    Scalar::interleaveRow(even + i, odd + i, dst + i * 2, pairs - i);
+}
+
+__attribute__((target("sse2")))
+void blendRowsSse2(const uint16_t *row0, const uint16_t *row1, int weight, uint8_t *dst,
+                   int count)
+{
+    // The sum is at most 255 * 256, so 16 bits are enough
+    const __m128i w0 = _mm_set1_epi16(256 - weight);
+    const __m128i w1 = _mm_set1_epi16(weight);
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + i));
+        __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + i + 8));
+        __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + i));
+        __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + i + 8));
+        __m128i v0 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(a0, w0),
+                                                  _mm_mullo_epi16(b0, w1)), 8);
+        __m128i v1 = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(a1, w0),
+                                                  _mm_mullo_epi16(b1, w1)), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_packus_epi16(v0, v1));
+    }
+    Scalar::blendRows(row0 + i, row1 + i, weight, dst + i, count - i);
+}
+
+// Transpose one 8x8 block of bytes
+__attribute__((target("sse2")))
+void transpose8x8Sse2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride)
+{
+    __m128i r[8];
+    for (int i = 0; i < 8; i++) {
+        r[i] = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(src + i * srcStride));
+    }
+    __m128i a0 = _mm_unpacklo_epi8(r[0], r[1]);
+    __m128i a1 = _mm_unpacklo_epi8(r[2], r[3]);
+    __m128i a2 = _mm_unpacklo_epi8(r[4], r[5]);
+    __m128i a3 = _mm_unpacklo_epi8(r[6], r[7]);
+    __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+    __m128i b1 = _mm_unpackhi_epi16(a0, a1);
+    __m128i b2 = _mm_unpacklo_epi16(a2, a3);
+    __m128i b3 = _mm_unpackhi_epi16(a2, a3);
+    // Each register holds 2 columns of the source
+    __m128i c[4] = {_mm_unpacklo_epi32(b0, b2), _mm_unpackhi_epi32(b0, b2),
+                    _mm_unpacklo_epi32(b1, b3), _mm_unpackhi_epi32(b1, b3)};
+    for (int i = 0; i < 4; i++) {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i * 2 * dstStride), c[i]);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + (i * 2 + 1) * dstStride),
+                         _mm_unpackhi_epi64(c[i], c[i]));
+    }
+}
+
+// Transpose one 8x8 block of 2 bytes elements
+__attribute__((target("sse2")))
+void transposePair8x8Sse2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride)
+{
+    __m128i r[8];
+    for (int i = 0; i < 8; i++) {
+        r[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * srcStride));
+    }
+    __m128i a[8];
+    for (int i = 0; i < 4; i++) {
+        a[i * 2] = _mm_unpacklo_epi16(r[i * 2], r[i * 2 + 1]);
+        a[i * 2 + 1] = _mm_unpackhi_epi16(r[i * 2], r[i * 2 + 1]);
+    }
+    // b[0..3]: columns 0-1, 2-3, 4-5, 6-7 of rows 0-3, b[4..7]: the same of rows 4-7
+    __m128i b[8];
+    for (int i = 0; i < 2; i++) {
+        b[i * 4] = _mm_unpacklo_epi32(a[i * 4], a[i * 4 + 2]);
+        b[i * 4 + 1] = _mm_unpackhi_epi32(a[i * 4], a[i * 4 + 2]);
+        b[i * 4 + 2] = _mm_unpacklo_epi32(a[i * 4 + 1], a[i * 4 + 3]);
+        b[i * 4 + 3] = _mm_unpackhi_epi32(a[i * 4 + 1], a[i * 4 + 3]);
+    }
+    for (int i = 0; i < 4; i++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2 * dstStride),
+                         _mm_unpacklo_epi64(b[i], b[i + 4]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + (i * 2 + 1) * dstStride),
+                         _mm_unpackhi_epi64(b[i], b[i + 4]));
+    }
+}
+
+__attribute__((target("sse2")))
+void transposeRectSse2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                       int width, int height)
+{
+    int w8 = width & ~7;
+    int h8 = height & ~7;
+    for (int y = 0; y < h8; y += 8) {
+        for (int x = 0; x < w8; x += 8) {
+            transpose8x8Sse2(src + y * srcStride + x, srcStride, dst + x * dstStride + y,
+                             dstStride);
+        }
+    }
+    Scalar::transposeRect(src + w8, srcStride, dst + w8 * dstStride, dstStride, width - w8,
+                          height);
+    Scalar::transposeRect(src + h8 * srcStride, srcStride, dst + h8, dstStride, w8,
+                          height - h8);
+}
+
+__attribute__((target("sse2")))
+void transposePairRectSse2(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                           int width, int height)
+{
+    int w8 = width & ~7;
+    int h8 = height & ~7;
+    for (int y = 0; y < h8; y += 8) {
+        for (int x = 0; x < w8; x += 8) {
+            transposePair8x8Sse2(src + y * srcStride + x * 2, srcStride,
+                                 dst + x * dstStride + y * 2, dstStride);
+        }
+    }
+    Scalar::transposePairRect(src + w8 * 2, srcStride, dst + w8 * dstStride, dstStride,
+                              width - w8, height);
+    Scalar::transposePairRect(src + h8 * srcStride, srcStride, dst + h8 * 2, dstStride, w8,
+                              height - h8);
+}
+
+__attribute__((target("sse2")))
+__m128i reverseWordsSse2(__m128i v)
+{
+    v = _mm_shufflelo_epi16(v, 0x1b);
+    v = _mm_shufflehi_epi16(v, 0x1b);
+    return _mm_shuffle_epi32(v, 0x4e);
+}
+
+__attribute__((target("sse2")))
+void reverseRowSse2(const uint8_t *src, uint8_t *dst, int count)
+{
+    int i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + count - i - 16));
+        v = reverseWordsSse2(v);
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), v);
+    }
+    Scalar::reverseRow(src, dst + i, count - i);
+}
+
+__attribute__((target("sse2")))
+void reversePairsRowSse2(const uint8_t *src, uint8_t *dst, int pairs)
+{
+    int i = 0;
+    for (; i + 8 <= pairs; i += 8) {
+        __m128i v = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(src + (pairs - i - 8) * 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2), reverseWordsSse2(v));
+    }
+    Scalar::reversePairsRow(src, dst + i * 2, pairs - i);
+}
+
+__attribute__((target("avx2")))
+void deinterleaveRowAvx2(const uint8_t *src, uint8_t *even, uint8_t *odd, int pairs)
+{
+    const __m256i mask = _mm256_set1_epi16(0x00ff);
+    int i = 0;
+    for (; i + 32 <= pairs; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * 2));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * 2 + 32));
+        // pack works in 128 bits lanes, restore the order of the 64 bits blocks
+        __m256i e = _mm256_packus_epi16(_mm256_and_si256(a, mask), _mm256_and_si256(b, mask));
+        __m256i o = _mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(even + i),
+                            _mm256_permute4x64_epi64(e, 0xd8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(odd + i),
+                            _mm256_permute4x64_epi64(o, 0xd8));
+    }
+    deinterleaveRowSse2(src + i * 2, even + i, odd + i, pairs - i);
+}
+
+__attribute__((target("avx2")))
+void swapPairsRowAvx2(const uint8_t *src, uint8_t *dst, int pairs)
+{
+    int i = 0;
+    for (; i + 16 <= pairs; i += 16) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * 2));
+        a = _mm256_or_si256(_mm256_slli_epi16(a, 8), _mm256_srli_epi16(a, 8));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 2), a);
+    }
+    swapPairsRowSse2(src + i * 2, dst + i * 2, pairs - i);
+}
+
+__attribute__((target("avx2")))
+void interleaveRowAvx2(const uint8_t *even, const uint8_t *odd, uint8_t *dst, int pairs)
+{
+    int i = 0;
+    for (; i + 32 <= pairs; i += 32) {
+        __m256i e = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(even + i));
+        __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(odd + i));
+        // unpack works in 128 bits lanes, gather the lanes in order
+        __m256i lo = _mm256_unpacklo_epi8(e, o);
+        __m256i hi = _mm256_unpackhi_epi8(e, o);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 2),
+                            _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * 2 + 32),
+                            _mm256_permute2x128_si256(lo, hi, 0x31));
+    }
+    interleaveRowSse2(even + i, odd + i, dst + i * 2, pairs - i);
+}
+
+__attribute__((target("avx2")))
+void blendRowsAvx2(const uint16_t *row0, const uint16_t *row1, int weight, uint8_t *dst,
+                   int count)
+{
+    const __m256i w0 = _mm256_set1_epi16(256 - weight);
+    const __m256i w1 = _mm256_set1_epi16(weight);
+    int i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row0 + i));
+        __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row0 + i + 16));
+        __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row1 + i));
+        __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row1 + i + 16));
+        __m256i v0 = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(a0, w0),
+                                                        _mm256_mullo_epi16(b0, w1)), 8);
+        __m256i v1 = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(a1, w0),
+                                                        _mm256_mullo_epi16(b1, w1)), 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i),
+                            _mm256_permute4x64_epi64(_mm256_packus_epi16(v0, v1), 0xd8));
+    }
+    blendRowsSse2(row0 + i, row1 + i, weight, dst + i, count - i);
+}
+
+} // namespace
+#endif
+
+namespace {
+
+struct KernelTable {
+    const char *name;
+    void (*deinterleaveRow)(const uint8_t *, uint8_t *, uint8_t *, int);
+    void (*swapPairsRow)(const uint8_t *, uint8_t *, int);
+    void (*interleaveRow)(const uint8_t *, const uint8_t *, uint8_t *, int);
+    void (*blendRows)(const uint16_t *, const uint16_t *, int, uint8_t *, int);
+    void (*transposeRect)(const uint8_t *, int, uint8_t *, int, int, int);
+    void (*transposePairRect)(const uint8_t *, int, uint8_t *, int, int, int);
+    void (*reverseRow)(const uint8_t *, uint8_t *, int);
+    void (*reversePairsRow)(const uint8_t *, uint8_t *, int);
+};
+
+KernelTable selectKernels()
+{
+#ifdef PIXEL_KERNELS_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        // The transpose and reverse kernels gain nothing from the wider registers
+        return {"avx2", deinterleaveRowAvx2, swapPairsRowAvx2, interleaveRowAvx2,
+                blendRowsAvx2, transposeRectSse2, transposePairRectSse2, reverseRowSse2,
+                reversePairsRowSse2};
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return {"sse2", deinterleaveRowSse2, swapPairsRowSse2, interleaveRowSse2,
+                blendRowsSse2, transposeRectSse2, transposePairRectSse2, reverseRowSse2,
+                reversePairsRowSse2};
+    }
+#endif
+    return {"scalar", Scalar::deinterleaveRow, Scalar::swapPairsRow, Scalar::interleaveRow,
+            Scalar::blendRows, Scalar::transposeRect, Scalar::transposePairRect,
+            Scalar::reverseRow, Scalar::reversePairsRow};
+}
+
+const KernelTable &getKernels()
+{
+    static const KernelTable kernels = selectKernels();
+    return kernels;
+}
+
+} // namespace
+
+void deinterleaveRow(const uint8_t *src, uint8_t *even, uint8_t *odd, int pairs)
+{
+    getKernels().deinterleaveRow(src, even, odd, pairs);
+}
+
+void swapPairsRow(const uint8_t *src, uint8_t *dst, int pairs)
+{
+    getKernels().swapPairsRow(src, dst, pairs);
+}
+
+void interleaveRow(const uint8_t *even, const uint8_t *odd, uint8_t *dst, int pairs)
+{
+    getKernels().interleaveRow(even, odd, dst, pairs);
+}
+
+void blendRows(const uint16_t *row0, const uint16_t *row1, int weight, uint8_t *dst, int count)
+{
+    getKernels().blendRows(row0, row1, weight, dst, count);
+}
+
+void transposeRect(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                   int width, int height)
+{
+    getKernels().transposeRect(src, srcStride, dst, dstStride, width, height);
+}
+
+void transposePairRect(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                       int width, int height)
+{
+    getKernels().transposePairRect(src, srcStride, dst, dstStride, width, height);
+}
+
+void reverseRow(const uint8_t *src, uint8_t *dst, int count)
+{
+    getKernels().reverseRow(src, dst, count);
+}
+
+void reversePairsRow(const uint8_t *src, uint8_t *dst, int pairs)
+{
+    getKernels().reversePairsRow(src, dst, pairs);
+}
+
+const char *getSimdName()
+{
+    return getKernels().name;
+}
+
+} // namespace PixelKernels
+} // namespace icamera
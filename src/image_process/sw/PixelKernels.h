@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace icamera {
+
+/**
+ * Row and block kernels shared by the SW image converter, scaler and rotator.
+ *
+ * The kernels are dispatched at runtime to AVX2 or SSE2 implementations on x86,
+ * and fall back to the scalar ones otherwise. The vector results are bit-exact
+ * with the scalar reference, which is kept in the Scalar namespace.
+ */
+namespace PixelKernels {
+
+// src: pairs of bytes, even: the 1st byte of each pair, odd: the 2nd byte of each pair
+void deinterleaveRow(const uint8_t *src, uint8_t *even, uint8_t *odd, int pairs);
+// Swap the 2 bytes of each pair, e.g. UV -> VU
+void swapPairsRow(const uint8_t *src, uint8_t *dst, int pairs);
+// The reverse of deinterleaveRow
+void interleaveRow(const uint8_t *even, const uint8_t *odd, uint8_t *dst, int pairs);
+// dst = (row0 * (256 - weight) + row1 * weight) >> 8, row values must be <= 255
+void blendRows(const uint16_t *row0, const uint16_t *row1, int weight, uint8_t *dst, int count);
+// dst[x][y] = src[y][x] for a width x height block of bytes, the strides can be negative
+void transposeRect(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                   int width, int height);
+// Same as transposeRect, with 2 bytes elements, e.g. UV pairs, width is in elements
+void transposePairRect(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                       int width, int height);
+// dst[i] = src[count - 1 - i]
+void reverseRow(const uint8_t *src, uint8_t *dst, int count);
+// Same as reverseRow, with 2 bytes elements
+void reversePairsRow(const uint8_t *src, uint8_t *dst, int pairs);
+
+// Name of the implementation in use, for logs
+const char *getSimdName();
+
+namespace Scalar {
+void deinterleaveRow(const uint8_t *src, uint8_t *even, uint8_t *odd, int pairs);
+void swapPairsRow(const uint8_t *src, uint8_t *dst, int pairs);
+void interleaveRow(const uint8_t *even, const uint8_t *odd, uint8_t *dst, int pairs);
+void blendRows(const uint16_t *row0, const uint16_t *row1, int weight, uint8_t *dst, int count);
+void transposeRect(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                   int width, int height);
+void transposePairRect(const uint8_t *src, int srcStride, uint8_t *dst, int dstStride,
+                       int width, int height);
+void reverseRow(const uint8_t *src, uint8_t *dst, int count);
+void reversePairsRow(const uint8_t *src, uint8_t *dst, int pairs);
+} // namespace Scalar
+
+} // namespace PixelKernels
+} // namespace icamera
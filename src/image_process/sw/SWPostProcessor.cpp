@@ -20,6 +20,7 @@
 #include "SWPostProcessor.h"
 #include "ImageScalerCore.h"
 #include "ImageConverter.h"
+#include "ImageRotator.h"
 #include "PlatformData.h"
 
 namespace icamera {
@@ -42,7 +43,7 @@ std::unique_ptr<IImageProcessor> IImageProcessor::createImageProcessor()
 //If support this kind of post process type in current OS
 bool IImageProcessor::isProcessingTypeSupported(PostProcessType type)
 {
-    int supportedType = POST_PROCESS_CONVERT | POST_PROCESS_JPEG_ENCODING;
+    int supportedType = POST_PROCESS_CONVERT | POST_PROCESS_JPEG_ENCODING | POST_PROCESS_ROTATE;
     if (PlatformData::useGPUProcessor())
         supportedType |= POST_PROCESS_GPU;
     else
@@ -51,6 +52,14 @@ bool IImageProcessor::isProcessingTypeSupported(PostProcessType type)
     return supportedType & type;
 }
 
+// The crop is done together with the scale, see scaleFrame()
+bool IImageProcessor::isCropScaleConvertSupported(const stream_t &input, const stream_t &output)
+{
+    return ImageScalerCore::isDownScaleAndConvertSupported(input.width, input.height,
+                                                           input.format, output.width,
+                                                           output.height, output.format);
+}
+
 // The frame crop is handled together with frame scaling
 status_t SWPostProcessor::cropFrame(const std::shared_ptr<CameraBuffer> &input,
                                     std::shared_ptr<CameraBuffer> &output)
@@ -75,13 +84,46 @@ status_t SWPostProcessor::scaleFrame(const std::shared_ptr<CameraBuffer> &input,
     return OK;
 }
 
-// Software image processor doesn't support rotate
 status_t SWPostProcessor::rotateFrame(const std::shared_ptr<CameraBuffer> &input,
                                       std::shared_ptr<CameraBuffer> &output,
                                       int angle, std::vector<uint8_t> &rotateBuf)
 {
-    UNUSED(input);
-    UNUSED(output);
+    LOG2("%s: src: %dx%d,format 0x%x, dest: %dx%d format 0x%x, angle %d",
+         __func__, input->getWidth(), input->getHeight(), input->getFormat(),
+         output->getWidth(), output->getHeight(), output->getFormat(), angle);
+
+    CheckAndLogError(angle != 0 && angle != 90 && angle != 180 && angle != 270, BAD_VALUE,
+                     "angle value:%d is wrong", angle);
+    bool swap = (angle == 90 || angle == 270);
+    int width = input->getWidth();
+    int height = input->getHeight();
+    CheckAndLogError(output->getWidth() != (swap ? height : width) ||
+                     output->getHeight() != (swap ? width : height), BAD_VALUE,
+                     "output resolution mismatch [%d x %d] -> [%d x %d]", width, height,
+                     output->getWidth(), output->getHeight());
+    CheckAndLogError((width & 1) || (height & 1), BAD_VALUE,
+                     "odd resolution %dx%d isn't supported", width, height);
+    CheckAndLogError(input->getFormat() != output->getFormat(), BAD_VALUE,
+                     "rotate can't convert format 0x%x -> 0x%x", input->getFormat(),
+                     output->getFormat());
+
+    const uint8_t *src = static_cast<uint8_t *>(input->getBufferAddr());
+    uint8_t *dst = static_cast<uint8_t *>(output->getBufferAddr());
+    switch (input->getFormat()) {
+        case V4L2_PIX_FMT_NV12:
+        case V4L2_PIX_FMT_NV21:
+            ImageRotator::rotateNV12(width, height, input->getStride(), output->getStride(),
+                                     src, dst, angle);
+            break;
+        case V4L2_PIX_FMT_YUYV:
+            ImageRotator::rotateYUYV(width, height, input->getStride(), output->getStride(),
+                                     src, dst, angle, rotateBuf);
+            break;
+        default:
+            LOGE("%s: not implement for rotating format 0x%x!", __func__, input->getFormat());
+            return UNKNOWN_ERROR;
+    }
+
     return OK;
 }
 
@@ -122,4 +164,26 @@ status_t SWPostProcessor::convertFrame(const std::shared_ptr<CameraBuffer> &inpu
 
     return OK;
 }
+
+status_t SWPostProcessor::cropScaleConvertFrame(const std::shared_ptr<CameraBuffer> &input,
+                                                std::shared_ptr<CameraBuffer> &output)
+{
+    LOG2("%s: src: %dx%d,format 0x%x, dest: %dx%d format 0x%x",
+         __func__, input->getWidth(), input->getHeight(), input->getFormat(),
+         output->getWidth(), output->getHeight(), output->getFormat());
+
+    CheckAndLogError(!ImageScalerCore::isDownScaleAndConvertSupported(
+                         input->getWidth(), input->getHeight(), input->getFormat(),
+                         output->getWidth(), output->getHeight(), output->getFormat()),
+                     BAD_VALUE, "%s: not supported for 0x%x -> 0x%x", __func__,
+                     input->getFormat(), output->getFormat());
+
+    ImageScalerCore::downScaleAndConvertNv12Image(
+        static_cast<unsigned char *>(output->getBufferAddr()),
+        static_cast<unsigned char *>(input->getBufferAddr()), output->getWidth(),
+        output->getHeight(), output->getFormat(), input->getWidth(), input->getHeight(),
+        input->getStride());
+
+    return OK;
+}
 } /* namespace icamera */
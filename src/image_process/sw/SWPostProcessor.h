@@ -33,6 +33,8 @@ public:
                                  int angle, std::vector<uint8_t> &rotateBuf);
     virtual status_t convertFrame(const std::shared_ptr<CameraBuffer> &input,
                                   std::shared_ptr<CameraBuffer> &output);
+    virtual status_t cropScaleConvertFrame(const std::shared_ptr<CameraBuffer> &input,
+                                           std::shared_ptr<CameraBuffer> &output);
 
 private:
     DISALLOW_COPY_AND_ASSIGN(SWPostProcessor);
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times the one pass NV12 scale and convert against the scale to an
+// intermediate NV12 frame followed by the conversion. Prints ms per frame.
+//
+// Usage: ImageScalerCoreBenchmark [frames]
+
+#include <linux/videodev2.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <vector>
+
+#include "ImageConverter.h"
+#include "ImageScalerCore.h"
+
+using icamera::ImageScalerCore;
+namespace ImageConverter = icamera::ImageConverter;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double elapsedMs(const Clock::time_point& start, int frames) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count() / frames;
+}
+
+void run(int srcW, int srcH, int dstW, int dstH, int format, int frames) {
+    const int srcStride = srcW;
+    const int midStride = (dstW + 63) & ~63;
+    std::vector<unsigned char> src(static_cast<size_t>(srcStride) * srcH * 3 / 2);
+    std::vector<unsigned char> mid(static_cast<size_t>(midStride) * dstH * 3 / 2);
+    std::vector<unsigned char> dst(static_cast<size_t>(dstW + 32) * dstH * 2);
+    for (size_t i = 0; i < src.size(); i++) src[i] = static_cast<unsigned char>(i * 13);
+
+    Clock::time_point start = Clock::now();
+    for (int i = 0; i < frames; i++) {
+        ImageScalerCore::downScaleImage(src.data(), mid.data(), dstW, dstH, midStride, srcW,
+                                        srcH, srcStride, V4L2_PIX_FMT_NV12);
+        if (format == V4L2_PIX_FMT_NV21) {
+            ImageConverter::convertBuftoNV21(V4L2_PIX_FMT_NV12, dstW, dstH, midStride, dstW,
+                                             mid.data(), dst.data());
+        } else {
+            ImageConverter::convertBuftoYV12(V4L2_PIX_FMT_NV12, dstW, dstH, midStride, dstW,
+                                             mid.data(), dst.data());
+        }
+    }
+    const double twoPassMs = elapsedMs(start, frames);
+
+    start = Clock::now();
+    for (int i = 0; i < frames; i++) {
+        ImageScalerCore::downScaleAndConvertNv12Image(dst.data(), src.data(), dstW, dstH,
+                                                      format, srcW, srcH, srcStride);
+    }
+    const double fusedMs = elapsedMs(start, frames);
+
+    printf("%4dx%-4d -> %4dx%-4d %s: two passes %7.3f ms, one pass %7.3f ms, x%.2f\n", srcW,
+           srcH, dstW, dstH, (format == V4L2_PIX_FMT_NV21) ? "NV21" : "YV12", twoPassMs, fusedMs,
+           twoPassMs / fusedMs);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int frames = (argc > 1) ? atoi(argv[1]) : 100;
+    if (frames <= 0) {
+        fprintf(stderr, "Usage: %s [frames]\n", argv[0]);
+        return 1;
+    }
+
+    const int formats[] = {V4L2_PIX_FMT_NV21, V4L2_PIX_FMT_YVU420};
+    for (int format : formats) {
+        run(4096, 3072, 1920, 1080, format, frames);
+        run(1920, 1080, 1280, 720, format, frames);
+        run(1920, 1080, 640, 360, format, frames);
+    }
+    return 0;
+}
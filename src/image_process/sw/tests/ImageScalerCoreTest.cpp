@@ -0,0 +1,175 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks that ImageScalerCore::downScaleAndConvertNv12Image() gives the same
+// pixels as downScaleImage() followed by ImageConverter::convertBuftoXXX(), the
+// two passes the post processor ran before, and writes nothing past the output.
+// The row padding of YV12 is not compared, the two passes copy it from the
+// intermediate frame.
+
+#include <linux/videodev2.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <random>
+#include <vector>
+
+#include "ImageConverter.h"
+#include "ImageScalerCore.h"
+
+using icamera::ImageScalerCore;
+namespace ImageConverter = icamera::ImageConverter;
+
+namespace {
+
+struct ScaleCase {
+    int srcW;
+    int srcH;
+    int dstW;
+    int dstH;
+};
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what, const ScaleCase& c) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s, %dx%d -> %dx%d\n", what, c.srcW, c.srcH, c.dstW, c.dstH);
+        gFailures++;
+    }
+}
+
+// The two pass reference: scale to an NV12 frame, then convert it
+void scaleThenConvert(const ScaleCase& c, int srcStride, int format, unsigned char* src,
+                      unsigned char* dst) {
+    const int midStride = (c.dstW + 63) & ~63;
+    std::vector<unsigned char> mid(static_cast<size_t>(midStride) * c.dstH * 3 / 2);
+    ImageScalerCore::downScaleImage(src, mid.data(), c.dstW, c.dstH, midStride, c.srcW, c.srcH,
+                                    srcStride, V4L2_PIX_FMT_NV12);
+    if (format == V4L2_PIX_FMT_NV21) {
+        ImageConverter::convertBuftoNV21(V4L2_PIX_FMT_NV12, c.dstW, c.dstH, midStride, c.dstW,
+                                         mid.data(), dst);
+    } else {
+        ImageConverter::convertBuftoYV12(V4L2_PIX_FMT_NV12, c.dstW, c.dstH, midStride, c.dstW,
+                                         mid.data(), dst);
+    }
+}
+
+// Compares the rows of each plane, and the bytes after the last plane
+bool samePicture(const std::vector<unsigned char>& a, const std::vector<unsigned char>& b,
+                 int format, int width, int height) {
+    struct Plane {
+        size_t offset;
+        int stride;
+        int width;
+        int height;
+    } planes[3];
+    int planeNum = 0;
+    size_t end = 0;
+    if (format == V4L2_PIX_FMT_NV21) {
+        planes[planeNum++] = {0, width, width, height};
+        planes[planeNum++] = {static_cast<size_t>(width) * height, width, width, height / 2};
+        end = static_cast<size_t>(width) * height * 3 / 2;
+    } else {
+        // The layout of ImageConverter::align16ConvertNV12ToYV12()
+        const int yStride = (width + 15) & ~15;
+        const int cStride = ((yStride / 2) + 15) & ~15;
+        const size_t ySize = static_cast<size_t>(yStride) * height;
+        const size_t cSize = static_cast<size_t>(cStride) * height / 2;
+        planes[planeNum++] = {0, yStride, width, height};
+        planes[planeNum++] = {ySize, cStride, width / 2, height / 2};
+        planes[planeNum++] = {ySize + cSize, cStride, width / 2, height / 2};
+        end = ySize + cSize * 2;
+    }
+
+    for (int p = 0; p < planeNum; p++) {
+        for (int y = 0; y < planes[p].height; y++) {
+            const size_t row = planes[p].offset + static_cast<size_t>(y) * planes[p].stride;
+            if (memcmp(&a[row], &b[row], planes[p].width) != 0) return false;
+        }
+    }
+    return memcmp(&a[end], &b[end], a.size() - end) == 0;
+}
+
+void testSameAsTwoPasses() {
+    const ScaleCase cases[] = {
+        {1920, 1080, 1280, 720}, {1920, 1080, 640, 360}, {4096, 3072, 1920, 1080},
+        {1280, 960, 320, 240},   {800, 600, 322, 242},   {1920, 1080, 1000, 562},
+        {1282, 722, 640, 362},   {1920, 1080, 1918, 1078}, {1920, 1080, 2, 2},
+        {1920, 1080, 18, 10},
+    };
+    const int formats[] = {V4L2_PIX_FMT_NV21, V4L2_PIX_FMT_YVU420};
+    std::mt19937 rng(1);
+
+    for (const ScaleCase& c : cases) {
+        expect(ImageScalerCore::isDownScaleAndConvertSupported(
+                   c.srcW, c.srcH, V4L2_PIX_FMT_NV12, c.dstW, c.dstH, V4L2_PIX_FMT_NV21),
+               "supported", c);
+        const int srcStride = c.srcW + 64;
+        std::vector<unsigned char> src(static_cast<size_t>(srcStride) * c.srcH * 3 / 2);
+        for (auto& v : src) v = static_cast<unsigned char>(rng());
+
+        for (int format : formats) {
+            // Room for the YV12 chroma planes aligned to 16, and a guard after them
+            const size_t size = static_cast<size_t>(c.dstW + 32) * c.dstH * 2 + 64;
+            std::vector<unsigned char> expected(size, 0x55);
+            std::vector<unsigned char> result(size, 0x55);
+            scaleThenConvert(c, srcStride, format, src.data(), expected.data());
+            ImageScalerCore::downScaleAndConvertNv12Image(result.data(), src.data(), c.dstW,
+                                                          c.dstH, format, c.srcW, c.srcH,
+                                                          srcStride);
+            expect(samePicture(result, expected, format, c.dstW, c.dstH),
+                   (format == V4L2_PIX_FMT_NV21) ? "same NV21 picture" : "same YV12 picture", c);
+        }
+    }
+}
+
+// The callers fall back to the two passes for these
+void testUnsupported() {
+    const ScaleCase sameWidth = {1920, 1080, 1920, 720};
+    expect(!ImageScalerCore::isDownScaleAndConvertSupported(
+               sameWidth.srcW, sameWidth.srcH, V4L2_PIX_FMT_NV12, sameWidth.dstW,
+               sameWidth.dstH, V4L2_PIX_FMT_NV21),
+           "a trim is not fused", sameWidth);
+
+    const ScaleCase odd = {1920, 1080, 641, 360};
+    expect(!ImageScalerCore::isDownScaleAndConvertSupported(
+               odd.srcW, odd.srcH, V4L2_PIX_FMT_NV12, odd.dstW, odd.dstH, V4L2_PIX_FMT_NV21),
+           "odd sizes are not fused", odd);
+
+    const ScaleCase qvga = {640, 480, 320, 240};
+    expect(!ImageScalerCore::isDownScaleAndConvertSupported(
+               qvga.srcW, qvga.srcH, V4L2_PIX_FMT_NV12, qvga.dstW, qvga.dstH,
+               V4L2_PIX_FMT_NV21),
+           "the special QVGA scale is not fused", qvga);
+
+    const ScaleCase yuyv = {1920, 1080, 1280, 720};
+    expect(!ImageScalerCore::isDownScaleAndConvertSupported(
+               yuyv.srcW, yuyv.srcH, V4L2_PIX_FMT_NV12, yuyv.dstW, yuyv.dstH,
+               V4L2_PIX_FMT_YUYV),
+           "YUYV output is not fused", yuyv);
+}
+
+}  // namespace
+
+int main() {
+    testSameAsTwoPasses();
+    testUnsupported();
+
+    if (gFailures == 0) {
+        printf("ImageScalerCoreTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
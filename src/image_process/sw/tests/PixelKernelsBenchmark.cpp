@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times each PixelKernels kernel against its scalar reference on the amount
+// of data of one 1920x1080 NV12 frame, and the ImageConverter paths built on
+// them. Prints ms per frame.
+//
+// Usage: PixelKernelsBenchmark [frames]
+
+#include <linux/videodev2.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "ImageConverter.h"
+#include "PixelKernels.h"
+
+namespace ImageConverter = icamera::ImageConverter;
+namespace PixelKernels = icamera::PixelKernels;
+
+namespace {
+
+const int kWidth = 1920;
+const int kHeight = 1080;
+
+double msPerFrame(int frames, const std::function<void()>& frame) {
+    frame();  // Warm up the caches
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        frame();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / frames;
+}
+
+void compare(const char* name, int frames, const std::function<void()>& vector,
+             const std::function<void()>& scalar) {
+    const double vectorMs = msPerFrame(frames, vector);
+    const double scalarMs = msPerFrame(frames, scalar);
+    printf("%-20s %8.3f ms, scalar %8.3f ms, x%.2f\n", name, vectorMs, scalarMs,
+           scalarMs / vectorMs);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int frames = (argc > 1) ? atoi(argv[1]) : 200;
+    if (frames <= 0) {
+        fprintf(stderr, "Usage: %s [frames]\n", argv[0]);
+        return 1;
+    }
+
+    // Big enough for a YUYV frame and its transpose
+    std::vector<uint8_t> src(kWidth * kHeight * 2);
+    std::vector<uint8_t> dst(kWidth * kHeight * 2);
+    std::vector<uint8_t> dst2(kWidth * kHeight);
+    std::vector<uint16_t> row0(kWidth), row1(kWidth);
+    for (size_t i = 0; i < src.size(); i++) src[i] = static_cast<uint8_t>(i * 7 + (i >> 8));
+    for (int i = 0; i < kWidth; i++) {
+        row0[i] = static_cast<uint16_t>(i & 0xFF);
+        row1[i] = static_cast<uint16_t>((i * 3) & 0xFF);
+    }
+    uint8_t* s = src.data();
+    uint8_t* d = dst.data();
+    uint8_t* d2 = dst2.data();
+
+    printf("PixelKernelsBenchmark, %dx%d, %s\n", kWidth, kHeight, PixelKernels::getSimdName());
+
+    // The UV plane of NV12: kHeight / 2 rows of kWidth / 2 pairs
+    compare("deinterleaveRow", frames,
+            [=]() {
+                for (int y = 0; y < kHeight / 2; y++) {
+                    PixelKernels::deinterleaveRow(s + y * kWidth, d + y * kWidth / 2,
+                                                  d2 + y * kWidth / 2, kWidth / 2);
+                }
+            },
+            [=]() {
+                for (int y = 0; y < kHeight / 2; y++) {
+                    PixelKernels::Scalar::deinterleaveRow(s + y * kWidth, d + y * kWidth / 2,
+                                                          d2 + y * kWidth / 2, kWidth / 2);
+                }
+            });
+    compare("swapPairsRow", frames,
+            [=]() {
+                for (int y = 0; y < kHeight / 2; y++) {
+                    PixelKernels::swapPairsRow(s + y * kWidth, d + y * kWidth, kWidth / 2);
+                }
+            },
+            [=]() {
+                for (int y = 0; y < kHeight / 2; y++) {
+                    PixelKernels::Scalar::swapPairsRow(s + y * kWidth, d + y * kWidth,
+                                                       kWidth / 2);
+                }
+            });
+    // NV12 to YUYV: every luma row with its chroma row
+    compare("interleaveRow", frames,
+            [=]() {
+                for (int y = 0; y < kHeight; y++) {
+                    PixelKernels::interleaveRow(s + y * kWidth, s + (y / 2) * kWidth,
+                                                d + y * kWidth * 2, kWidth);
+                }
+            },
+            [=]() {
+                for (int y = 0; y < kHeight; y++) {
+                    PixelKernels::Scalar::interleaveRow(s + y * kWidth, s + (y / 2) * kWidth,
+                                                        d + y * kWidth * 2, kWidth);
+                }
+            });
+    const uint16_t* r0 = row0.data();
+    const uint16_t* r1 = row1.data();
+    compare("blendRows", frames,
+            [=]() {
+                for (int y = 0; y < kHeight; y++) {
+                    PixelKernels::blendRows(r0, r1, y & 0xFF, d + y * kWidth, kWidth);
+                }
+            },
+            [=]() {
+                for (int y = 0; y < kHeight; y++) {
+                    PixelKernels::Scalar::blendRows(r0, r1, y & 0xFF, d + y * kWidth, kWidth);
+                }
+            });
+    compare("transposeRect", frames,
+            [=]() { PixelKernels::transposeRect(s, kWidth, d, kHeight, kWidth, kHeight); },
+            [=]() {
+                PixelKernels::Scalar::transposeRect(s, kWidth, d, kHeight, kWidth, kHeight);
+            });
+    compare("transposePairRect", frames,
+            [=]() {
+                PixelKernels::transposePairRect(s, kWidth, d, kHeight, kWidth / 2, kHeight / 2);
+            },
+            [=]() {
+                PixelKernels::Scalar::transposePairRect(s, kWidth, d, kHeight, kWidth / 2,
+                                                        kHeight / 2);
+            });
+    compare("reverseRow", frames,
+            [=]() {
+                for (int y = 0; y < kHeight; y++) {
+                    PixelKernels::reverseRow(s + y * kWidth, d + y * kWidth, kWidth);
+                }
+            },
+            [=]() {
+                for (int y = 0; y < kHeight; y++) {
+                    PixelKernels::Scalar::reverseRow(s + y * kWidth, d + y * kWidth, kWidth);
+                }
+            });
+
+    // The converters dispatch to the kernels above, their strides are in pixels
+    const double nv12ToYv12 = msPerFrame(frames, [=]() {
+        ImageConverter::convertNV12ToYV12(kWidth, kHeight, kWidth, s, d);
+    });
+    const double nv12ToYuyv = msPerFrame(frames, [=]() {
+        ImageConverter::convertNV12ToYUYV(kWidth, kHeight, kWidth, kWidth, s, d);
+    });
+    const double yuyvToYv12 = msPerFrame(frames, [=]() {
+        ImageConverter::convertYUYVToYV12(kWidth, kHeight, kWidth, kWidth, s, d);
+    });
+    printf("%-20s %8.3f ms\n", "NV12 to YV12", nv12ToYv12);
+    printf("%-20s %8.3f ms\n", "NV12 to YUYV", nv12ToYuyv);
+    printf("%-20s %8.3f ms\n", "YUYV to YV12", yuyvToYv12);
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks that the dispatched PixelKernels are bit-exact with the scalar
+// reference, on random lengths, unaligned pointers, and negative strides for
+// the transposes. The bytes around each output must be left untouched.
+
+#include <stdio.h>
+
+#include <random>
+#include <vector>
+
+#include "PixelKernels.h"
+
+namespace PixelKernels = icamera::PixelKernels;
+
+namespace {
+
+const int kIterations = 2000;
+const int kMaxLength = 2000;
+const int kMaxSide = 100;
+const int kSlack = 64;
+
+std::mt19937 gRng(1);
+int gFailures = 0;
+
+int randomInt(int low, int high) {
+    return low + static_cast<int>(gRng() % static_cast<unsigned int>(high - low + 1));
+}
+
+void fillRandom(std::vector<uint8_t>* buf) {
+    for (auto& v : *buf) v = static_cast<uint8_t>(gRng());
+}
+
+void expectSame(const std::vector<uint8_t>& result, const std::vector<uint8_t>& expected,
+                const char* kernel, int length) {
+    if (result != expected) {
+        fprintf(stderr, "FAIL: %s, length %d differs from the scalar one\n", kernel, length);
+        gFailures++;
+    }
+}
+
+void testRows() {
+    std::vector<uint8_t> src(kMaxLength * 2 + kSlack);
+    std::vector<uint8_t> src2(kMaxLength * 2 + kSlack);
+    std::vector<uint16_t> row0(kMaxLength + kSlack);
+    std::vector<uint16_t> row1(kMaxLength + kSlack);
+    std::vector<uint8_t> even(kMaxLength + kSlack), odd(kMaxLength + kSlack);
+    std::vector<uint8_t> refEven(kMaxLength + kSlack), refOdd(kMaxLength + kSlack);
+    std::vector<uint8_t> dst(kMaxLength * 2 + kSlack), ref(kMaxLength * 2 + kSlack);
+
+    for (int i = 0; i < kIterations; i++) {
+        fillRandom(&src);
+        fillRandom(&src2);
+        for (auto& v : row0) v = static_cast<uint16_t>(gRng() & 0xFF);
+        for (auto& v : row1) v = static_cast<uint16_t>(gRng() & 0xFF);
+        const int n = randomInt(1, kMaxLength);
+        const int in = randomInt(0, 31);
+        const int out = randomInt(0, 31);
+
+        // The same random bytes around the outputs of both implementations
+        fillRandom(&even);
+        fillRandom(&odd);
+        refEven = even;
+        refOdd = odd;
+        PixelKernels::deinterleaveRow(&src[in], &even[out], &odd[out], n);
+        PixelKernels::Scalar::deinterleaveRow(&src[in], &refEven[out], &refOdd[out], n);
+        expectSame(even, refEven, "deinterleaveRow", n);
+        expectSame(odd, refOdd, "deinterleaveRow", n);
+
+        fillRandom(&dst);
+        ref = dst;
+        PixelKernels::swapPairsRow(&src[in], &dst[out], n);
+        PixelKernels::Scalar::swapPairsRow(&src[in], &ref[out], n);
+        expectSame(dst, ref, "swapPairsRow", n);
+
+        fillRandom(&dst);
+        ref = dst;
+        PixelKernels::interleaveRow(&src[in], &src2[in], &dst[out], n);
+        PixelKernels::Scalar::interleaveRow(&src[in], &src2[in], &ref[out], n);
+        expectSame(dst, ref, "interleaveRow", n);
+
+        const int weight = randomInt(0, 256);
+        fillRandom(&dst);
+        ref = dst;
+        PixelKernels::blendRows(&row0[in], &row1[in], weight, &dst[out], n);
+        PixelKernels::Scalar::blendRows(&row0[in], &row1[in], weight, &ref[out], n);
+        expectSame(dst, ref, "blendRows", n);
+
+        fillRandom(&dst);
+        ref = dst;
+        PixelKernels::reverseRow(&src[in], &dst[out], n);
+        PixelKernels::Scalar::reverseRow(&src[in], &ref[out], n);
+        expectSame(dst, ref, "reverseRow", n);
+
+        fillRandom(&dst);
+        ref = dst;
+        PixelKernels::reversePairsRow(&src[in], &dst[out], n);
+        PixelKernels::Scalar::reversePairsRow(&src[in], &ref[out], n);
+        expectSame(dst, ref, "reversePairsRow", n);
+    }
+}
+
+// The rotator walks the source backwards with a negative stride for 90/270 degrees
+void testTransposes() {
+    std::vector<uint8_t> src(kMaxSide * kMaxSide * 2 + kSlack);
+    std::vector<uint8_t> dst(kMaxSide * kMaxSide * 2 + kSlack);
+    std::vector<uint8_t> ref(dst.size());
+
+    for (int i = 0; i < kIterations; i++) {
+        fillRandom(&src);
+        const int width = randomInt(1, kMaxSide);
+        const int height = randomInt(1, kMaxSide);
+        const int in = randomInt(0, 31);
+        const int out = randomInt(0, 31);
+        const bool flip = (i & 1) != 0;
+
+        // Byte elements, the source is width x height
+        int srcStride = width + randomInt(0, 8);
+        const uint8_t* srcStart = &src[in];
+        if (flip) {
+            srcStart += (height - 1) * srcStride;
+            srcStride = -srcStride;
+        }
+        const int dstStride = height + randomInt(0, 8);
+        fillRandom(&dst);
+        ref = dst;
+        PixelKernels::transposeRect(srcStart, srcStride, &dst[out], dstStride, width, height);
+        PixelKernels::Scalar::transposeRect(srcStart, srcStride, &ref[out], dstStride, width,
+                                            height);
+        expectSame(dst, ref, "transposeRect", width * height);
+
+        // Pair elements, e.g. the UV plane of NV12
+        const int pairWidth = randomInt(1, kMaxSide / 2);
+        const int pairHeight = randomInt(1, kMaxSide / 2);
+        int pairSrcStride = pairWidth * 2 + randomInt(0, 8);
+        const uint8_t* pairSrc = &src[in];
+        if (flip) {
+            pairSrc += (pairHeight - 1) * pairSrcStride;
+            pairSrcStride = -pairSrcStride;
+        }
+        const int pairDstStride = pairHeight * 2 + randomInt(0, 8);
+        fillRandom(&dst);
+        ref = dst;
+        PixelKernels::transposePairRect(pairSrc, pairSrcStride, &dst[out], pairDstStride,
+                                        pairWidth, pairHeight);
+        PixelKernels::Scalar::transposePairRect(pairSrc, pairSrcStride, &ref[out],
+                                                pairDstStride, pairWidth, pairHeight);
+        expectSame(dst, ref, "transposePairRect", pairWidth * pairHeight);
+    }
+}
+
+}  // namespace
+
+int main() {
+    testRows();
+    testTransposes();
+
+    printf("PixelKernelsTest with %s: %d failures\n", PixelKernels::getSimdName(), gFailures);
+    return (gFailures == 0) ? 0 : 1;
+}
@@ -0,0 +1,730 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG AsyncLogger
+
+#include "iutils/AsyncLogger.h"
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#include "iutils/CameraLog.h"
+
+namespace icamera {
+
+namespace {
+
+// Bytes per thread, must be a power of 2
+const uint64_t kRingBytes = 64U * 1024U;
+const uint64_t kRingMask = kRingBytes - 1U;
+// The rings are never freed, they are reused by the new threads instead
+const uint32_t kMaxRings = 64U;
+// Same limit as the synchronous path
+const size_t kMaxMessage = 256U;
+const size_t kMaxArgBytes = 512U;
+const size_t kMaxStringBytes = 255U;
+const size_t kMaxSpecLen = 32U;
+const int kDrainIntervalMs = 2;
+
+const uint32_t kFlagFormatted = 1U;
+
+/**
+ * Record layout in the ring: RecordHeader, then the arguments in the order of the format
+ * string, 8 bytes each, strings as uint32_t length + bytes + '\0' padded to 8 bytes.
+ * A header with level 0 pads the end of the ring.
+ */
+struct RecordHeader {
+    uint32_t size;
+    uint32_t level;
+    int32_t tag;
+    uint32_t flags;
+    int64_t timestamp;
+    const char* fmt;
+};
+
+const uint32_t kNullString = 0xFFFFFFFFU;
+
+enum ArgType {
+    ARG_NONE = 0,  // "%%"
+    ARG_INT,
+    ARG_LONG,
+    ARG_LLONG,
+    ARG_SIZE,
+    ARG_INTMAX,
+    ARG_PTRDIFF,
+    ARG_DOUBLE,
+    ARG_STRING,
+    ARG_POINTER,
+    ARG_UNSUPPORTED,
+};
+
+struct FormatSpec {
+    const char* start;
+    size_t len;
+    int starCount;
+    bool hasPrecision;
+    int precision;  // only valid when the precision is not '*'
+    ArgType type;
+};
+
+/**
+ * Find the next conversion from p, the text before it is literal.
+ *
+ * \return the position after the conversion, nullptr if there is no more conversion.
+ */
+const char* nextSpec(const char* p, FormatSpec* spec) {
+    p = strchr(p, '%');
+    if (p == nullptr) return nullptr;
+
+    spec->start = p;
+    spec->starCount = 0;
+    spec->hasPrecision = false;
+    spec->precision = -1;
+    spec->type = ARG_UNSUPPORTED;
+
+    const char* q = p + 1;
+    if (*q == '%') {
+        spec->type = ARG_NONE;
+        spec->len = 2;
+        return q + 1;
+    }
+
+    while ((*q != '\0') && (strchr("-+ #0'", *q) != nullptr)) q++;
+    if (*q == '*') {
+        spec->starCount++;
+        q++;
+    } else {
+        while ((*q >= '0') && (*q <= '9')) q++;
+    }
+    if (*q == '.') {
+        spec->hasPrecision = true;
+        q++;
+        if (*q == '*') {
+            spec->starCount++;
+            q++;
+        } else {
+            spec->precision = 0;
+            while ((*q >= '0') && (*q <= '9')) {
+                spec->precision = spec->precision * 10 + (*q - '0');
+                q++;
+            }
+        }
+    }
+
+    int longs = 0;
+    char length = '\0';
+    while ((*q != '\0') && (strchr("hlLqjzt", *q) != nullptr)) {
+        if (*q == 'l') longs++;
+        length = *q;
+        q++;
+    }
+
+    if (*q == '\0') {
+        spec->len = q - p;
+        return q;
+    }
+
+    const char conversion = *q;
+    q++;
+    spec->len = q - p;
+
+    switch (conversion) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+        case 'c':
+            if (length == 'z') {
+                spec->type = ARG_SIZE;
+            } else if (length == 'j') {
+                spec->type = ARG_INTMAX;
+            } else if (length == 't') {
+                spec->type = ARG_PTRDIFF;
+            } else if ((longs >= 2) || (length == 'q')) {
+                spec->type = ARG_LLONG;
+            } else if (longs == 1) {
+                spec->type = ARG_LONG;
+            } else if (length != 'L') {
+                spec->type = ARG_INT;
+            }
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            // long double is not kept
+            if (length != 'L') spec->type = ARG_DOUBLE;
+            break;
+        case 's':
+            if (longs == 0) spec->type = ARG_STRING;
+            break;
+        case 'p':
+            spec->type = ARG_POINTER;
+            break;
+        default:
+            // "%n", "%m" and positional arguments need the caller's context
+            break;
+    }
+    if (spec->len >= kMaxSpecLen) spec->type = ARG_UNSUPPORTED;
+
+    return q;
+}
+
+class ArgWriter {
+ public:
+    ArgWriter(uint8_t* buf, size_t size) : mBuf(buf), mSize(size), mPos(0U) {}
+
+    template <typename T>
+    bool put(T value) {
+        if (mPos + sizeof(uint64_t) > mSize) return false;
+        memset(mBuf + mPos, 0, sizeof(uint64_t));
+        memcpy(mBuf + mPos, &value, sizeof(T));
+        mPos += sizeof(uint64_t);
+        return true;
+    }
+
+    bool putString(const char* str, int precision) {
+        if (str == nullptr) return put(kNullString);
+
+        size_t limit = kMaxStringBytes;
+        if ((precision >= 0) && (static_cast<size_t>(precision) < limit)) limit = precision;
+        const uint32_t len = static_cast<uint32_t>(strnlen(str, limit));
+        const size_t bytes = (sizeof(uint32_t) + len + 1U + 7U) & ~static_cast<size_t>(7U);
+        if (mPos + bytes > mSize) return false;
+
+        memcpy(mBuf + mPos, &len, sizeof(uint32_t));
+        memcpy(mBuf + mPos + sizeof(uint32_t), str, len);
+        memset(mBuf + mPos + sizeof(uint32_t) + len, 0, bytes - sizeof(uint32_t) - len);
+        mPos += bytes;
+        return true;
+    }
+
+    size_t size() const { return mPos; }
+
+ private:
+    uint8_t* mBuf;
+    size_t mSize;
+    size_t mPos;
+};
+
+class ArgReader {
+ public:
+    ArgReader(const uint8_t* buf, size_t size) : mBuf(buf), mSize(size), mPos(0U) {}
+
+    template <typename T>
+    T get() {
+        T value = T();
+        if (mPos + sizeof(uint64_t) <= mSize) {
+            memcpy(&value, mBuf + mPos, sizeof(T));
+            mPos += sizeof(uint64_t);
+        }
+        return value;
+    }
+
+    const char* getString() {
+        if (mPos + sizeof(uint32_t) > mSize) return nullptr;
+
+        uint32_t len = 0U;
+        memcpy(&len, mBuf + mPos, sizeof(uint32_t));
+        if (len == kNullString) {
+            mPos += sizeof(uint64_t);
+            return nullptr;
+        }
+        const char* str = reinterpret_cast<const char*>(mBuf + mPos + sizeof(uint32_t));
+        mPos += (sizeof(uint32_t) + len + 1U + 7U) & ~static_cast<size_t>(7U);
+        return str;
+    }
+
+ private:
+    const uint8_t* mBuf;
+    size_t mSize;
+    size_t mPos;
+};
+
+// Save the arguments of fmt, return false if some of them can't be kept
+bool encodeArgs(const char* fmt, va_list ap, ArgWriter* writer) {
+    FormatSpec spec;
+    const char* p = fmt;
+    while ((p = nextSpec(p, &spec)) != nullptr) {
+        if (spec.type == ARG_UNSUPPORTED) return false;
+        if (spec.type == ARG_NONE) continue;
+
+        int precision = spec.precision;
+        for (int i = 0; i < spec.starCount; i++) {
+            const int star = va_arg(ap, int);
+            // The last star is the precision if there is one
+            if (spec.hasPrecision && (i == spec.starCount - 1)) precision = star;
+            if (!writer->put(star)) return false;
+        }
+
+        bool ok = false;
+        switch (spec.type) {
+            case ARG_INT:
+                ok = writer->put(va_arg(ap, int));
+                break;
+            case ARG_LONG:
+                ok = writer->put(va_arg(ap, long));
+                break;
+            case ARG_LLONG:
+                ok = writer->put(va_arg(ap, long long));
+                break;
+            case ARG_SIZE:
+                ok = writer->put(va_arg(ap, size_t));
+                break;
+            case ARG_INTMAX:
+                ok = writer->put(va_arg(ap, intmax_t));
+                break;
+            case ARG_PTRDIFF:
+                ok = writer->put(va_arg(ap, ptrdiff_t));
+                break;
+            case ARG_DOUBLE:
+                ok = writer->put(va_arg(ap, double));
+                break;
+            case ARG_STRING:
+                ok = writer->putString(va_arg(ap, const char*), precision);
+                break;
+            case ARG_POINTER:
+                ok = writer->put(va_arg(ap, void*));
+                break;
+            default:
+                break;
+        }
+        if (!ok) return false;
+    }
+    return true;
+}
+
+template <typename T>
+int formatArg(char* out, size_t size, const char* spec, const int* stars, int starCount,
+              T value) {
+    switch (starCount) {
+        case 0:
+            return snprintf(out, size, spec, value);
+        case 1:
+            return snprintf(out, size, spec, stars[0], value);
+        default:
+            return snprintf(out, size, spec, stars[0], stars[1], value);
+    }
+}
+
+void decodeMessage(const char* fmt, const uint8_t* args, size_t argBytes, char* out,
+                   size_t size) {
+    ArgReader reader(args, argBytes);
+    size_t pos = 0U;
+    const char* p = fmt;
+    FormatSpec spec;
+    const char* next = nullptr;
+
+    while ((pos + 1U < size) && ((next = nextSpec(p, &spec)) != nullptr)) {
+        const size_t literal = std::min(static_cast<size_t>(spec.start - p), size - 1U - pos);
+        memcpy(out + pos, p, literal);
+        pos += literal;
+        p = next;
+        if (pos + 1U >= size) break;
+
+        if (spec.type == ARG_NONE) {
+            out[pos++] = '%';
+            continue;
+        }
+
+        char specBuf[kMaxSpecLen];
+        memcpy(specBuf, spec.start, spec.len);
+        specBuf[spec.len] = '\0';
+
+        int stars[2] = {0, 0};
+        for (int i = 0; (i < spec.starCount) && (i < 2); i++) {
+            stars[i] = reader.get<int>();
+        }
+
+        char* dst = out + pos;
+        const size_t left = size - pos;
+        int ret = 0;
+        switch (spec.type) {
+            case ARG_INT:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount, reader.get<int>());
+                break;
+            case ARG_LONG:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount, reader.get<long>());
+                break;
+            case ARG_LLONG:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount,
+                                reader.get<long long>());
+                break;
+            case ARG_SIZE:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount, reader.get<size_t>());
+                break;
+            case ARG_INTMAX:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount,
+                                reader.get<intmax_t>());
+                break;
+            case ARG_PTRDIFF:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount,
+                                reader.get<ptrdiff_t>());
+                break;
+            case ARG_DOUBLE:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount, reader.get<double>());
+                break;
+            case ARG_STRING:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount, reader.getString());
+                break;
+            case ARG_POINTER:
+                ret = formatArg(dst, left, specBuf, stars, spec.starCount, reader.get<void*>());
+                break;
+            default:
+                break;
+        }
+        if (ret > 0) pos += std::min(static_cast<size_t>(ret), left - 1U);
+    }
+
+    if (next == nullptr) {
+        const size_t literal = std::min(strlen(p), size - 1U - pos);
+        memcpy(out + pos, p, literal);
+        pos += literal;
+    }
+    out[pos] = '\0';
+}
+
+struct LogRing {
+    LogRing() : head(0U), tail(0U), dropped(0U), reportedDrops(0U), tid(0), inUse(true) {}
+
+    // Written by the owner thread only
+    alignas(64) std::atomic<uint64_t> head;
+    // Written by the drain thread only
+    alignas(64) std::atomic<uint64_t> tail;
+    std::atomic<uint64_t> dropped;
+    uint64_t reportedDrops;
+    std::atomic<int32_t> tid;
+    std::atomic<bool> inUse;
+    alignas(8) uint8_t buffer[kRingBytes];
+};
+
+std::mutex gRingsLock;
+std::atomic<LogRing*> gRings[kMaxRings];
+std::atomic<uint32_t> gRingCount(0U);
+
+std::atomic<bool> gEnabled(false);
+// Guards the drain thread state
+std::mutex gDrainLock;
+std::condition_variable gDrainSignal;
+std::thread gDrainThread;
+bool gRunning = false;
+thread_local bool tIsDrainThread = false;
+
+LogRing* acquireRing() {
+    std::lock_guard<std::mutex> l(gRingsLock);
+    const uint32_t count = gRingCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 0U; i < count; i++) {
+        LogRing* ring = gRings[i].load(std::memory_order_relaxed);
+        if (!ring->inUse.exchange(true, std::memory_order_acq_rel)) {
+            return ring;
+        }
+    }
+    if (count >= kMaxRings) return nullptr;
+
+    // Plain new doesn't honor the 64 bytes alignment of LogRing before C++17
+    void* memory = nullptr;
+    if (posix_memalign(&memory, alignof(LogRing), sizeof(LogRing)) != 0) return nullptr;
+    LogRing* ring = new (memory) LogRing();
+    gRings[count].store(ring, std::memory_order_relaxed);
+    gRingCount.store(count + 1U, std::memory_order_release);
+    return ring;
+}
+
+class RingHolder {
+ public:
+    RingHolder() : mRing(nullptr), mAcquired(false) {}
+    ~RingHolder() {
+        if (mRing != nullptr) {
+            mRing->inUse.store(false, std::memory_order_release);
+        }
+    }
+
+    LogRing* get() {
+        if (!mAcquired) {
+            mAcquired = true;
+            mRing = acquireRing();
+            if (mRing != nullptr) {
+                mRing->tid.store(static_cast<int32_t>(syscall(SYS_gettid)),
+                                 std::memory_order_relaxed);
+            }
+        }
+        return mRing;
+    }
+
+ private:
+    LogRing* mRing;
+    bool mAcquired;
+};
+
+thread_local RingHolder tRingHolder;
+
+int64_t getTimeUs() {
+    struct timespec ts = {};
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+bool pushRecord(LogRing* ring, const RecordHeader& header, const void* payload,
+                size_t payloadBytes) {
+    const uint64_t size = header.size;
+    const uint64_t head = ring->head.load(std::memory_order_relaxed);
+    const uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    const uint64_t offset = head & kRingMask;
+    // A record never wraps, the end of the ring is padded instead
+    const uint64_t pad = (kRingBytes - offset < size) ? (kRingBytes - offset) : 0U;
+
+    if (head + pad + size - tail > kRingBytes) return false;
+
+    if (pad != 0U) {
+        const uint32_t padding[2] = {static_cast<uint32_t>(pad), 0U};
+        memcpy(ring->buffer + offset, padding, sizeof(padding));
+    }
+    uint8_t* dst = ring->buffer + ((head + pad) & kRingMask);
+    memcpy(dst, &header, sizeof(header));
+    memcpy(dst + sizeof(header), payload, payloadBytes);
+
+    ring->head.store(head + pad + size, std::memory_order_release);
+    return true;
+}
+
+// Skip the padding, return the next record before end or nullptr
+const RecordHeader* peekRecord(LogRing* ring, uint64_t end) {
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    while (tail < end) {
+        const RecordHeader* header =
+            reinterpret_cast<const RecordHeader*>(ring->buffer + (tail & kRingMask));
+        if (header->level != 0U) return header;
+
+        tail += header->size;
+        ring->tail.store(tail, std::memory_order_release);
+    }
+    return nullptr;
+}
+
+void sendRecord(const RecordHeader* header) {
+    const uint8_t* payload = reinterpret_cast<const uint8_t*>(header + 1);
+    const size_t payloadBytes = header->size - sizeof(RecordHeader);
+
+    char message[kMaxMessage];
+    if ((header->flags & kFlagFormatted) != 0U) {
+        snprintf(message, sizeof(message), "%s", reinterpret_cast<const char*>(payload));
+    } else {
+        decodeMessage(header->fmt, payload, payloadBytes, message, sizeof(message));
+    }
+
+    globalLogSink->sendOffLog({message, header->level, tagNames[header->tag], header->timestamp});
+}
+
+void reportDrops(LogRing* ring) {
+    const uint64_t dropped = ring->dropped.load(std::memory_order_relaxed);
+    if (dropped == ring->reportedDrops) return;
+
+    char message[kMaxMessage];
+    snprintf(message, sizeof(message), "%lu logs of thread %d are dropped, %lu in total",
+             static_cast<unsigned long>(dropped - ring->reportedDrops),
+             ring->tid.load(std::memory_order_relaxed), static_cast<unsigned long>(dropped));
+    ring->reportedDrops = dropped;
+    globalLogSink->sendOffLog(
+        {message, CAMERA_DEBUG_LOG_WARNING, tagNames[GENERATED_TAGS_AsyncLogger], getTimeUs()});
+}
+
+/**
+ * Send the records queued before the call, the records of all threads are merged
+ * by their timestamps.
+ *
+ * \return true if any record is sent.
+ */
+bool drainRings() {
+    const uint32_t count = gRingCount.load(std::memory_order_acquire);
+    uint64_t ends[kMaxRings];
+    for (uint32_t i = 0U; i < count; i++) {
+        LogRing* ring = gRings[i].load(std::memory_order_relaxed);
+        ends[i] = ring->head.load(std::memory_order_acquire);
+        reportDrops(ring);
+    }
+
+    bool sent = false;
+    while (true) {
+        LogRing* oldest = nullptr;
+        const RecordHeader* oldestRecord = nullptr;
+        for (uint32_t i = 0U; i < count; i++) {
+            LogRing* ring = gRings[i].load(std::memory_order_relaxed);
+            const RecordHeader* record = peekRecord(ring, ends[i]);
+            if ((record != nullptr) &&
+                ((oldestRecord == nullptr) || (record->timestamp < oldestRecord->timestamp))) {
+                oldest = ring;
+                oldestRecord = record;
+            }
+        }
+        if (oldest == nullptr) break;
+
+        sendRecord(oldestRecord);
+        const uint64_t tail = oldest->tail.load(std::memory_order_relaxed);
+        oldest->tail.store(tail + oldestRecord->size, std::memory_order_release);
+        sent = true;
+    }
+    return sent;
+}
+
+void drainLoop() {
+    tIsDrainThread = true;
+    std::unique_lock<std::mutex> l(gDrainLock);
+    while (gRunning) {
+        l.unlock();
+        const bool sent = drainRings();
+        l.lock();
+        if (!sent && gRunning) {
+            gDrainSignal.wait_for(l, std::chrono::milliseconds(kDrainIntervalMs));
+        }
+    }
+}
+
+// Stop the drain thread at exit, a joinable std::thread can't be destroyed
+class DrainThreadStopper {
+ public:
+    ~DrainThreadStopper() { AsyncLogger::stop(); }
+};
+
+DrainThreadStopper gDrainThreadStopper;
+
+}  // namespace
+
+void AsyncLogger::start() {
+    std::lock_guard<std::mutex> l(gDrainLock);
+    if (gRunning) return;
+
+    gRunning = true;
+    gDrainThread = std::thread(drainLoop);
+    gEnabled.store(true, std::memory_order_release);
+}
+
+void AsyncLogger::stop() {
+    {
+        std::lock_guard<std::mutex> l(gDrainLock);
+        if (!gRunning) return;
+
+        gEnabled.store(false, std::memory_order_release);
+        gRunning = false;
+    }
+    gDrainSignal.notify_one();
+    gDrainThread.join();
+
+    // Send what is left, new logs are written synchronously from now on
+    drainRings();
+}
+
+bool AsyncLogger::isEnabled() {
+    return gEnabled.load(std::memory_order_relaxed);
+}
+
+bool AsyncLogger::log(int logTag, uint32_t level, const char* fmt, va_list ap) {
+    /*
+     * Errors and warnings are written by the caller, so they aren't lost if the process
+     * aborts right after. Send the queued logs first to keep the order.
+     */
+    if ((level & (CAMERA_DEBUG_LOG_ERR | CAMERA_DEBUG_LOG_WARNING)) != 0U) {
+        if (!tIsDrainThread) flush();
+        return false;
+    }
+
+    LogRing* ring = tRingHolder.get();
+    if (ring == nullptr) return false;
+
+    RecordHeader header = {};
+    header.level = level;
+    header.tag = logTag;
+    header.timestamp = getTimeUs();
+    header.fmt = fmt;
+
+    alignas(8) uint8_t payload[kMaxArgBytes];
+    size_t payloadBytes = 0U;
+
+    va_list args;
+    va_copy(args, ap);
+    ArgWriter writer(payload, sizeof(payload));
+    const bool encoded = encodeArgs(fmt, args, &writer);
+    va_end(args);
+
+    if (encoded) {
+        payloadBytes = writer.size();
+    } else {
+        // Keep the formatted message instead
+        va_copy(args, ap);
+        char* message = reinterpret_cast<char*>(payload);
+        vsnprintf(message, kMaxMessage, fmt, args);
+        va_end(args);
+        message[kMaxMessage - 1U] = '\0';
+        payloadBytes = strlen(message) + 1U;
+        header.flags = kFlagFormatted;
+        header.fmt = nullptr;
+    }
+
+    header.size = static_cast<uint32_t>((sizeof(header) + payloadBytes + 7U) &
+                                        ~static_cast<size_t>(7U));
+    if (!pushRecord(ring, header, payload, payloadBytes)) {
+        ring->dropped.fetch_add(1U, std::memory_order_relaxed);
+    }
+    return true;
+}
+
+void AsyncLogger::flush() {
+    if (!isEnabled()) return;
+
+    const uint32_t count = gRingCount.load(std::memory_order_acquire);
+    uint64_t ends[kMaxRings];
+    for (uint32_t i = 0U; i < count; i++) {
+        ends[i] = gRings[i].load(std::memory_order_relaxed)->head.load(std::memory_order_acquire);
+    }
+    gDrainSignal.notify_one();
+
+    for (uint32_t i = 0U; i < count; i++) {
+        LogRing* ring = gRings[i].load(std::memory_order_relaxed);
+        while (isEnabled() && (ring->tail.load(std::memory_order_acquire) < ends[i])) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    }
+}
+
+uint64_t AsyncLogger::getDroppedCount() {
+    uint64_t dropped = 0U;
+    const uint32_t count = gRingCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < count; i++) {
+        dropped += gRings[i].load(std::memory_order_relaxed)->dropped.load(
+            std::memory_order_relaxed);
+    }
+    return dropped;
+}
+
+}  // namespace icamera
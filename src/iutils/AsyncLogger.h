@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <stdarg.h>
+
+#include <cstdint>
+
+namespace icamera {
+
+/**
+ * \class AsyncLogger
+ *
+ * Moves the formatting and the sink writing of the logs out of the calling threads.
+ * It is enabled by "cameraAsyncLog=1".
+ *
+ * Each thread writes its logs to its own byte ring without any lock: the format string
+ * pointer, the level, the tag, the time and the raw arguments (strings are copied).
+ * A drain thread formats the records and sends them to globalLogSink, so the cost of
+ * a log call is bounded by the length of its format string and its string arguments.
+ *
+ * When a ring is full the log is dropped and counted, the drain thread reports the
+ * dropped count of each thread through the sink.
+ *
+ * Errors and warnings are not queued: the queued logs are flushed and the caller writes
+ * them synchronously, so they are kept even if the process aborts after them.
+ */
+class AsyncLogger {
+ public:
+    static void start();
+    static void stop();
+    static bool isEnabled();
+
+    /**
+     * Queue one log to the ring of the calling thread.
+     *
+     * \return false if the log is not queued and must be written by the caller.
+     */
+    static bool log(int logTag, uint32_t level, const char* fmt, va_list ap);
+
+    // Wait until the logs queued before the call are sent to the sink
+    static void flush();
+
+    // Number of logs dropped by all threads because their rings were full
+    static uint64_t getDroppedCount();
+};
+
+}  // namespace icamera
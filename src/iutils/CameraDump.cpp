@@ -19,12 +19,17 @@
 #include "iutils/CameraDump.h"
 
 #include <dirent.h>
+#include <errno.h>
 #include <fcntl.h>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/stat.h>
+#include <unistd.h>
 
+#include <atomic>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -32,6 +37,7 @@
 #include "PlatformData.h"
 #include "iutils/CameraLog.h"
 #include "iutils/Errors.h"
+#include "iutils/Thread.h"
 #include "iutils/Utils.h"
 
 #include "3a/AiqResult.h"
@@ -69,6 +75,226 @@ static const char* StreamUsage[] = {
     "app",
 };  // map to the StreamUsage
 
+static const int MODULE_NUM = ARRAY_SIZE(ModuleName);
+// Max dumps per second of each module, 0 means no limit
+static int gDumpRate[MODULE_NUM] = {};
+static std::atomic<nsecs_t> gLastDumpTime[MODULE_NUM];
+static std::atomic<uint32_t> gRateDrops[MODULE_NUM];
+static std::atomic<uint32_t> gBudgetDrops[MODULE_NUM];
+
+/**
+ * \class DumpWriter
+ *
+ * Writes the dumps on its own thread, so the calling thread only copies the data.
+ * The staging buffers are kept for the next dumps and their total size is bounded
+ * by the budget, a dump is dropped if it doesn't fit.
+ */
+class DumpWriter : public Thread {
+ public:
+    explicit DumpWriter(size_t budget);
+    ~DumpWriter() {}
+
+    // Return false if there is no staging memory for the data
+    bool queue(const void* data, size_t size, const char* fileName);
+    void flush();
+
+ private:
+    // Staging buffers are aligned for O_DIRECT
+    static const size_t STAGING_ALIGNMENT = 4096U;
+
+    struct DumpJob {
+        std::string fileName;
+        void* data;
+        size_t size;
+        size_t capacity;
+    };
+
+    bool threadLoop() override;
+    void writeFile(const DumpJob& job);
+    void* acquireStaging(size_t size, size_t* capacity);
+    void releaseStaging(void* data, size_t capacity);
+
+    size_t mBudget;
+    size_t mAllocated;  // bytes of all the staging buffers
+
+    Mutex mLock;  // protect the members below
+    Condition mJobSignal;
+    Condition mIdleSignal;
+    std::deque<DumpJob> mJobs;
+    std::vector<std::pair<void*, size_t>> mFreeStaging;
+    bool mWriting;
+};
+
+DumpWriter::DumpWriter(size_t budget) : mBudget(budget), mAllocated(0U), mWriting(false) {}
+
+void* DumpWriter::acquireStaging(size_t size, size_t* capacity) {
+    const size_t needed = ALIGN(size, STAGING_ALIGNMENT);
+
+    // The smallest free buffer which is big enough
+    auto best = mFreeStaging.end();
+    for (auto it = mFreeStaging.begin(); it != mFreeStaging.end(); ++it) {
+        if ((it->second >= needed) && ((best == mFreeStaging.end()) || (it->second < best->second))) {
+            best = it;
+        }
+    }
+    if (best != mFreeStaging.end()) {
+        void* data = best->first;
+        *capacity = best->second;
+        mFreeStaging.erase(best);
+        return data;
+    }
+
+    // Release the free buffers which are too small to make room for a new one
+    while ((mAllocated + needed > mBudget) && !mFreeStaging.empty()) {
+        free(mFreeStaging.back().first);
+        mAllocated -= mFreeStaging.back().second;
+        mFreeStaging.pop_back();
+    }
+    if (mAllocated + needed > mBudget) return nullptr;
+
+    void* data = nullptr;
+    if (posix_memalign(&data, STAGING_ALIGNMENT, needed) != 0) return nullptr;
+
+    mAllocated += needed;
+    *capacity = needed;
+    return data;
+}
+
+void DumpWriter::releaseStaging(void* data, size_t capacity) {
+    mFreeStaging.push_back(std::make_pair(data, capacity));
+}
+
+bool DumpWriter::queue(const void* data, size_t size, const char* fileName) {
+    DumpJob job = {fileName, nullptr, size, 0U};
+    {
+        AutoMutex l(mLock);
+        job.data = acquireStaging(size, &job.capacity);
+        if (job.data == nullptr) return false;
+    }
+
+    MEMCPY_S(job.data, job.capacity, data, size);
+
+    AutoMutex l(mLock);
+    mJobs.push_back(job);
+    mJobSignal.signal();
+    return true;
+}
+
+void DumpWriter::flush() {
+    ConditionLock lock(mLock);
+    while (!mJobs.empty() || mWriting) {
+        mIdleSignal.wait(lock);
+    }
+}
+
+// Return the bytes written, less than size on error
+static size_t writeAll(int fd, const uint8_t* data, size_t size) {
+    size_t written = 0U;
+    while (written < size) {
+        const ssize_t ret = write(fd, data + written, size - written);
+        if ((ret < 0) && (errno == EINTR)) continue;
+        if (ret <= 0) break;
+        written += ret;
+    }
+    return written;
+}
+
+void DumpWriter::writeFile(const DumpJob& job) {
+    // O_DIRECT needs the size aligned, write the whole staging buffer and truncate it
+    bool direct = true;
+    int fd = open(job.fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0666);
+    if ((fd < 0) && (errno == EINVAL)) {
+        // The file system doesn't support O_DIRECT
+        direct = false;
+        fd = open(job.fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    }
+    CheckAndLogError(fd < 0, VOID_VALUE, "open dump file %s failed", job.fileName.c_str());
+
+    LOG1("Write data to file:%s", job.fileName.c_str());
+    const uint8_t* data = static_cast<const uint8_t*>(job.data);
+    if (direct) {
+        if (writeAll(fd, data, job.capacity) == job.capacity) {
+            if (ftruncate(fd, job.size) != 0) {
+                LOGW("Failed to truncate %s to %zu bytes", job.fileName.c_str(), job.size);
+            }
+            (void)close(fd);
+            return;
+        }
+
+        // Some file systems accept O_DIRECT at open but reject the write, rewrite it buffered
+        LOG1("O_DIRECT write to %s failed (%s), retry buffered", job.fileName.c_str(),
+             strerror(errno));
+        (void)close(fd);
+        fd = open(job.fileName.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        CheckAndLogError(fd < 0, VOID_VALUE, "open dump file %s failed", job.fileName.c_str());
+    }
+
+    if (writeAll(fd, data, job.size) < job.size) {
+        LOGW("Error or short count writing %zu bytes to %s", job.size, job.fileName.c_str());
+    }
+    (void)close(fd);
+}
+
+bool DumpWriter::threadLoop() {
+    DumpJob job;
+    {
+        ConditionLock lock(mLock);
+        while (mJobs.empty()) {
+            mJobSignal.wait(lock);
+        }
+        job = mJobs.front();
+        mJobs.pop_front();
+        mWriting = true;
+    }
+
+    writeFile(job);
+
+    AutoMutex l(mLock);
+    releaseStaging(job.data, job.capacity);
+    mWriting = false;
+    if (mJobs.empty()) {
+        mIdleSignal.broadcast();
+    }
+    return true;
+}
+
+// Created once and kept for the whole process, as the log sinks
+static DumpWriter* gDumpWriter = nullptr;
+
+static bool isDumpRateAllowed(ModuleType_t type) {
+    const int rate = gDumpRate[type];
+    if (rate <= 0) return true;
+
+    const nsecs_t interval = 1000000000LL / rate;
+    const nsecs_t now = CameraUtils::systemTime();
+    nsecs_t last = gLastDumpTime[type].load(std::memory_order_relaxed);
+    do {
+        if ((last != 0) && (now - last < interval)) return false;
+    } while (!gLastDumpTime[type].compare_exchange_weak(last, now, std::memory_order_relaxed));
+
+    return true;
+}
+
+/**
+ * @brief parse dump rate string, such as "isys:10,psys:5"
+ *
+ * @param rateStr module names of ModuleName and their max dumps per second
+ */
+static void parseDumpRate(const char* rateStr) {
+    for (const auto& item : CameraUtils::splitString(rateStr, ',')) {
+        const auto pos = item.find(':');
+        if (pos == std::string::npos) continue;
+
+        const std::string name = item.substr(0, pos);
+        for (int i = 0; i < MODULE_NUM; i++) {
+            if (name == ModuleName[i]) {
+                gDumpRate[i] = static_cast<int>(strtol(item.substr(pos + 1).c_str(), nullptr, 0));
+                LOG1("Dump rate of %s is %d per second", ModuleName[i], gDumpRate[i]);
+            }
+        }
+    }
+}
+
 /**
  * @brief parse range string, such as "1000,2000", "1000~2000", "1000-2000"
  *
@@ -111,6 +337,8 @@ void CameraDump::setDumpLevel(void) {
     const char* PROP_CAMERA_HAL_DUMP_PATTERN = "cameraDumpPattern";
     const char* PROP_CAMERA_HAL_DUMP_PATTERN_MASK = "cameraDumpPatternMask";
     const char* PROP_CAMERA_HAL_DUMP_PATTERN_RANGE = "cameraDumpPatternRange";
+    const char* PROP_CAMERA_HAL_DUMP_BUDGET = "cameraDumpBudget";
+    const char* PROP_CAMERA_HAL_DUMP_RATE = "cameraDumpRate";
 
     // dump, it's used to dump images or some parameters to a file.
     char* dumpType = getenv(PROP_CAMERA_HAL_DUMP);
@@ -178,6 +406,22 @@ void CameraDump::setDumpLevel(void) {
         LOG1("Dump pattern range is line %d-%d", gDumpPatternLineMin, gDumpPatternLineMax);
     }
 
+    // Staging memory in MB of the dump thread, dumps are written by the caller if it's not set
+    char* cameraDumpBudget = getenv(PROP_CAMERA_HAL_DUMP_BUDGET);
+    if ((cameraDumpBudget != nullptr) && (gDumpWriter == nullptr)) {
+        const size_t budget = strtoul(cameraDumpBudget, nullptr, 0);
+        if (budget > 0U) {
+            gDumpWriter = new DumpWriter(budget * 1024U * 1024U);
+            gDumpWriter->run("CamHAL_DUMP", PRIORITY_BACKGROUND);
+            LOGI("Dump budget is %zu MB", budget);
+        }
+    }
+
+    char* cameraDumpRate = getenv(PROP_CAMERA_HAL_DUMP_RATE);
+    if (cameraDumpRate != nullptr) {
+        parseDumpRate(cameraDumpRate);
+    }
+
     // the PG dump is implemented in libiacss
     if ((gDumpType & static_cast<int>(DUMP_PSYS_PG)) != 0U) {
         const char* PROP_CAMERA_CSS_DEBUG = "camera_css_debug";
@@ -218,10 +462,25 @@ const char* CameraDump::getDumpPath(void) {
     return gDumpPath;
 }
 
-void CameraDump::writeData(const void* data, int size, const char* fileName) {
+void CameraDump::writeData(const void* data, int size, const char* fileName,
+                           ModuleType_t mType) {
     CheckAndLogError((data == nullptr) || (size == 0) || (fileName == nullptr), VOID_VALUE,
                      "Nothing needs to be dumped");
 
+    if (!isDumpRateAllowed(mType)) {
+        gRateDrops[mType]++;
+        LOG2("%s: over the dump rate, drop %s", __func__, fileName);
+        return;
+    }
+
+    if (gDumpWriter != nullptr) {
+        if (!gDumpWriter->queue(data, size, fileName)) {
+            gBudgetDrops[mType]++;
+            LOG2("%s: over the dump budget, drop %s", __func__, fileName);
+        }
+        return;
+    }
+
     FILE* fp = fopen(fileName, "w+");
     CheckAndLogError(fp == nullptr, VOID_VALUE, "open dump file %s failed", fileName);
 
@@ -231,6 +490,21 @@ void CameraDump::writeData(const void* data, int size, const char* fileName) {
     (void)fclose(fp);
 }
 
+void CameraDump::flush(void) {
+    if (gDumpWriter != nullptr) {
+        gDumpWriter->flush();
+    }
+
+    for (int i = 0; i < MODULE_NUM; i++) {
+        const uint32_t rateDrops = gRateDrops[i].exchange(0U);
+        const uint32_t budgetDrops = gBudgetDrops[i].exchange(0U);
+        if ((rateDrops != 0U) || (budgetDrops != 0U)) {
+            LOGW("%s dumps dropped: %u over the rate, %u over the budget", ModuleName[i],
+                 rateDrops, budgetDrops);
+        }
+    }
+}
+
 static string getNamePrefix(int cameraId, ModuleType_t type, uuid port, int sUsage = 0) {
     const char* dumpPath = CameraDump::getDumpPath();
     const char* sensorName = PlatformData::getSensorName(cameraId);
@@ -508,7 +782,7 @@ void CameraDump::dumpImage(int cameraId, const shared_ptr<CameraBuffer>& camBuff
         CameraUtils::format2string(camBuffer->getFormat()).c_str(), camBuffer->getSequence(),
         camBuffer->getWidth(), camBuffer->getHeight());
 
-    CameraBufferMapper mapper(camBuffer);
+    CameraBufferMapper mapper(cameraId, camBuffer);
     if (gDumpPatternEnabled != 0U) {
         if (matchPattern(mapper.addr(), mapper.size(),
                          camBuffer->getWidth(), camBuffer->getHeight(),
@@ -519,7 +793,7 @@ void CameraDump::dumpImage(int cameraId, const shared_ptr<CameraBuffer>& camBuff
         return;
     }
     LOG1("dumpImage size:%d, buf:%p, fileName:%s", mapper.size(), mapper.addr(), fileName.c_str());
-    writeData(mapper.addr(), mapper.size(), fileName.c_str());
+    writeData(mapper.addr(), mapper.size(), fileName.c_str(), type);
 }
 
 void CameraDump::dumpBinary(int cameraId, const void* data, int size, BinParam_t* binParam) {
@@ -541,7 +815,7 @@ void CameraDump::dumpBinary(int cameraId, const void* data, int size, BinParam_t
     string prefix = getNamePrefix(cameraId, binParam->mType, INVALID_PORT, binParam->sUsage);
     string fileName = formatBinFileName(cameraId, prefix.c_str(), binParam);
     LOG2("@%s, fileName:%s", __func__, fileName.c_str());
-    writeData(data, size, fileName.c_str());
+    writeData(data, size, fileName.c_str(), binParam->mType);
 }
 
 }  // namespace icamera
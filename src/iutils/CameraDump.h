@@ -138,7 +138,16 @@ namespace CameraDump {
 void setDumpLevel(void);
 bool isDumpTypeEnable(uint32_t dumpType);
 bool isDumpFormatEnable(uint32_t dumpFormat);
-void writeData(const void* data, int size, const char* fileName);
+/**
+ * Write data to fileName. With "cameraDumpBudget", the data is copied to the staging
+ * memory and written by the dump thread, it's dropped if the budget is used up.
+ * With "cameraDumpRate", the dumps of one module over the rate are dropped.
+ */
+void writeData(const void* data, int size, const char* fileName, ModuleType_t mType = M_NA);
+/**
+ * Wait until the queued dumps are written, and report the dropped dumps.
+ */
+void flush(void);
 const char* getDumpPath(void);
 void parseRange(const char* rangeStr, uint32_t* rangeMin, uint32_t* rangeMax);
 int matchPattern(void* data, int bufferSize, int w, int h, int stride, int format);
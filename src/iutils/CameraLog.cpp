@@ -31,6 +31,7 @@
 
 #include "CameraLog.h"
 #include "Trace.h"
+#include "iutils/AsyncLogger.h"
 #include "iutils/Utils.h"
 
 icamera::LogOutputSink* globalLogSink;
@@ -47,6 +48,8 @@ int32_t gSlowlyRunRatio = 0;
 static bool gIsDumpMediaTopo = false;
 // DUMP_ENTITY_TOPOLOGY_E
 static bool gIsDumpMediaInfo = false;
+static bool gIsPerfBreakdownEnabled = false;
+static bool gIsPerfTracesEnabled = false;
 
 const char* cameraDebugLogToString(uint32_t level) {
     switch (level) {
@@ -122,13 +125,18 @@ void doLogBody(int logTag, uint32_t level, int grpPosition, const char* fmt, ...
         return;
     }
 
-    char message[256];
     va_list ap;
     va_start(ap, fmt);
+    if (AsyncLogger::isEnabled() && AsyncLogger::log(grpPosition, level, fmt, ap)) {
+        va_end(ap);
+        return;
+    }
+
+    char message[256];
     vsnprintf(message, sizeof(message), fmt, ap);
     va_end(ap);
 
-    globalLogSink->sendOffLog({message, level, tagNames[grpPosition]});
+    globalLogSink->sendOffLog({message, level, tagNames[grpPosition], 0});
 }
 
 void doLogBody(int logTag, uint32_t level, const char* fmt, ...) {
@@ -136,13 +144,18 @@ void doLogBody(int logTag, uint32_t level, const char* fmt, ...) {
         return;
     }
 
-    char message[256];
     va_list ap;
     va_start(ap, fmt);
+    if (AsyncLogger::isEnabled() && AsyncLogger::log(logTag, level, fmt, ap)) {
+        va_end(ap);
+        return;
+    }
+
+    char message[256];
     vsnprintf(message, sizeof(message), fmt, ap);
     va_end(ap);
 
-    globalLogSink->sendOffLog({message, level, tagNames[logTag]});
+    globalLogSink->sendOffLog({message, level, tagNames[logTag], 0});
 }
 
 namespace Log {
@@ -201,6 +214,7 @@ void setDebugLevel(void) {
 
     const char* PROP_CAMERA_HAL_DEBUG = "cameraDebug";
     const char* PROP_CAMERA_RUN_RATIO = "cameraRunRatio";
+    const char* PROP_CAMERA_ASYNC_LOG = "cameraAsyncLog";
 
     // debug
     char* dbgLevel = getenv(PROP_CAMERA_HAL_DEBUG);
@@ -217,6 +231,12 @@ void setDebugLevel(void) {
 
     setLogTagLevel();
 
+    char* asyncLog = getenv(PROP_CAMERA_ASYNC_LOG);
+    if ((asyncLog != nullptr) && (strtoul(asyncLog, nullptr, 0) != 0U)) {
+        AsyncLogger::start();
+        LOG1("Async log is enabled");
+    }
+
     char* slowlyRunRatio = getenv(PROP_CAMERA_RUN_RATIO);
     if (slowlyRunRatio != nullptr) {
         gSlowlyRunRatio = strtoul(slowlyRunRatio, nullptr, 0);
@@ -232,10 +252,10 @@ void setDebugLevel(void) {
 
         // bitmask of tracing categories
         if ((gPerfLevel & static_cast<int>(CAMERA_DEBUG_LOG_PERF_TRACES)) != 0U) {
-            LOG1("Perf KPI start/end trace is not yet supported");
+            gIsPerfTracesEnabled = true;
         }
         if ((gPerfLevel & static_cast<int>(CAMERA_DEBUG_LOG_PERF_TRACES_BREAKDOWN)) != 0U) {
-            LOG1("Perf KPI breakdown trace is not yet supported");
+            gIsPerfBreakdownEnabled = true;
         }
         if ((gPerfLevel & static_cast<int>(CAMERA_DEBUG_LOG_PERF_IOCTL_BREAKDOWN)) != 0U) {
             LOG1("Perf IOCTL breakdown trace is not yet supported");
@@ -277,6 +297,14 @@ bool isDumpMediaInfo(void) {
     return gIsDumpMediaInfo;
 }
 
+bool isPerfBreakdownEnabled(void) {
+    return gIsPerfBreakdownEnabled;
+}
+
+bool isPerfTracesEnabled(void) {
+    return gIsPerfTracesEnabled;
+}
+
 __attribute__((__format__(__printf__, 1, 0))) void ccaPrintError(const char* fmt, va_list ap) {
     if ((gLogLevel & static_cast<int>(CAMERA_DEBUG_LOG_CCA)) != 0U) {
         printLog("CCA_DEBUG", CAMERA_DEBUG_LOG_ERR, fmt, ap);
@@ -79,7 +79,7 @@ enum {
 };
 
 enum {
-    /* Emit well-formed performance traces */
+    /* Record the per-frame timeline of the pipeline, see FrameTimeline */
     CAMERA_DEBUG_LOG_PERF_TRACES = 1U,
 
     /* Print out detailed timing analysis */
@@ -122,6 +122,8 @@ bool isLogTagEnabled(int tag);
 bool isDumpMediaTopo(void);
 // DUMP_ENTITY_TOPOLOGY_E
 bool isDumpMediaInfo(void);
+bool isPerfBreakdownEnabled(void);
+bool isPerfTracesEnabled(void);
 void ccaPrintError(const char* fmt, va_list ap);
 void ccaPrintInfo(const char* fmt, va_list ap);
 }  // namespace Log
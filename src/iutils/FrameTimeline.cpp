@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG FrameTimeline
+
+#include "iutils/FrameTimeline.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+#include "PlatformData.h"
+#include "iutils/CameraDump.h"
+#include "iutils/CameraLog.h"
+#include "iutils/Errors.h"
+#include "iutils/Utils.h"
+
+namespace icamera {
+
+namespace {
+
+// Records per thread, must be a power of 2. 2048 records are more than 2s at 60fps
+// for the busiest thread.
+const uint64_t kRingSize = 2048U;
+const uint64_t kRingMask = kRingSize - 1U;
+// The rings are never freed, they are reused by the new threads instead
+const uint32_t kMaxRings = 64U;
+
+const char* kEventNames[TIMELINE_EVENT_MAX] = {
+    "qbuf", "sof", "isys_dqbuf", "3a_run", "pac_run", "psys_node_done", "post_process",
+    "jpeg", "dqbuf",
+};
+
+struct ThreadRing {
+    ThreadRing() : head(0U), inUse(true) {}
+
+    // Index of the next record, only written by the owner thread
+    std::atomic<uint64_t> head;
+    std::atomic<bool> inUse;
+    TimelineRecord records[kRingSize];
+};
+
+std::mutex gRingsLock;
+std::atomic<ThreadRing*> gRings[kMaxRings];
+std::atomic<uint32_t> gRingCount(0U);
+// End of the records already saved by save(), guarded by gRingsLock
+nsecs_t gSavedTime[MAX_CAMERA_NUMBER];
+
+ThreadRing* acquireRing() {
+    std::lock_guard<std::mutex> l(gRingsLock);
+    const uint32_t count = gRingCount.load(std::memory_order_relaxed);
+    for (uint32_t i = 0U; i < count; i++) {
+        ThreadRing* ring = gRings[i].load(std::memory_order_relaxed);
+        if (!ring->inUse.exchange(true, std::memory_order_acq_rel)) {
+            return ring;
+        }
+    }
+    if (count >= kMaxRings) {
+        LOGW("%s, no ring left, records of this thread are dropped", __func__);
+        return nullptr;
+    }
+
+    ThreadRing* ring = new ThreadRing();
+    gRings[count].store(ring, std::memory_order_relaxed);
+    gRingCount.store(count + 1U, std::memory_order_release);
+    return ring;
+}
+
+class RingHolder {
+ public:
+    RingHolder() : mRing(nullptr), mTid(0), mAcquired(false) {}
+    ~RingHolder() {
+        if (mRing != nullptr) {
+            mRing->inUse.store(false, std::memory_order_release);
+        }
+    }
+
+    ThreadRing* get() {
+        if (!mAcquired) {
+            mAcquired = true;
+            mTid = static_cast<int32_t>(syscall(SYS_gettid));
+            mRing = acquireRing();
+        }
+        return mRing;
+    }
+    int32_t tid() const { return mTid; }
+
+ private:
+    ThreadRing* mRing;
+    int32_t mTid;
+    bool mAcquired;
+};
+
+thread_local RingHolder tRingHolder;
+
+void copyRing(const ThreadRing* ring, int cameraId, nsecs_t since,
+              std::vector<TimelineRecord>* records) {
+    const uint64_t head = ring->head.load(std::memory_order_acquire);
+    uint64_t first = (head > kRingSize) ? (head - kRingSize) : 0U;
+
+    std::vector<TimelineRecord> copied;
+    copied.reserve(head - first);
+    for (uint64_t i = first; i < head; i++) {
+        copied.push_back(ring->records[i & kRingMask]);
+    }
+
+    // The owner may have overwritten the oldest records during the copy, drop them
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t newHead = ring->head.load(std::memory_order_relaxed);
+    const uint64_t valid = (newHead >= kRingSize) ? (newHead - kRingSize + 1U) : 0U;
+    const uint64_t skip = (valid > first) ? std::min(valid - first, head - first) : 0U;
+
+    for (uint64_t i = skip; i < copied.size(); i++) {
+        const TimelineRecord& r = copied[i];
+        if (((cameraId < 0) || (r.cameraId == cameraId)) && (r.timestamp >= since)) {
+            records->push_back(r);
+        }
+    }
+}
+
+void collectRecords(int cameraId, nsecs_t since, std::vector<TimelineRecord>* records) {
+    const uint32_t count = gRingCount.load(std::memory_order_acquire);
+    for (uint32_t i = 0U; i < count; i++) {
+        copyRing(gRings[i].load(std::memory_order_relaxed), cameraId, since, records);
+    }
+    std::sort(records->begin(), records->end(),
+              [](const TimelineRecord& a, const TimelineRecord& b) {
+                  return a.timestamp < b.timestamp;
+              });
+}
+
+int writeChromeTrace(const std::vector<TimelineRecord>& records, const char* fileName) {
+    FILE* fp = fopen(fileName, "w");
+    CheckAndLogError(fp == nullptr, BAD_VALUE, "%s, open %s failed", __func__, fileName);
+
+    fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+    for (size_t i = 0U; i < records.size(); i++) {
+        const TimelineRecord& r = records[i];
+        const char* name = FrameTimeline::getEventName(static_cast<TimelineEvent>(r.event));
+        // Chrome trace timestamps are in microseconds
+        fprintf(fp, "%s\n{\"name\":\"%s\",\"cat\":\"camera\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,",
+                (i == 0U) ? "" : ",", name, r.cameraId, r.tid, r.timestamp / 1000.0);
+        if (r.duration > 0) {
+            fprintf(fp, "\"ph\":\"X\",\"dur\":%.3f,", r.duration / 1000.0);
+        } else {
+            fprintf(fp, "\"ph\":\"i\",\"s\":\"t\",");
+        }
+        fprintf(fp, "\"args\":{\"seq\":%" PRId64 ",\"arg\":%u}}", r.sequence, r.arg);
+    }
+    fprintf(fp, "\n]}\n");
+
+    const bool failed = (ferror(fp) != 0);
+    fclose(fp);
+    CheckAndLogError(failed, UNKNOWN_ERROR, "%s, write %s failed", __func__, fileName);
+
+    return OK;
+}
+
+int writeBinary(const std::vector<TimelineRecord>& records, const char* fileName) {
+    FILE* fp = fopen(fileName, "wb");
+    CheckAndLogError(fp == nullptr, BAD_VALUE, "%s, open %s failed", __func__, fileName);
+
+    const uint32_t header[3] = {0x314c5446U,  // "FTL1"
+                                static_cast<uint32_t>(sizeof(TimelineRecord)),
+                                static_cast<uint32_t>(records.size())};
+    bool failed = (fwrite(header, sizeof(header), 1, fp) != 1U);
+    if (!failed && !records.empty()) {
+        failed = (fwrite(records.data(), sizeof(TimelineRecord), records.size(), fp) !=
+                  records.size());
+    }
+    fclose(fp);
+    CheckAndLogError(failed, UNKNOWN_ERROR, "%s, write %s failed", __func__, fileName);
+
+    return OK;
+}
+
+}  // namespace
+
+bool FrameTimeline::isEnabled() {
+    return Log::isPerfTracesEnabled();
+}
+
+const char* FrameTimeline::getEventName(TimelineEvent event) {
+    if ((event < 0) || (event >= TIMELINE_EVENT_MAX)) {
+        return "unknown";
+    }
+    return kEventNames[event];
+}
+
+void FrameTimeline::record(int cameraId, TimelineEvent event, int64_t sequence,
+                           nsecs_t timestamp, nsecs_t duration, uint8_t arg) {
+    if (!isEnabled()) {
+        return;
+    }
+
+    ThreadRing* ring = tRingHolder.get();
+    if (ring == nullptr) {
+        return;
+    }
+
+    const uint64_t head = ring->head.load(std::memory_order_relaxed);
+    TimelineRecord& r = ring->records[head & kRingMask];
+    r.timestamp = timestamp;
+    r.duration = duration;
+    r.sequence = sequence;
+    r.tid = tRingHolder.tid();
+    r.cameraId = static_cast<int16_t>(cameraId);
+    r.event = static_cast<uint8_t>(event);
+    r.arg = arg;
+    ring->head.store(head + 1U, std::memory_order_release);
+}
+
+void FrameTimeline::mark(int cameraId, TimelineEvent event, int64_t sequence, uint8_t arg) {
+    if (!isEnabled()) {
+        return;
+    }
+    record(cameraId, event, sequence, CameraUtils::systemTime(), 0, arg);
+}
+
+void FrameTimeline::getRecords(int cameraId, std::vector<TimelineRecord>* records) {
+    CheckAndLogError(records == nullptr, VOID_VALUE, "%s, records is nullptr", __func__);
+
+    records->clear();
+    collectRecords(cameraId, 0, records);
+}
+
+int FrameTimeline::dumpChromeTrace(int cameraId, const char* fileName) {
+    CheckAndLogError(fileName == nullptr, BAD_VALUE, "%s, fileName is nullptr", __func__);
+
+    std::vector<TimelineRecord> records;
+    collectRecords(cameraId, 0, &records);
+    return writeChromeTrace(records, fileName);
+}
+
+int FrameTimeline::dumpBinary(int cameraId, const char* fileName) {
+    CheckAndLogError(fileName == nullptr, BAD_VALUE, "%s, fileName is nullptr", __func__);
+
+    std::vector<TimelineRecord> records;
+    collectRecords(cameraId, 0, &records);
+    return writeBinary(records, fileName);
+}
+
+void FrameTimeline::save(int cameraId) {
+    if (!isEnabled() || (cameraId < 0) || (cameraId >= MAX_CAMERA_NUMBER)) {
+        return;
+    }
+
+    std::vector<TimelineRecord> records;
+    {
+        std::lock_guard<std::mutex> l(gRingsLock);
+        const nsecs_t now = CameraUtils::systemTime();
+        collectRecords(cameraId, gSavedTime[cameraId], &records);
+        gSavedTime[cameraId] = now;
+    }
+    if (records.empty()) {
+        return;
+    }
+
+    char fileName[MAX_NAME_LEN] = {'\0'};
+    snprintf(fileName, (MAX_NAME_LEN - 1), "%s/cam%d_frame_timeline.json",
+             CameraDump::getDumpPath(), cameraId);
+    int ret = writeChromeTrace(records, fileName);
+    snprintf(fileName, (MAX_NAME_LEN - 1), "%s/cam%d_frame_timeline.bin",
+             CameraDump::getDumpPath(), cameraId);
+    ret |= writeBinary(records, fileName);
+    LOGI("<id%d> %zu timeline records saved, ret %d", cameraId, records.size(), ret);
+}
+
+ScopedTimeline::ScopedTimeline(int cameraId, TimelineEvent event, int64_t sequence, uint8_t arg)
+        : mCameraId(cameraId),
+          mEvent(event),
+          mSequence(sequence),
+          mArg(arg),
+          mStartTime(0) {
+    if (FrameTimeline::isEnabled()) {
+        mStartTime = CameraUtils::systemTime();
+    }
+}
+
+ScopedTimeline::~ScopedTimeline() {
+    if (mStartTime != 0) {
+        FrameTimeline::record(mCameraId, mEvent, mSequence, mStartTime,
+                              CameraUtils::systemTime() - mStartTime, mArg);
+    }
+}
+
+}  // namespace icamera
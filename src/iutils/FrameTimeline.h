@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "iutils/Utils.h"
+
+namespace icamera {
+
+/**
+ * The pipeline points recorded in the frame timeline.
+ */
+enum TimelineEvent {
+    TIMELINE_QBUF = 0,       // frame number of the request
+    TIMELINE_SOF,            // ISYS sequence
+    TIMELINE_ISYS_DQ,        // ISYS sequence, arg is the CSI2 port
+    TIMELINE_AIQ_RUN,        // applying sequence
+    TIMELINE_PAC_RUN,        // setting sequence, arg is the stream id
+    TIMELINE_PSYS_NODE_DONE, // sequence, arg is the outer node context id
+    TIMELINE_POST_PROCESS,   // sequence
+    TIMELINE_JPEG,           // sequence
+    TIMELINE_DQBUF,          // frame number of the request, arg is the stream id
+    TIMELINE_EVENT_MAX
+};
+
+/**
+ * One point (duration is 0) or span of the timeline, the timestamp is CLOCK_MONOTONIC.
+ */
+struct TimelineRecord {
+    nsecs_t timestamp;
+    nsecs_t duration;
+    int64_t sequence;
+    int32_t tid;
+    int16_t cameraId;
+    uint8_t event;
+    uint8_t arg;
+};
+
+/**
+ * \class FrameTimeline
+ *
+ * Records when each frame goes through the pipeline points listed in TimelineEvent.
+ * It is enabled by the CAMERA_DEBUG_LOG_PERF_TRACES bit of "cameraPerf".
+ *
+ * Each thread writes its records to its own ring without any lock, the oldest ones
+ * are overwritten, so the cost of a record is one clock read and one 32 bytes copy.
+ * The timeline can be read in process by getRecords(), and is saved under the dump
+ * path as Chrome trace JSON (chrome://tracing or ui.perfetto.dev) and compact binary
+ * when the camera device is stopped.
+ */
+class FrameTimeline {
+ public:
+    static bool isEnabled();
+
+    static void record(int cameraId, TimelineEvent event, int64_t sequence, nsecs_t timestamp,
+                       nsecs_t duration, uint8_t arg = 0U);
+    // Record a point at the current time
+    static void mark(int cameraId, TimelineEvent event, int64_t sequence, uint8_t arg = 0U);
+
+    // Get the records of all threads sorted by timestamp, cameraId -1 for all cameras
+    static void getRecords(int cameraId, std::vector<TimelineRecord>* records);
+
+    static int dumpChromeTrace(int cameraId, const char* fileName);
+    /**
+     * Binary layout: "FTL1" magic, uint32_t record size, uint32_t record count,
+     * then the TimelineRecord array in host byte order.
+     */
+    static int dumpBinary(int cameraId, const char* fileName);
+
+    // Save the records since the previous save of this camera under the dump path
+    static void save(int cameraId);
+
+    static const char* getEventName(TimelineEvent event);
+};
+
+/**
+ * \class ScopedTimeline
+ *
+ * Records the span of the scope it lives in.
+ */
+class ScopedTimeline {
+ public:
+    ScopedTimeline(int cameraId, TimelineEvent event, int64_t sequence, uint8_t arg = 0U);
+    ~ScopedTimeline();
+
+ private:
+    int mCameraId;
+    TimelineEvent mEvent;
+    int64_t mSequence;
+    uint8_t mArg;
+    nsecs_t mStartTime;
+};
+
+#define FRAME_TIMELINE_SCOPE(cameraId, event, sequence, ...) \
+    icamera::ScopedTimeline frameTimelineScope((cameraId), (event), (sequence), ##__VA_ARGS__)
+
+}  // namespace icamera
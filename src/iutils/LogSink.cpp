@@ -67,14 +67,19 @@ void LibcameraLogSink::sendOffLog(LogItem logItem) {
 #endif
 void StdconLogSink::sendOffLog(LogItem logItem) {
     char timeInfo[TIME_BUF_SIZE];
-    LogOutputSink::setLogTime(timeInfo);
+    LogOutputSink::setLogTime(timeInfo, logItem.timestamp);
     fprintf(stdout, "[%s] CamHAL[%s] %s: %s\n", timeInfo,
             icamera::cameraDebugLogToString(logItem.level), logItem.logTags, logItem.logEntry);
 }
 
-void LogOutputSink::setLogTime(char* timeBuf) {
+void LogOutputSink::setLogTime(char* timeBuf, int64_t timestamp) {
     struct timeval tv;
-    gettimeofday(&tv, nullptr);
+    if (timestamp > 0) {
+        tv.tv_sec = static_cast<time_t>(timestamp / 1000000);
+        tv.tv_usec = static_cast<suseconds_t>(timestamp % 1000000);
+    } else {
+        gettimeofday(&tv, nullptr);
+    }
     const time_t nowtime = tv.tv_sec;
     struct tm local_tm;
 
@@ -98,7 +103,7 @@ FtraceLogSink::FtraceLogSink() {
 
 void FtraceLogSink::sendOffLog(LogItem logItem) {
     char timeInfo[TIME_BUF_SIZE];
-    setLogTime(timeInfo);
+    setLogTime(timeInfo, logItem.timestamp);
     dprintf(mFtraceFD, "%s CamHAL[%s] %s\n", timeInfo, cameraDebugLogToString(logItem.level),
             logItem.logEntry);
 }
@@ -116,7 +121,7 @@ FileLogSink::FileLogSink() {
 
 void FileLogSink::sendOffLog(LogItem logItem) {
     char timeInfo[TIME_BUF_SIZE];
-    LogOutputSink::setLogTime(timeInfo);
+    LogOutputSink::setLogTime(timeInfo, logItem.timestamp);
     fprintf(mFp, "[%s] CamHAL[%s] %s:%s\n", timeInfo,
             icamera::cameraDebugLogToString(logItem.level), logItem.logTags, logItem.logEntry);
     (void)fflush(mFp);
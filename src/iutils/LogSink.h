@@ -23,6 +23,8 @@ struct LogItem {
     const char* logEntry;
     uint32_t level;
     const char* logTags;
+    // Microseconds since the epoch when the log is made, 0 for the current time
+    int64_t timestamp;
 };
 
 class LogOutputSink {
@@ -30,7 +32,7 @@ class LogOutputSink {
     virtual void sendOffLog(LogItem logItem) = 0;
 
  protected:
-    static void setLogTime(char* timeBuf);
+    static void setLogTime(char* timeBuf, int64_t timestamp = 0);
 };
 
 #ifdef LIBCAMERA_BUILD
@@ -28,6 +28,7 @@ const char* tagNames[] = {
     "AiqSetting",
     "AiqUnit",
     "AiqUtils",
+    "AsyncLogger",
     "BufferAllocator",
     "BufferQueue",
     "CASE_3A_CONTROL",
@@ -81,6 +82,7 @@ const char* tagNames[] = {
     "FaceSSD",
     "FaceStage",
     "FileSource",
+    "FrameTimeline",
     "GPUPostProcessor",
     "GPUPostStage",
     "GenGfx",
@@ -149,6 +151,7 @@ const char* tagNames[] = {
     "ParameterConvert",
     "ParameterHelper",
     "Parameters",
+    "PerfStats",
     "PipeLine",
     "PipeManager",
     "PipeManagerStub",
@@ -164,6 +167,7 @@ const char* tagNames[] = {
     "SWJpegEncoder",
     "SWPostProcessor",
     "SchedPolicy",
+    "SchedThreadPool",
     "Scheduler",
     "SensorHwCtrl",
     "SensorManager",
@@ -35,167 +35,171 @@ enum ModuleTags {
       GENERATED_TAGS_AiqSetting = 6,
       GENERATED_TAGS_AiqUnit = 7,
       GENERATED_TAGS_AiqUtils = 8,
-      GENERATED_TAGS_BufferAllocator = 9,
-      GENERATED_TAGS_BufferQueue = 10,
-      GENERATED_TAGS_CASE_3A_CONTROL = 11,
-      GENERATED_TAGS_CASE_AIQ = 12,
-      GENERATED_TAGS_CASE_API_MULTI_THREAD = 13,
-      GENERATED_TAGS_CASE_BUFFER = 14,
-      GENERATED_TAGS_CASE_COMMON = 15,
-      GENERATED_TAGS_CASE_CPF = 16,
-      GENERATED_TAGS_CASE_DEVICE_OPS = 17,
-      GENERATED_TAGS_CASE_DUAL = 18,
-      GENERATED_TAGS_CASE_GRAPH = 19,
-      GENERATED_TAGS_CASE_IQ_EFFECT = 20,
-      GENERATED_TAGS_CASE_PARAMETER = 21,
-      GENERATED_TAGS_CASE_PER_FRAME = 22,
-      GENERATED_TAGS_CASE_STATIC_INFO = 23,
-      GENERATED_TAGS_CASE_STREAM_OPS = 24,
-      GENERATED_TAGS_CASE_THREAD = 25,
-      GENERATED_TAGS_CASE_VIRTUAL_CHANNEL = 26,
-      GENERATED_TAGS_CBLayoutUtils = 27,
-      GENERATED_TAGS_CBStage = 28,
-      GENERATED_TAGS_Camera3AMetadata = 29,
-      GENERATED_TAGS_Camera3Buffer = 30,
-      GENERATED_TAGS_Camera3Format = 31,
-      GENERATED_TAGS_Camera3HAL = 32,
-      GENERATED_TAGS_Camera3HALModule = 33,
-      GENERATED_TAGS_CameraBuffer = 34,
-      GENERATED_TAGS_CameraBufferPool = 35,
-      GENERATED_TAGS_CameraContext = 36,
-      GENERATED_TAGS_CameraDevice = 37,
-      GENERATED_TAGS_CameraDump = 38,
-      GENERATED_TAGS_CameraEvent = 39,
-      GENERATED_TAGS_CameraHal = 40,
-      GENERATED_TAGS_CameraLog = 41,
-      GENERATED_TAGS_CameraMetadata = 42,
-      GENERATED_TAGS_CameraParserInvoker = 43,
-      GENERATED_TAGS_CameraSensorsParser = 44,
-      GENERATED_TAGS_CameraShm = 45,
-      GENERATED_TAGS_CameraStream = 46,
-      GENERATED_TAGS_CaptureUnit = 47,
-      GENERATED_TAGS_ColorConverter = 48,
-      GENERATED_TAGS_CsiMetaDevice = 49,
-      GENERATED_TAGS_Customized3A = 50,
-      GENERATED_TAGS_CustomizedAic = 51,
-      GENERATED_TAGS_DeviceBase = 52,
-      GENERATED_TAGS_Dvs = 53,
-      GENERATED_TAGS_EXIFMaker = 54,
-      GENERATED_TAGS_EXIFMetaData = 55,
-      GENERATED_TAGS_ExifCreator = 56,
-      GENERATED_TAGS_FaceDetection = 57,
-      GENERATED_TAGS_FaceDetectionPVL = 58,
-      GENERATED_TAGS_FaceSSD = 59,
-      GENERATED_TAGS_FaceStage = 60,
-      GENERATED_TAGS_FileSource = 61,
-      GENERATED_TAGS_GPUPostProcessor = 62,
-      GENERATED_TAGS_GPUPostStage = 63,
-      GENERATED_TAGS_GenGfx = 64,
-      GENERATED_TAGS_GraphConfig = 65,
-      GENERATED_TAGS_GraphConfigManager = 66,
-      GENERATED_TAGS_GraphUtils = 67,
-      GENERATED_TAGS_HAL_FACE_DETECTION_TEST = 68,
-      GENERATED_TAGS_HAL_basic = 69,
-      GENERATED_TAGS_HAL_inset_portrait = 70,
-      GENERATED_TAGS_HAL_jpeg = 71,
-      GENERATED_TAGS_HAL_multi_streams_test = 72,
-      GENERATED_TAGS_HAL_rotation_test = 73,
-      GENERATED_TAGS_HAL_supported_streams_test = 74,
-      GENERATED_TAGS_HAL_yuv = 75,
-      GENERATED_TAGS_HalAdaptor = 76,
-      GENERATED_TAGS_HalV3Utils = 77,
-      GENERATED_TAGS_I3AControlFactory = 78,
-      GENERATED_TAGS_ICBMThread = 79,
-      GENERATED_TAGS_ICamera = 80,
-      GENERATED_TAGS_IFaceDetection = 81,
-      GENERATED_TAGS_IPCIntelCca = 82,
-      GENERATED_TAGS_IPC_FACE_DETECTION = 83,
-      GENERATED_TAGS_IPipeManagerFactory = 84,
-      GENERATED_TAGS_IProcessingUnitFactory = 85,
-      GENERATED_TAGS_ImageProcessorCore = 86,
-      GENERATED_TAGS_ImageScalerCore = 87,
-      GENERATED_TAGS_Intel3AParameter = 88,
-      GENERATED_TAGS_IntelAEStateMachine = 89,
-      GENERATED_TAGS_IntelAFStateMachine = 90,
-      GENERATED_TAGS_IntelAWBStateMachine = 91,
-      GENERATED_TAGS_IntelAlgoClient = 92,
-      GENERATED_TAGS_IntelAlgoCommonClient = 93,
-      GENERATED_TAGS_IntelAlgoServer = 94,
-      GENERATED_TAGS_IntelCPUAlgoServer = 95,
-      GENERATED_TAGS_IntelCca = 96,
-      GENERATED_TAGS_IntelCcaClient = 97,
-      GENERATED_TAGS_IntelCcaServer = 98,
-      GENERATED_TAGS_IntelFDServer = 99,
-      GENERATED_TAGS_IntelFaceDetection = 100,
-      GENERATED_TAGS_IntelFaceDetectionClient = 101,
-      GENERATED_TAGS_IntelGPUAlgoServer = 102,
-      GENERATED_TAGS_IntelICBM = 103,
-      GENERATED_TAGS_IntelICBMClient = 104,
-      GENERATED_TAGS_IntelICBMServer = 105,
-      GENERATED_TAGS_IntelTNR7Stage = 106,
-      GENERATED_TAGS_IpuPacAdaptor = 107,
-      GENERATED_TAGS_JpegEncoderCore = 108,
-      GENERATED_TAGS_JpegMaker = 109,
-      GENERATED_TAGS_JsonCommonParser = 110,
-      GENERATED_TAGS_JsonParserBase = 111,
-      GENERATED_TAGS_LensHw = 112,
-      GENERATED_TAGS_LensManager = 113,
-      GENERATED_TAGS_LiveTuning = 114,
-      GENERATED_TAGS_MANUAL_POST_PROCESSING = 115,
-      GENERATED_TAGS_MakerNote = 116,
-      GENERATED_TAGS_MediaControl = 117,
-      GENERATED_TAGS_MetadataConvert = 118,
-      GENERATED_TAGS_MockCamera3HAL = 119,
-      GENERATED_TAGS_MockCameraHal = 120,
-      GENERATED_TAGS_MockPSysDevice = 121,
-      GENERATED_TAGS_MockSysCall = 122,
-      GENERATED_TAGS_MsgHandler = 123,
-      GENERATED_TAGS_OnePunchIC2 = 124,
-      GENERATED_TAGS_OpenSourceGFX = 125,
-      GENERATED_TAGS_PSysDevice = 126,
-      GENERATED_TAGS_ParameterConvert = 127,
-      GENERATED_TAGS_ParameterHelper = 128,
-      GENERATED_TAGS_Parameters = 129,
-      GENERATED_TAGS_PipeLine = 130,
-      GENERATED_TAGS_PipeManager = 131,
-      GENERATED_TAGS_PipeManagerStub = 132,
-      GENERATED_TAGS_PlatformData = 133,
-      GENERATED_TAGS_PnpDebugControl = 134,
-      GENERATED_TAGS_PostProcessStage = 135,
-      GENERATED_TAGS_PostProcessorBase = 136,
-      GENERATED_TAGS_PostProcessorCore = 137,
-      GENERATED_TAGS_ProcessingUnit = 138,
-      GENERATED_TAGS_RequestManager = 139,
-      GENERATED_TAGS_RequestThread = 140,
-      GENERATED_TAGS_ResultProcessor = 141,
-      GENERATED_TAGS_SWJpegEncoder = 142,
-      GENERATED_TAGS_SWPostProcessor = 143,
-      GENERATED_TAGS_SchedPolicy = 144,
-      GENERATED_TAGS_Scheduler = 145,
-      GENERATED_TAGS_SensorHwCtrl = 146,
-      GENERATED_TAGS_SensorManager = 147,
-      GENERATED_TAGS_SofSource = 148,
-      GENERATED_TAGS_SwImageConverter = 149,
-      GENERATED_TAGS_SwImageProcessor = 150,
-      GENERATED_TAGS_SwPostProcessUnit = 151,
-      GENERATED_TAGS_SysCall = 152,
-      GENERATED_TAGS_TCPServer = 153,
-      GENERATED_TAGS_Thread = 154,
-      GENERATED_TAGS_Trace = 155,
-      GENERATED_TAGS_Utils = 156,
-      GENERATED_TAGS_V4l2DeviceFactory = 157,
-      GENERATED_TAGS_V4l2_device_cc = 158,
-      GENERATED_TAGS_V4l2_subdevice_cc = 159,
-      GENERATED_TAGS_V4l2_video_node_cc = 160,
-      GENERATED_TAGS_VendorTags = 161,
-      GENERATED_TAGS_camera_metadata_tests = 162,
-      GENERATED_TAGS_icamera_metadata_base = 163,
-      GENERATED_TAGS_metadata_test = 164,
-      ST_FPS = 165,
-      ST_GPU_TNR = 166,
-      ST_STATS = 167,
+      GENERATED_TAGS_AsyncLogger = 9,
+      GENERATED_TAGS_BufferAllocator = 10,
+      GENERATED_TAGS_BufferQueue = 11,
+      GENERATED_TAGS_CASE_3A_CONTROL = 12,
+      GENERATED_TAGS_CASE_AIQ = 13,
+      GENERATED_TAGS_CASE_API_MULTI_THREAD = 14,
+      GENERATED_TAGS_CASE_BUFFER = 15,
+      GENERATED_TAGS_CASE_COMMON = 16,
+      GENERATED_TAGS_CASE_CPF = 17,
+      GENERATED_TAGS_CASE_DEVICE_OPS = 18,
+      GENERATED_TAGS_CASE_DUAL = 19,
+      GENERATED_TAGS_CASE_GRAPH = 20,
+      GENERATED_TAGS_CASE_IQ_EFFECT = 21,
+      GENERATED_TAGS_CASE_PARAMETER = 22,
+      GENERATED_TAGS_CASE_PER_FRAME = 23,
+      GENERATED_TAGS_CASE_STATIC_INFO = 24,
+      GENERATED_TAGS_CASE_STREAM_OPS = 25,
+      GENERATED_TAGS_CASE_THREAD = 26,
+      GENERATED_TAGS_CASE_VIRTUAL_CHANNEL = 27,
+      GENERATED_TAGS_CBLayoutUtils = 28,
+      GENERATED_TAGS_CBStage = 29,
+      GENERATED_TAGS_Camera3AMetadata = 30,
+      GENERATED_TAGS_Camera3Buffer = 31,
+      GENERATED_TAGS_Camera3Format = 32,
+      GENERATED_TAGS_Camera3HAL = 33,
+      GENERATED_TAGS_Camera3HALModule = 34,
+      GENERATED_TAGS_CameraBuffer = 35,
+      GENERATED_TAGS_CameraBufferPool = 36,
+      GENERATED_TAGS_CameraContext = 37,
+      GENERATED_TAGS_CameraDevice = 38,
+      GENERATED_TAGS_CameraDump = 39,
+      GENERATED_TAGS_CameraEvent = 40,
+      GENERATED_TAGS_CameraHal = 41,
+      GENERATED_TAGS_CameraLog = 42,
+      GENERATED_TAGS_CameraMetadata = 43,
+      GENERATED_TAGS_CameraParserInvoker = 44,
+      GENERATED_TAGS_CameraSensorsParser = 45,
+      GENERATED_TAGS_CameraShm = 46,
+      GENERATED_TAGS_CameraStream = 47,
+      GENERATED_TAGS_CaptureUnit = 48,
+      GENERATED_TAGS_ColorConverter = 49,
+      GENERATED_TAGS_CsiMetaDevice = 50,
+      GENERATED_TAGS_Customized3A = 51,
+      GENERATED_TAGS_CustomizedAic = 52,
+      GENERATED_TAGS_DeviceBase = 53,
+      GENERATED_TAGS_Dvs = 54,
+      GENERATED_TAGS_EXIFMaker = 55,
+      GENERATED_TAGS_EXIFMetaData = 56,
+      GENERATED_TAGS_ExifCreator = 57,
+      GENERATED_TAGS_FaceDetection = 58,
+      GENERATED_TAGS_FaceDetectionPVL = 59,
+      GENERATED_TAGS_FaceSSD = 60,
+      GENERATED_TAGS_FaceStage = 61,
+      GENERATED_TAGS_FileSource = 62,
+      GENERATED_TAGS_FrameTimeline = 63,
+      GENERATED_TAGS_GPUPostProcessor = 64,
+      GENERATED_TAGS_GPUPostStage = 65,
+      GENERATED_TAGS_GenGfx = 66,
+      GENERATED_TAGS_GraphConfig = 67,
+      GENERATED_TAGS_GraphConfigManager = 68,
+      GENERATED_TAGS_GraphUtils = 69,
+      GENERATED_TAGS_HAL_FACE_DETECTION_TEST = 70,
+      GENERATED_TAGS_HAL_basic = 71,
+      GENERATED_TAGS_HAL_inset_portrait = 72,
+      GENERATED_TAGS_HAL_jpeg = 73,
+      GENERATED_TAGS_HAL_multi_streams_test = 74,
+      GENERATED_TAGS_HAL_rotation_test = 75,
+      GENERATED_TAGS_HAL_supported_streams_test = 76,
+      GENERATED_TAGS_HAL_yuv = 77,
+      GENERATED_TAGS_HalAdaptor = 78,
+      GENERATED_TAGS_HalV3Utils = 79,
+      GENERATED_TAGS_I3AControlFactory = 80,
+      GENERATED_TAGS_ICBMThread = 81,
+      GENERATED_TAGS_ICamera = 82,
+      GENERATED_TAGS_IFaceDetection = 83,
+      GENERATED_TAGS_IPCIntelCca = 84,
+      GENERATED_TAGS_IPC_FACE_DETECTION = 85,
+      GENERATED_TAGS_IPipeManagerFactory = 86,
+      GENERATED_TAGS_IProcessingUnitFactory = 87,
+      GENERATED_TAGS_ImageProcessorCore = 88,
+      GENERATED_TAGS_ImageScalerCore = 89,
+      GENERATED_TAGS_Intel3AParameter = 90,
+      GENERATED_TAGS_IntelAEStateMachine = 91,
+      GENERATED_TAGS_IntelAFStateMachine = 92,
+      GENERATED_TAGS_IntelAWBStateMachine = 93,
+      GENERATED_TAGS_IntelAlgoClient = 94,
+      GENERATED_TAGS_IntelAlgoCommonClient = 95,
+      GENERATED_TAGS_IntelAlgoServer = 96,
+      GENERATED_TAGS_IntelCPUAlgoServer = 97,
+      GENERATED_TAGS_IntelCca = 98,
+      GENERATED_TAGS_IntelCcaClient = 99,
+      GENERATED_TAGS_IntelCcaServer = 100,
+      GENERATED_TAGS_IntelFDServer = 101,
+      GENERATED_TAGS_IntelFaceDetection = 102,
+      GENERATED_TAGS_IntelFaceDetectionClient = 103,
+      GENERATED_TAGS_IntelGPUAlgoServer = 104,
+      GENERATED_TAGS_IntelICBM = 105,
+      GENERATED_TAGS_IntelICBMClient = 106,
+      GENERATED_TAGS_IntelICBMServer = 107,
+      GENERATED_TAGS_IntelTNR7Stage = 108,
+      GENERATED_TAGS_IpuPacAdaptor = 109,
+      GENERATED_TAGS_JpegEncoderCore = 110,
+      GENERATED_TAGS_JpegMaker = 111,
+      GENERATED_TAGS_JsonCommonParser = 112,
+      GENERATED_TAGS_JsonParserBase = 113,
+      GENERATED_TAGS_LensHw = 114,
+      GENERATED_TAGS_LensManager = 115,
+      GENERATED_TAGS_LiveTuning = 116,
+      GENERATED_TAGS_MANUAL_POST_PROCESSING = 117,
+      GENERATED_TAGS_MakerNote = 118,
+      GENERATED_TAGS_MediaControl = 119,
+      GENERATED_TAGS_MetadataConvert = 120,
+      GENERATED_TAGS_MockCamera3HAL = 121,
+      GENERATED_TAGS_MockCameraHal = 122,
+      GENERATED_TAGS_MockPSysDevice = 123,
+      GENERATED_TAGS_MockSysCall = 124,
+      GENERATED_TAGS_MsgHandler = 125,
+      GENERATED_TAGS_OnePunchIC2 = 126,
+      GENERATED_TAGS_OpenSourceGFX = 127,
+      GENERATED_TAGS_PSysDevice = 128,
+      GENERATED_TAGS_ParameterConvert = 129,
+      GENERATED_TAGS_ParameterHelper = 130,
+      GENERATED_TAGS_Parameters = 131,
+      GENERATED_TAGS_PerfStats = 132,
+      GENERATED_TAGS_PipeLine = 133,
+      GENERATED_TAGS_PipeManager = 134,
+      GENERATED_TAGS_PipeManagerStub = 135,
+      GENERATED_TAGS_PlatformData = 136,
+      GENERATED_TAGS_PnpDebugControl = 137,
+      GENERATED_TAGS_PostProcessStage = 138,
+      GENERATED_TAGS_PostProcessorBase = 139,
+      GENERATED_TAGS_PostProcessorCore = 140,
+      GENERATED_TAGS_ProcessingUnit = 141,
+      GENERATED_TAGS_RequestManager = 142,
+      GENERATED_TAGS_RequestThread = 143,
+      GENERATED_TAGS_ResultProcessor = 144,
+      GENERATED_TAGS_SWJpegEncoder = 145,
+      GENERATED_TAGS_SWPostProcessor = 146,
+      GENERATED_TAGS_SchedPolicy = 147,
+      GENERATED_TAGS_SchedThreadPool = 148,
+      GENERATED_TAGS_Scheduler = 149,
+      GENERATED_TAGS_SensorHwCtrl = 150,
+      GENERATED_TAGS_SensorManager = 151,
+      GENERATED_TAGS_SofSource = 152,
+      GENERATED_TAGS_SwImageConverter = 153,
+      GENERATED_TAGS_SwImageProcessor = 154,
+      GENERATED_TAGS_SwPostProcessUnit = 155,
+      GENERATED_TAGS_SysCall = 156,
+      GENERATED_TAGS_TCPServer = 157,
+      GENERATED_TAGS_Thread = 158,
+      GENERATED_TAGS_Trace = 159,
+      GENERATED_TAGS_Utils = 160,
+      GENERATED_TAGS_V4l2DeviceFactory = 161,
+      GENERATED_TAGS_V4l2_device_cc = 162,
+      GENERATED_TAGS_V4l2_subdevice_cc = 163,
+      GENERATED_TAGS_V4l2_video_node_cc = 164,
+      GENERATED_TAGS_VendorTags = 165,
+      GENERATED_TAGS_camera_metadata_tests = 166,
+      GENERATED_TAGS_icamera_metadata_base = 167,
+      GENERATED_TAGS_metadata_test = 168,
+      ST_FPS = 169,
+      ST_GPU_TNR = 170,
+      ST_STATS = 171,
 };
 
-#define TAGS_MAX_NUM 168
+#define TAGS_MAX_NUM 172
 
 // !!! DO NOT EDIT THIS FILE !!!
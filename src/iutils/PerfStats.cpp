@@ -0,0 +1,230 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG PerfStats
+
+#include "iutils/PerfStats.h"
+
+#include <inttypes.h>
+#include <time.h>
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "PlatformData.h"
+#include "iutils/CameraLog.h"
+#include "iutils/Utils.h"
+
+namespace icamera {
+
+namespace {
+
+// Keep the latest samples only, enough for p99 of a few seconds streaming
+const size_t kMaxSamples = 1024U;
+// Requests which are never dequeued (e.g. flushed) are dropped after this
+const uint32_t kMaxPendingRequests = 64U;
+
+const char* kStageNames[PERF_STAGE_MAX] = {
+    "CaptureUnit", "ProcessingUnit", "PipeManager", "PostProcessStage", "JPEG",
+};
+
+class SampleRing {
+ public:
+    SampleRing() : mNext(0U), mCount(0U), mSum(0) {}
+
+    void add(nsecs_t value) {
+        if (mSamples.size() < kMaxSamples) {
+            mSamples.push_back(value);
+        } else {
+            mSamples[mNext] = value;
+        }
+        mNext = (mNext + 1U) % kMaxSamples;
+        mCount++;
+        mSum += value;
+    }
+
+    nsecs_t percentile(uint32_t percent) const {
+        if (mSamples.empty()) {
+            return 0;
+        }
+        std::vector<nsecs_t> sorted = mSamples;
+        const size_t index = std::min(sorted.size() - 1U, sorted.size() * percent / 100U);
+        std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+        return sorted[index];
+    }
+
+    nsecs_t average() const { return (mCount != 0U) ? (mSum / static_cast<nsecs_t>(mCount)) : 0; }
+    uint64_t count() const { return mCount; }
+
+    void clear() {
+        mSamples.clear();
+        mNext = 0U;
+        mCount = 0U;
+        mSum = 0;
+    }
+
+ private:
+    std::vector<nsecs_t> mSamples;
+    size_t mNext;
+    uint64_t mCount;
+    nsecs_t mSum;
+};
+
+struct CameraPerfData {
+    std::mutex lock;
+    // <frame number, qbuf timestamp>
+    std::map<uint32_t, nsecs_t> pendingRequests;
+    SampleRing requestLatency;
+    SampleRing stageWallTime[PERF_STAGE_MAX];
+    SampleRing stageCpuTime[PERF_STAGE_MAX];
+    nsecs_t firstResultTime = 0;
+    nsecs_t lastResultTime = 0;
+    uint64_t resultFrames = 0U;
+    int64_t lastFrameNumber = -1;
+};
+
+CameraPerfData gPerfData[MAX_CAMERA_NUMBER];
+
+CameraPerfData* getPerfData(int cameraId) {
+    if ((cameraId < 0) || (cameraId >= MAX_CAMERA_NUMBER)) {
+        return nullptr;
+    }
+    return &gPerfData[cameraId];
+}
+
+}  // namespace
+
+bool PerfStats::isEnabled() {
+    return Log::isPerfBreakdownEnabled();
+}
+
+nsecs_t PerfStats::threadCpuTime() {
+    struct timespec t = {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return nsecs_t(t.tv_sec) * 1000000000LL + t.tv_nsec;
+}
+
+void PerfStats::onRequestQueued(int cameraId, uint32_t frameNumber) {
+    CameraPerfData* data = getPerfData(cameraId);
+    if (!isEnabled() || (data == nullptr)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> l(data->lock);
+    data->pendingRequests[frameNumber] = CameraUtils::systemTime();
+    while (data->pendingRequests.size() > kMaxPendingRequests) {
+        data->pendingRequests.erase(data->pendingRequests.begin());
+    }
+}
+
+void PerfStats::onResultDequeued(int cameraId, uint32_t frameNumber) {
+    CameraPerfData* data = getPerfData(cameraId);
+    if (!isEnabled() || (data == nullptr)) {
+        return;
+    }
+
+    const nsecs_t now = CameraUtils::systemTime();
+    std::lock_guard<std::mutex> l(data->lock);
+    // All streams of one request share the frame number, count each of them
+    const auto it = data->pendingRequests.find(frameNumber);
+    if (it != data->pendingRequests.end()) {
+        data->requestLatency.add(now - it->second);
+    }
+
+    if (static_cast<int64_t>(frameNumber) > data->lastFrameNumber) {
+        if (data->resultFrames == 0U) {
+            data->firstResultTime = now;
+        }
+        data->lastResultTime = now;
+        data->resultFrames++;
+        data->lastFrameNumber = frameNumber;
+    }
+}
+
+void PerfStats::addStageSample(int cameraId, PerfStage stage, nsecs_t wallTime,
+                               nsecs_t cpuTime) {
+    CameraPerfData* data = getPerfData(cameraId);
+    if ((data == nullptr) || (stage >= PERF_STAGE_MAX)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> l(data->lock);
+    data->stageWallTime[stage].add(wallTime);
+    data->stageCpuTime[stage].add(cpuTime);
+}
+
+void PerfStats::report(int cameraId) {
+    CameraPerfData* data = getPerfData(cameraId);
+    if (!isEnabled() || (data == nullptr)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> l(data->lock);
+    float fps = 0.0F;
+    if ((data->resultFrames > 1U) && (data->lastResultTime > data->firstResultTime)) {
+        fps = static_cast<float>(data->resultFrames - 1U) * 1000000000.0F /
+              static_cast<float>(data->lastResultTime - data->firstResultTime);
+    }
+
+    LOGI("<id%d> %" PRIu64 " frames, %.2f fps, request latency p50 %.3f ms, p99 %.3f ms", cameraId,
+         data->resultFrames, fps, data->requestLatency.percentile(50U) / 1000000.0F,
+         data->requestLatency.percentile(99U) / 1000000.0F);
+
+    for (int i = 0; i < PERF_STAGE_MAX; i++) {
+        const SampleRing& wall = data->stageWallTime[i];
+        if (wall.count() == 0U) {
+            continue;
+        }
+        LOGI("<id%d> %-16s runs %" PRIu64 ", wall p50 %.3f ms, p99 %.3f ms, cpu avg %.3f ms", cameraId,
+             kStageNames[i], wall.count(), wall.percentile(50U) / 1000000.0F,
+             wall.percentile(99U) / 1000000.0F,
+             data->stageCpuTime[i].average() / 1000000.0F);
+    }
+
+    data->pendingRequests.clear();
+    data->requestLatency.clear();
+    for (int i = 0; i < PERF_STAGE_MAX; i++) {
+        data->stageWallTime[i].clear();
+        data->stageCpuTime[i].clear();
+    }
+    data->firstResultTime = 0;
+    data->lastResultTime = 0;
+    data->resultFrames = 0U;
+    data->lastFrameNumber = -1;
+}
+
+ScopedPerfStats::ScopedPerfStats(int cameraId, PerfStage stage)
+        : mCameraId(cameraId),
+          mStage(stage),
+          mEnabled(PerfStats::isEnabled()),
+          mStartTime(0),
+          mStartCpuTime(0) {
+    if (mEnabled) {
+        mStartTime = CameraUtils::systemTime();
+        mStartCpuTime = PerfStats::threadCpuTime();
+    }
+}
+
+ScopedPerfStats::~ScopedPerfStats() {
+    if (mEnabled) {
+        PerfStats::addStageSample(mCameraId, mStage, CameraUtils::systemTime() - mStartTime,
+                                  PerfStats::threadCpuTime() - mStartCpuTime);
+    }
+}
+
+}  // namespace icamera
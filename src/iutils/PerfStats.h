@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "iutils/Utils.h"
+
+namespace icamera {
+
+/**
+ * The pipeline stages whose cost is collected by PerfStats.
+ */
+enum PerfStage {
+    PERF_STAGE_CAPTURE_UNIT = 0,
+    PERF_STAGE_PROCESSING_UNIT,
+    PERF_STAGE_PIPE_MANAGER,
+    PERF_STAGE_POST_PROCESS,
+    PERF_STAGE_JPEG,
+    PERF_STAGE_MAX
+};
+
+/**
+ * \class PerfStats
+ *
+ * Collects the per-frame performance KPIs of one camera: latency from qbuf to
+ * dqbuf of each request, output frame rate, and wall/CPU time spent in each
+ * pipeline stage. It is enabled by the CAMERA_DEBUG_LOG_PERF_TRACES_BREAKDOWN
+ * bit of "cameraPerf", and is meant to be used together with the PnP mock
+ * paths (mock AAL/PSys and file injection) to benchmark the HAL without IPU.
+ *
+ * The statistics are printed and reset when the camera device is stopped.
+ */
+class PerfStats {
+ public:
+    static bool isEnabled();
+
+    // Called by the HAL API when a request is queued and its buffer is dequeued.
+    static void onRequestQueued(int cameraId, uint32_t frameNumber);
+    static void onResultDequeued(int cameraId, uint32_t frameNumber);
+
+    static void addStageSample(int cameraId, PerfStage stage, nsecs_t wallTime, nsecs_t cpuTime);
+
+    // Print the collected statistics and start a new collection period
+    static void report(int cameraId);
+
+    // Returns the CPU time consumed by the calling thread
+    static nsecs_t threadCpuTime();
+};
+
+/**
+ * \class ScopedPerfStats
+ *
+ * Measures the wall and thread CPU time of the scope it lives in and adds
+ * them to the given stage.
+ */
+class ScopedPerfStats {
+ public:
+    ScopedPerfStats(int cameraId, PerfStage stage);
+    ~ScopedPerfStats();
+
+ private:
+    int mCameraId;
+    PerfStage mStage;
+    bool mEnabled;
+    nsecs_t mStartTime;
+    nsecs_t mStartCpuTime;
+};
+
+#define PERF_STAGE_STATS(cameraId, stage) \
+    icamera::ScopedPerfStats perfStageStats((cameraId), (stage))
+
+}  // namespace icamera
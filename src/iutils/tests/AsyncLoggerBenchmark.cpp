@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times a LOG2 call with the arguments of a typical processing log on 1 and
+// 4 threads, written synchronously to a FileLogSink and then queued to
+// AsyncLogger. Prints the latency percentiles of one call. The logs go to
+// FILE_LOG_PATH, /dev/null by default.
+//
+// Usage: AsyncLoggerBenchmark [logs per thread]
+
+#define LOG_TAG CameraLog
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "iutils/AsyncLogger.h"
+#include "iutils/CameraLog.h"
+#include "iutils/LogSink.h"
+
+using icamera::AsyncLogger;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+void run(int threadNum, int logs) {
+    std::vector<std::vector<double>> latencies(threadNum);
+    std::vector<std::thread> threads;
+    const uint64_t droppedBefore = AsyncLogger::getDroppedCount();
+
+    for (int t = 0; t < threadNum; t++) {
+        threads.emplace_back([t, logs, &latencies]() {
+            const std::string name = "ProcessingUnit-" + std::to_string(t);
+            std::vector<double>& latency = latencies[t];
+            latency.reserve(logs);
+            for (int i = 0; i < logs; i++) {
+                const Clock::time_point start = Clock::now();
+                LOG2("<id%d:seq%ld>@%s, stream %s, buffer %p, size %dx%d, ratio %.3f", t,
+                     static_cast<long>(i), __func__, name.c_str(), &latency, 1920, 1080, i * 0.5);
+                latency.push_back(
+                    std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+                // Leave the drain thread some time, as the frame loops do
+                if ((i & 63) == 0) std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    AsyncLogger::flush();
+
+    std::vector<double> all;
+    for (const auto& latency : latencies) all.insert(all.end(), latency.begin(), latency.end());
+    std::sort(all.begin(), all.end());
+    auto percentile = [&all](double p) { return all[static_cast<size_t>(p * (all.size() - 1))]; };
+    printf("%-5s %d thread(s): p50 %6.2f us, p99 %6.2f us, p99.9 %7.2f us, max %8.2f us, "
+           "dropped %lu\n",
+           AsyncLogger::isEnabled() ? "async" : "sync", threadNum, percentile(0.5),
+           percentile(0.99), percentile(0.999), all.back(),
+           static_cast<unsigned long>(AsyncLogger::getDroppedCount() - droppedBefore));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int logs = (argc > 1) ? atoi(argv[1]) : 20000;
+    if (logs <= 0) {
+        fprintf(stderr, "Usage: %s [logs per thread]\n", argv[0]);
+        return 1;
+    }
+
+    setenv("cameraDebug", "0x77", 1);
+    setenv("FILE_LOG_PATH", "/dev/null", 0);
+    icamera::Log::setDebugLevel();
+    icamera::LogOutputSink* stdconSink = globalLogSink;
+    icamera::FileLogSink fileSink;
+    globalLogSink = &fileSink;
+
+    run(1, logs);
+    run(4, logs);
+    AsyncLogger::start();
+    run(1, logs);
+    run(4, logs);
+    AsyncLogger::stop();
+
+    globalLogSink = stdconSink;
+    return 0;
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks the logs queued by AsyncLogger against the synchronous path: the
+// deferred formatting gives the same text as vsnprintf(), the logs of each
+// thread keep their order, an error sends the queued logs before itself and
+// every log of a full ring is either sent or counted as dropped.
+
+#define LOG_TAG CameraLog
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "iutils/AsyncLogger.h"
+#include "iutils/CameraLog.h"
+
+using icamera::AsyncLogger;
+using icamera::LogItem;
+using icamera::LogOutputSink;
+
+namespace {
+
+int gFailures = 0;
+
+void expect(bool cond, const char* what) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+// Keeps the logs it gets, and can hold the drain thread to fill the rings
+class CaptureLogSink : public LogOutputSink {
+ public:
+    CaptureLogSink() : mBlocked(false) {}
+
+    void sendOffLog(LogItem logItem) override {
+        std::unique_lock<std::mutex> l(mLock);
+        mCondition.wait(l, [this]() { return !mBlocked; });
+        mLogs.push_back({logItem.logEntry, logItem.level});
+    }
+
+    void setBlocked(bool blocked) {
+        {
+            std::lock_guard<std::mutex> l(mLock);
+            mBlocked = blocked;
+        }
+        mCondition.notify_all();
+    }
+
+    std::vector<std::pair<std::string, uint32_t>> takeLogs() {
+        std::lock_guard<std::mutex> l(mLock);
+        std::vector<std::pair<std::string, uint32_t>> logs;
+        logs.swap(mLogs);
+        return logs;
+    }
+
+ private:
+    std::mutex mLock;
+    std::condition_variable mCondition;
+    bool mBlocked;
+    std::vector<std::pair<std::string, uint32_t>> mLogs;
+};
+
+CaptureLogSink* gSink = nullptr;
+std::vector<std::string> gExpected;
+
+// The text the synchronous path writes, see doLogBody()
+void format(const char* fmt, ...) {
+    char message[256];
+    va_list ap;
+    va_start(ap, fmt);
+    vsnprintf(message, sizeof(message), fmt, ap);
+    va_end(ap);
+    gExpected.push_back(message);
+}
+
+#define CHECK_FORMAT(...)     \
+    do {                      \
+        format(__VA_ARGS__);  \
+        LOG2(__VA_ARGS__);    \
+    } while (0)
+
+void testFormats() {
+    const char unterminated[4] = {'a', 'b', 'c', 'd'};
+    const std::string longString(400, 'x');
+
+    gExpected.clear();
+    CHECK_FORMAT("plain");
+    CHECK_FORMAT("100%% done %d%%", 5);
+    CHECK_FORMAT("%5d|%-5d|%05d|%+d", 1, 2, 3, 4);
+    CHECK_FORMAT("%hhu %hd %ld %lld %llu %zu %zd %jd %td", 300, 70000, -5L, -6LL, 7ULL,
+                 static_cast<size_t>(8), static_cast<ssize_t>(-9), static_cast<intmax_t>(10),
+                 static_cast<ptrdiff_t>(-11));
+    CHECK_FORMAT("%x %X %#x %o %c", 255, 255, 255, 8, 'Z');
+    CHECK_FORMAT("%f %.2f %e %g %10.3f %a", 1.5, 2.345, 1e10, 0.0001, 3.14159, 1.0);
+    CHECK_FORMAT("%s|%10s|%-10s|%.2s|%.*s|%*d|%*.*f", "abc", "r", "l", "xyz", 4, unterminated,
+                 6, 42, 8, 2, 1.23456);
+    CHECK_FORMAT("%p", reinterpret_cast<void*>(0x1234));
+    CHECK_FORMAT("%s %s", longString.c_str(), longString.c_str());
+    // Formatted on the caller and queued as text
+    CHECK_FORMAT("%Lf", static_cast<long double>(2.5));
+    CHECK_FORMAT("%2$d %1$d", 1, 2);
+    AsyncLogger::flush();
+
+    const auto logs = gSink->takeLogs();
+    expect(logs.size() == gExpected.size(), "every format is sent");
+    for (size_t i = 0; i < logs.size() && i < gExpected.size(); i++) {
+        if (logs[i].first != gExpected[i]) {
+            fprintf(stderr, "FAIL: \"%s\" is sent as \"%s\"\n", gExpected[i].c_str(),
+                    logs[i].first.c_str());
+            gFailures++;
+        }
+    }
+}
+
+void testErrorAfterQueuedLogs() {
+    for (int i = 0; i < 5; i++) {
+        LOG2("queued %d", i);
+    }
+    LOGE("error after the queued logs");
+
+    // The error is written before LOGE returns, with the queued logs before it
+    const auto logs = gSink->takeLogs();
+    expect(logs.size() == 6U, "the queued logs and the error are sent");
+    for (size_t i = 0; i < logs.size() && i < 5U; i++) {
+        expect(logs[i].first == "queued " + std::to_string(i), "the queued logs keep their order");
+    }
+    expect(logs.size() == 6U && logs[5].second == icamera::CAMERA_DEBUG_LOG_ERR,
+           "the error is the last log");
+}
+
+void testThreadsKeepOrder() {
+    const int kThreads = 4;
+    const int kLogs = 2000;
+    const uint64_t droppedBefore = AsyncLogger::getDroppedCount();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < kLogs; i++) {
+                LOG2("thread %d log %d", t, i);
+                if ((i & 63) == 0) std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    AsyncLogger::flush();
+
+    int next[kThreads] = {};
+    uint64_t sent = 0U;
+    for (const auto& log : gSink->takeLogs()) {
+        int t = 0;
+        int i = 0;
+        if (sscanf(log.first.c_str(), "thread %d log %d", &t, &i) != 2) continue;
+        expect(t >= 0 && t < kThreads && i >= next[t], "the logs of a thread keep their order");
+        if (t >= 0 && t < kThreads) next[t] = i + 1;
+        sent++;
+    }
+    const uint64_t dropped = AsyncLogger::getDroppedCount() - droppedBefore;
+    expect(sent + dropped == static_cast<uint64_t>(kThreads * kLogs),
+           "each log is sent or dropped");
+}
+
+void testFullRingDropsAndReports() {
+    const int kLogs = 10000;
+    const uint64_t droppedBefore = AsyncLogger::getDroppedCount();
+
+    // The drain thread waits in the sink from the first log on
+    gSink->setBlocked(true);
+    for (int i = 0; i < kLogs; i++) {
+        LOG2("filling the ring with log %d", i);
+    }
+    gSink->setBlocked(false);
+    AsyncLogger::flush();
+    // The drops are reported with the next logs of the thread
+    LOG2("after the drops");
+    AsyncLogger::flush();
+
+    uint64_t sent = 0U;
+    bool reported = false;
+    for (const auto& log : gSink->takeLogs()) {
+        if (log.first.compare(0, 22, "filling the ring with ") == 0) sent++;
+        if (log.first.find("are dropped") != std::string::npos) reported = true;
+    }
+    const uint64_t dropped = AsyncLogger::getDroppedCount() - droppedBefore;
+    expect(dropped > 0U, "a full ring drops logs");
+    expect(sent + dropped == static_cast<uint64_t>(kLogs), "each log is sent or dropped");
+    expect(reported, "the drops are reported");
+}
+
+}  // namespace
+
+int main() {
+    setenv("cameraDebug", "0x77", 1);
+    icamera::Log::setDebugLevel();
+    AsyncLogger::start();
+    expect(AsyncLogger::isEnabled(), "async log is enabled");
+    // Keep the logs of the start out of the checks
+    AsyncLogger::flush();
+    LogOutputSink* stdconSink = globalLogSink;
+    CaptureLogSink sink;
+    gSink = &sink;
+    globalLogSink = gSink;
+
+    testFormats();
+    testErrorAfterQueuedLogs();
+    testThreadsKeepOrder();
+    testFullRingDropsAndReports();
+    AsyncLogger::stop();
+    globalLogSink = stdconSink;
+
+    if (gFailures == 0) {
+        printf("AsyncLoggerTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
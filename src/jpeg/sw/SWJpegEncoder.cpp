@@ -18,6 +18,9 @@
 
 #include "SWJpegEncoder.h"
 
+#include <unistd.h>
+
+#include <algorithm>
 #include <string>
 
 #include "ImageConverter.h"
@@ -26,20 +29,27 @@
 
 #define RESOLUTION_1_3MP_WIDTH 1280
 #define RESOLUTION_1_3MP_HEIGHT 960
+#define NV12_MCU_SIZE 16
 
 namespace icamera {
 
-SWJpegEncoder::SWJpegEncoder()
+SWJpegEncoder::SWJpegEncoder(unsigned int threadNum)
         : mJpegSize(-1),
           mTotalWidth(0),
           mTotalHeight(0),
           mDstBuf(nullptr),
-          mCPUCoresNum(1) {
-    LOG2("@%s, line:%d", __func__, __LINE__);
+          mCPUCoresNum(1),
+          mSliceNum(0) {
+    long cores = (threadNum > 0) ? threadNum : sysconf(_SC_NPROCESSORS_ONLN);
+    if (cores > 0) {
+        mCPUCoresNum = static_cast<unsigned int>(cores);
+    }
+    LOG2("@%s, line:%d, cpu cores:%u", __func__, __LINE__, mCPUCoresNum);
 }
 
 SWJpegEncoder::~SWJpegEncoder() {
     LOG2("@%s, line:%d", __func__, __LINE__);
+    deInit();
 }
 
 std::unique_ptr<IJpegEncoder> IJpegEncoder::createJpegEncoder() {
@@ -193,22 +203,28 @@ int SWJpegEncoder::swEncodeMultiThread(const EncodePackage& package) {
 
 exit:
     mJpegSize = status ? -1 : mergeJpeg();
-    deInit();
 
-    return (status ? -1 : 0);
+    return (mJpegSize < 0 ? -1 : 0);
 }
 
 /**
  * Initialize for the multi thread jpeg encoding
  *
  * it will create n CodecWorkerThread by according to the thread number.
+ * The threads are kept for the following encoding until deInit is called.
  */
 void SWJpegEncoder::init(unsigned int threadNum) {
     unsigned int num = CLIP(threadNum, MAX_THREAD_NUM, MIN_THREAD_NUM);
     LOG2("@%s, line:%d, thread number, pass:%d, real:%d", __func__, __LINE__, threadNum, num);
+    if (mSwJpegEncoder.size() == num) {
+        return;
+    }
 
+    deInit();
     for (unsigned int i = 0; i < num; i++) {
         std::shared_ptr<CodecWorkerThread> codecWorkerThread(new CodecWorkerThread);
+        std::string threadName = "SWJpegEnc" + std::to_string(i);
+        codecWorkerThread->runThread(threadName.c_str());
         mSwJpegEncoder.push_back(codecWorkerThread);
     }
 }
@@ -216,11 +232,12 @@ void SWJpegEncoder::init(unsigned int threadNum) {
 /**
  * deInit for the multi thread jpeg encoding
  *
- * it will release all n CodecWorkerThread
+ * it will stop and release all n CodecWorkerThread
  */
 void SWJpegEncoder::deInit(void) {
     LOG2("@%s, line:%d", __func__, __LINE__);
     for (auto& encoder : mSwJpegEncoder) {
+        encoder->stopThread();
         encoder.reset();
     }
 
@@ -236,15 +253,33 @@ void SWJpegEncoder::config(const EncodePackage& package) {
     LOG2("@%s, line:%d", __func__, __LINE__);
     std::shared_ptr<CodecWorkerThread> encThread;
     CodecWorkerThread::CodecConfig cfg;
+    CLEAR(cfg);
+
+    /*
+        Split the picture into slices of whole MCU rows, for example 1080 rows
+        (68 MCU rows) with 8 threads gives 7 slices of 144 rows and one of 72 rows.
+        Only the last slice may be shorter, never taller, so the restart interval
+        in the header of the first slice is valid for the whole picture. Make the
+        slices taller, and so fewer, until the last one has at least 16 rows.
+    */
+    const int mcuRows = (package.inputHeight + NV12_MCU_SIZE - 1) / NV12_MCU_SIZE;
+    const int mcuCols = (package.inputWidth + NV12_MCU_SIZE - 1) / NV12_MCU_SIZE;
+    const int threadNum = std::min(static_cast<int>(mSwJpegEncoder.size()), mcuRows);
+    int sliceMcuRows = (mcuRows + threadNum - 1) / threadNum;
+    while (true) {
+        mSliceNum = (mcuRows + sliceMcuRows - 1) / sliceMcuRows;
+        const int lastHeight =
+            package.inputHeight - sliceMcuRows * NV12_MCU_SIZE * (mSliceNum - 1);
+        if (mSliceNum == 1 || lastHeight >= NV12_MCU_SIZE) {
+            break;
+        }
+        sliceMcuRows++;
+    }
+    LOG2("@%s, line:%d, %u slices of %d MCU rows", __func__, __LINE__, mSliceNum, sliceMcuRows);
 
-    for (unsigned int i = 0; i < mSwJpegEncoder.size(); i++) {
+    for (unsigned int i = 0; i < mSliceNum; i++) {
         cfg.width = package.inputWidth;
-        /*
-            for example, there are 4 threads.
-            the first 3 threads must align to 16 which is NV12_MCU_SIZE
-            but for the last thread, it doesn't have this request.
-        */
-        cfg.height = ALIGN_16(package.inputHeight / mSwJpegEncoder.size());
+        cfg.height = sliceMcuRows * NV12_MCU_SIZE;
         cfg.stride = package.inputStride;
         /*
          * For NV12 format, Y and UV data are independent, total size is width*height*1.5;
@@ -262,15 +297,27 @@ void SWJpegEncoder::config(const EncodePackage& package) {
                    package.inputStride * package.inputHeight + cfg.stride * cfg.height * i / 2)
                 : nullptr;
         cfg.quality = package.quality;
-        cfg.outBufSize = (package.outputSize - package.exifDataSize - DEST_BUF_OFFSET) /
-                         package.inputHeight * cfg.height;
-        cfg.outBuf = static_cast<unsigned char*>(mDstBuf) + DEST_BUF_OFFSET + cfg.outBufSize * i;
+        /*
+         * The first slice is encoded to its final place, right after the exif data.
+         * The coded data of the others are moved to follow it when merging.
+         */
+        cfg.outBufSize = (package.outputSize - package.exifDataSize) / package.inputHeight *
+                         cfg.height;
+        cfg.outBuf = static_cast<unsigned char*>(mDstBuf) + cfg.outBufSize * i;
         /* update the last thread's height */
-        if (i == mSwJpegEncoder.size() - 1) {
-            cfg.height = package.inputHeight - cfg.height * (mSwJpegEncoder.size() - 1);
-            cfg.outBufSize = package.outputSize - package.exifDataSize - DEST_BUF_OFFSET -
-                             cfg.outBufSize * (mSwJpegEncoder.size() - 1);
+        if (i == mSliceNum - 1) {
+            cfg.height = package.inputHeight - cfg.height * (mSliceNum - 1);
+            cfg.outBufSize = package.outputSize - package.exifDataSize -
+                             cfg.outBufSize * (mSliceNum - 1);
         }
+        /*
+         * Every slice is one restart interval, so libjpeg writes no restart marker
+         * inside a slice and mergeJpeg() writes one between two slices.
+         */
+        cfg.restartInterval =
+            (mSliceNum > 1)
+                ? ((cfg.height + NV12_MCU_SIZE - 1) / NV12_MCU_SIZE) * mcuCols
+                : 0;
 
         encThread = mSwJpegEncoder[i];
         encThread->setConfig(cfg);
@@ -296,26 +343,17 @@ int SWJpegEncoder::doJpegEncodingMultiThread(void) {
     LOG2("@%s, line:%d", __func__, __LINE__);
     std::shared_ptr<CodecWorkerThread> encThread;
     status_t status = OK;
-    std::string threadName("CamHAL_SWEncodeMultiThread");
 
-    /* run all threads */
-    for (unsigned int i = 0; i < mSwJpegEncoder.size(); i++) {
-        threadName = threadName + ":" + std::to_string(i);
-        LOG2("@%s, new sw jpeg thread name:%s", __func__, threadName.c_str());
-        encThread = mSwJpegEncoder[i];
-        status = encThread->runThread(threadName.c_str());
-        if (status != OK) {
-            LOGE("@%s, line:%d, start jpeg thread fail, thread name:%s", __func__, __LINE__,
-                  threadName.c_str());
-            return status;
-        }
+    /* run all slices */
+    for (unsigned int i = 0; i < mSliceNum; i++) {
+        mSwJpegEncoder[i]->postEncode();
     }
 
-    /* wait all threads to finish */
-    for (unsigned int i = 0; i < mSwJpegEncoder.size(); i++) {
-        LOG2("@%s, the %d sw jpeg encoder thread before exit!", __func__, i);
+    /* wait all slices to finish */
+    for (unsigned int i = 0; i < mSliceNum; i++) {
+        LOG2("@%s, wait the %d sw jpeg slice", __func__, i);
         encThread = mSwJpegEncoder[i];
-        encThread->waitThreadFinish();
+        encThread->waitEncodeDone();
         if (encThread->getJpegDataSize() == -1) {
             status = UNKNOWN_ERROR;
         }
@@ -324,21 +362,52 @@ int SWJpegEncoder::doJpegEncodingMultiThread(void) {
     return status;
 }
 
+/**
+ * Get the header length of one jpeg picture, which is from SOI to the end of SOS.
+ *
+ * \param data: the jpeg data
+ * \param size: the jpeg data size
+ * \param sofPos: return the position of the SOF marker if it isn't nullptr
+ *
+ * \return int the header length, -1 if the header is invalid
+ */
+int SWJpegEncoder::getJpegHeaderLength(const unsigned char* data, int size, int* sofPos) {
+    if (size < 4 || data[0] != 0xFF || data[1] != 0xD8) {
+        return -1;
+    }
+
+    int pos = 2;
+    while (pos + 4 <= size) {
+        if (data[pos] != 0xFF) {
+            return -1;
+        }
+        unsigned char marker = data[pos + 1];
+        int len = (data[pos + 2] << 8) | data[pos + 3];
+        if (marker >= 0xC0 && marker <= 0xC2 && sofPos) {
+            *sofPos = pos;
+        }
+        pos += 2 + len;
+        if (marker == 0xDA) {
+            return (pos <= size) ? pos : -1;
+        }
+    }
+    return -1;
+}
+
 /**
  * the function will merge all jpeg pictures which are generated in multi threads
  * to one jpeg picture
  *
- * \return int the merged jpeg size
+ * The first picture is already in place, its header only needs the final size.
+ * The coded segments of the others are appended with restart markers.
+ *
+ * \return int the merged jpeg size, -1 if failed
  */
 int SWJpegEncoder::mergeJpeg(void) {
-#define HEADER_TOTAL_LEN 623
-#define HEADER_SOS_LEN 14
 #define HEADER_EOI_LEN 2
-#define HEADER_HEIGHT_POS 163
-#define HEADER_WIDTH_POS 165
-#define NV12_MCU_SIZE 16
+#define HEADER_SOF_HEIGHT_OFFSET 5
+#define HEADER_SOF_WIDTH_OFFSET 7
     LOG2("@%s, line:%d", __func__, __LINE__);
-    int size = HEADER_TOTAL_LEN - HEADER_SOS_LEN;
     CodecWorkerThread::CodecConfig cfg;
     nsecs_t startTime;
     std::shared_ptr<CodecWorkerThread> encThread = mSwJpegEncoder.at(0);
@@ -347,50 +416,38 @@ int SWJpegEncoder::mergeJpeg(void) {
         return -1;
     }
     encThread->getConfig(&cfg);
+    CheckAndLogError(cfg.outBuf != mDstBuf, -1, "the first slice isn't in place");
 
-    /* Write the JPEG header */
-    MEMCPY_S(mDstBuf, size, cfg.outBuf, size);
-
-    /* Update the width and height info */
-    mDstBuf[HEADER_HEIGHT_POS] = (mTotalHeight >> 8) & 0xFF;
-    mDstBuf[HEADER_HEIGHT_POS + 1] = mTotalHeight & 0xFF;
-    mDstBuf[HEADER_WIDTH_POS] = (mTotalWidth >> 8) & 0xFF;
-    mDstBuf[HEADER_WIDTH_POS + 1] = mTotalWidth & 0xFF;
+    int sofPos = -1;
+    int headerLen = getJpegHeaderLength(mDstBuf, encThread->getJpegDataSize(), &sofPos);
+    CheckAndLogError(headerLen < 0 || sofPos < 0, -1, "invalid jpeg header");
 
-    /* Write the restarting interval */
-    if (mSwJpegEncoder.size() > 1) {
-        unsigned int MCUs = (cfg.height / NV12_MCU_SIZE) * (cfg.width / NV12_MCU_SIZE);
-        mDstBuf[size++] = 0xFF;
-        mDstBuf[size++] = 0xDD;
-        mDstBuf[size++] = 0;
-        mDstBuf[size++] = 4;
-        mDstBuf[size++] = (MCUs >> 8) & 0xFF;
-        mDstBuf[size++] = MCUs & 0xFF;
-    }
+    /* Update the height and width info */
+    mDstBuf[sofPos + HEADER_SOF_HEIGHT_OFFSET] = (mTotalHeight >> 8) & 0xFF;
+    mDstBuf[sofPos + HEADER_SOF_HEIGHT_OFFSET + 1] = mTotalHeight & 0xFF;
+    mDstBuf[sofPos + HEADER_SOF_WIDTH_OFFSET] = (mTotalWidth >> 8) & 0xFF;
+    mDstBuf[sofPos + HEADER_SOF_WIDTH_OFFSET + 1] = mTotalWidth & 0xFF;
 
-    /* Write the SOS */
-    MEMCPY_S(reinterpret_cast<void*>((unsigned long)mDstBuf + size), HEADER_SOS_LEN,
-             reinterpret_cast<void*>((unsigned long)cfg.outBuf + HEADER_TOTAL_LEN - HEADER_SOS_LEN),
-             HEADER_SOS_LEN);
-    size += HEADER_SOS_LEN;
+    /* Keep the first coded segment in place, and drop its EOI */
+    int size = encThread->getJpegDataSize() - HEADER_EOI_LEN;
 
-    /* Write coded segments */
-    for (unsigned int i = 0; i < mSwJpegEncoder.size(); i++) {
+    /* Write the other coded segments */
+    for (unsigned int i = 1; i < mSliceNum; i++) {
         encThread = mSwJpegEncoder[i];
         startTime = CameraUtils::systemTime();
         encThread->getConfig(&cfg);
-        memmove(reinterpret_cast<void*>((unsigned long)mDstBuf + size),
-                reinterpret_cast<void*>((unsigned long)cfg.outBuf + HEADER_TOTAL_LEN),
-                (encThread->getJpegDataSize() - HEADER_TOTAL_LEN - HEADER_EOI_LEN));
-        LOG2("@%s, wr %d segments, size:%d, consume:%ums", __func__, i,
-             (encThread->getJpegDataSize() - HEADER_TOTAL_LEN - HEADER_EOI_LEN),
-             (unsigned)((CameraUtils::systemTime() - startTime) / 1000000));
-        size += (encThread->getJpegDataSize() - HEADER_TOTAL_LEN - HEADER_EOI_LEN);
+        const unsigned char* segment = static_cast<unsigned char*>(cfg.outBuf);
+        headerLen = getJpegHeaderLength(segment, encThread->getJpegDataSize(), nullptr);
+        CheckAndLogError(headerLen < 0, -1, "invalid jpeg header of slice %u", i);
 
-        if (i != (mSwJpegEncoder.size() - 1)) {
-            mDstBuf[size++] = 0xFF;
-            mDstBuf[size++] = (i & 0x7) | 0xD0;
-        }
+        mDstBuf[size++] = 0xFF;
+        mDstBuf[size++] = ((i - 1) & 0x7) | 0xD0;
+
+        int segmentSize = encThread->getJpegDataSize() - headerLen - HEADER_EOI_LEN;
+        memmove(mDstBuf + size, segment + headerLen, segmentSize);
+        LOG2("@%s, wr %d segments, size:%d, consume:%ums", __func__, i, segmentSize,
+             (unsigned)((CameraUtils::systemTime() - startTime) / 1000000));
+        size += segmentSize;
     }
 
     /* Write EOI */
@@ -400,7 +457,10 @@ int SWJpegEncoder::mergeJpeg(void) {
     return size;
 }
 
-SWJpegEncoder::CodecWorkerThread::CodecWorkerThread() : mDataSize(-1) {
+SWJpegEncoder::CodecWorkerThread::CodecWorkerThread()
+        : mDataSize(-1),
+          mEncodePending(false),
+          mExit(false) {
     LOG2("@%s, line:%d", __func__, __LINE__);
     CLEAR(mCfg);
 }
@@ -416,19 +476,51 @@ SWJpegEncoder::CodecWorkerThread::~CodecWorkerThread() {
  */
 status_t SWJpegEncoder::CodecWorkerThread::runThread(const char* name) {
     LOG2("@%s, line:%d", __func__, __LINE__);
-    this->start();
-    return OK;
+    {
+        std::lock_guard<std::mutex> l(mLock);
+        mEncodePending = false;
+        mExit = false;
+    }
+    return Thread::run(name, PRIORITY_NORMAL);
 }
 
 /**
- * wait one thread until it has finished
+ * stop the thread and wait until it has exited
  *
  */
-void SWJpegEncoder::CodecWorkerThread::waitThreadFinish(void) {
+void SWJpegEncoder::CodecWorkerThread::stopThread(void) {
     LOG2("@%s, line:%d", __func__, __LINE__);
+    Thread::exit();
+    {
+        std::lock_guard<std::mutex> l(mLock);
+        mExit = true;
+        mSignal.notify_all();
+    }
     this->wait();
 }
 
+/**
+ * start encoding the slice with the current configuration
+ *
+ */
+void SWJpegEncoder::CodecWorkerThread::postEncode(void) {
+    LOG2("@%s, line:%d", __func__, __LINE__);
+    std::lock_guard<std::mutex> l(mLock);
+    mDataSize = -1;
+    mEncodePending = true;
+    mSignal.notify_all();
+}
+
+/**
+ * wait until the posted slice has been encoded
+ *
+ */
+void SWJpegEncoder::CodecWorkerThread::waitEncodeDone(void) {
+    LOG2("@%s, line:%d", __func__, __LINE__);
+    std::unique_lock<std::mutex> lock(mLock);
+    mSignal.wait(lock, [this] { return !mEncodePending || mExit; });
+}
+
 /**
  * get jpeg size which is done in one thread
  *
@@ -441,18 +533,29 @@ int SWJpegEncoder::CodecWorkerThread::getJpegDataSize(void) {
 
 /**
  * the thread exe function for one jpeg thread
- * when the encoding has been done, it will return false to terminate the thread
+ * it waits for the posted slice and encodes it
  *
- * \return false
+ * \return false if the thread is stopped
  */
 bool SWJpegEncoder::CodecWorkerThread::threadLoop() {
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        mSignal.wait(lock, [this] { return mEncodePending || mExit; });
+        if (mExit) {
+            return false;
+        }
+    }
+
     LOG2("@%s, line:%d, in CodecWorkerThread", __func__, __LINE__);
     nsecs_t startTime = CameraUtils::systemTime();
     int ret = swEncode();
     LOG2("@%s one swEncode done!, consume:%ums, ret:%d", __func__,
          (unsigned)((CameraUtils::systemTime() - startTime) / 1000000), ret);
 
-    return false;
+    std::lock_guard<std::mutex> l(mLock);
+    mEncodePending = false;
+    mSignal.notify_all();
+    return true;
 }
 
 /**
@@ -470,7 +573,8 @@ int SWJpegEncoder::CodecWorkerThread::swEncode(void) {
     encoder.init();
     encoder.setJpegQuality(mCfg.quality);
     status = encoder.configEncoding(mCfg.width, mCfg.height, mCfg.stride,
-                                    static_cast<JSAMPLE*>(mCfg.outBuf), mCfg.outBufSize);
+                                    static_cast<JSAMPLE*>(mCfg.outBuf), mCfg.outBufSize,
+                                    mCfg.restartInterval);
     if (status != 0) {
         goto exit;
     }
@@ -544,12 +648,13 @@ void SWJpegEncoder::Codec::setJpegQuality(int quality) {
  * \param height: the height of the jpeg dimensions.
  * \param jpegBuf: the dest buffer to store the jpeg data
  * \param jpegBufSize: the size of jpegBuf buffer
+ * \param restartInterval: the restart interval in MCUs, 0 means no restart marker
  *
  * \return 0 if the configuration is right.
  * \return -1 if the configuration fails.
  */
 int SWJpegEncoder::Codec::configEncoding(int width, int height, int stride, void* jpegBuf,
-                                         int jpegBufSize) {
+                                         int jpegBufSize, int restartInterval) {
     LOG2("@%s", __func__);
 
     mStride = stride;
@@ -574,6 +679,7 @@ int SWJpegEncoder::Codec::configEncoding(int width, int height, int stride, void
     mCInfo.comp_info[1].v_samp_factor = 1;
     mCInfo.comp_info[2].h_samp_factor = 1;
     mCInfo.comp_info[2].v_samp_factor = 1;
+    mCInfo.restart_interval = restartInterval;
     jpeg_start_compress(&mCInfo, TRUE);
 
     return 0;
@@ -626,11 +732,13 @@ int SWJpegEncoder::Codec::doJpegEncoding(const void* y_buf, const void* uv_buf,
     data[1] = u;
     data[2] = v;
     for (i = 0; i < height; i += 16) {
-        for (j = 0; j < 16 && (i + j) < height; j++) {
-            y[j] = p411 + width * (j + i);
+        for (j = 0; j < 16; j++) {
+            // Repeat the last row to fill the last MCU row
+            const int row = std::min(i + j, height - 1);
+            y[j] = p411 + width * row;
             if (j % 2 == 0) {
-                u[j / 2] = p411 + width * height + width / 2 * ((j + i) / 2);
-                v[j / 2] = p411 + width * height + width * height / 4 + width / 2 * ((j + i) / 2);
+                u[j / 2] = p411 + width * height + width / 2 * (row / 2);
+                v[j / 2] = p411 + width * height + width * height / 4 + width / 2 * (row / 2);
             }
         }
         jpeg_write_raw_data(&mCInfo, data, 16);
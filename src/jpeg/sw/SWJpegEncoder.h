@@ -29,6 +29,8 @@
 #pragma once
 
 #include <stdio.h>
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 #include <linux/videodev2.h>
 
@@ -56,7 +58,8 @@ namespace icamera {
  */
 class SWJpegEncoder : public IJpegEncoder {
  public:
-    SWJpegEncoder();
+    // threadNum 0 means one encoding thread per online CPU core
+    explicit SWJpegEncoder(unsigned int threadNum = 0);
     ~SWJpegEncoder();
 
     virtual bool doJpegEncode(EncodePackage* package);
@@ -76,13 +79,15 @@ class SWJpegEncoder : public IJpegEncoder {
     int mTotalHeight;          /*!< the final jpeg height */
     unsigned char* mDstBuf;    /*!< the dest buffer to store the final jpeg */
     unsigned int mCPUCoresNum; /*!< use to remember the CPU Cores number */
+    unsigned int mSliceNum;    /*!< the slice number of the current picture */
 
  private:
     /**
      * \class CodecWorkerThread
      *
-     * This class will create one thread to do one sw jpeg encoder.
-     * It will call the SWJpegEncoderWrapper directly.
+     * This class keeps one thread to do the sw jpeg encoding of one slice.
+     * The thread is kept until the encoder is destroyed, and it will call the
+     * SWJpegEncoderWrapper directly for each posted slice.
      */
     class CodecWorkerThread : public Thread {
      public:
@@ -96,6 +101,7 @@ class SWJpegEncoder : public IJpegEncoder {
             void* inBufUV;
             // output buffer configuration
             int quality;
+            int restartInterval;  // in MCUs, 0 means no restart marker
             void* outBuf;
             int outBufSize;
         };
@@ -106,12 +112,19 @@ class SWJpegEncoder : public IJpegEncoder {
         void setConfig(const CodecConfig& cfg) { mCfg = cfg; }
         void getConfig(CodecConfig* cfg) const { *cfg = mCfg; }
         status_t runThread(const char* name);
-        void waitThreadFinish(void);
+        void stopThread(void);
+        void postEncode(void);
+        void waitEncodeDone(void);
         int getJpegDataSize(void);
 
      private:
         int mDataSize;    /*!< the jpeg data size in one thread */
         CodecConfig mCfg; /*!< the cfg in one thread */
+
+        std::mutex mLock; /*!< protect the below states */
+        std::condition_variable mSignal;
+        bool mEncodePending;
+        bool mExit;
      private:
         void run() {
             bool ret = true;
@@ -129,14 +142,12 @@ class SWJpegEncoder : public IJpegEncoder {
     void config(const EncodePackage& package);
     int doJpegEncodingMultiThread(void);
     int mergeJpeg(void);
+    static int getJpegHeaderLength(const unsigned char* data, int size, int* sofPos);
 
     std::vector<std::shared_ptr<CodecWorkerThread> > mSwJpegEncoder;
     static const unsigned int MAX_THREAD_NUM = 8; /*!< the same as max jpeg restart time */
     static const unsigned int MIN_THREAD_NUM = 1;
 
-    /*!< it's used to use one buffer to merge the multi jpeg data to one jpeg data */
-    static const unsigned int DEST_BUF_OFFSET = 1024;
-
  private:
     /**
      * \class Codec
@@ -153,7 +164,8 @@ class SWJpegEncoder : public IJpegEncoder {
         void init(void);
         void deInit(void);
         void setJpegQuality(int quality);
-        int configEncoding(int width, int height, int stride, void* jpegBuf, int jpegBufSize);
+        int configEncoding(int width, int height, int stride, void* jpegBuf, int jpegBufSize,
+                           int restartInterval = 0);
         /*
             if fourcc is V4L2_PIX_FMT_NV12, y_buf and uv_buf must be passed
             if fourcc is V4L2_PIX_FMT_YUYV, y_buf must be passed, uv_buf could be nullptr
@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Encodes NV12 pictures with the multi thread SW jpeg encoder and decodes them
+// with libjpeg. Any corrupt data warning, such as a restart marker out of
+// sequence, fails the test, as does a luma PSNR below 30 dB.
+
+#include <linux/videodev2.h>
+#include <math.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+extern "C" {
+#include <jpeglib.h>
+}
+
+#include "src/jpeg/sw/SWJpegEncoder.h"
+
+using icamera::EncodePackage;
+using icamera::SWJpegEncoder;
+
+namespace {
+
+struct DecodeError {
+    struct jpeg_error_mgr pub;
+    jmp_buf jump;
+    int warnings;
+};
+
+void onDecodeError(j_common_ptr cinfo) {
+    DecodeError* err = reinterpret_cast<DecodeError*>(cinfo->err);
+    (*cinfo->err->output_message)(cinfo);
+    longjmp(err->jump, 1);
+}
+
+void onDecodeMessage(j_common_ptr cinfo, int level) {
+    // Level -1 is a warning, libjpeg reports corrupt data this way
+    if (level < 0) {
+        DecodeError* err = reinterpret_cast<DecodeError*>(cinfo->err);
+        err->warnings++;
+        (*cinfo->err->output_message)(cinfo);
+    }
+}
+
+void fillNV12(int width, int height, std::vector<unsigned char>* buf) {
+    buf->resize(width * height * 3 / 2);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            (*buf)[y * width + x] = static_cast<unsigned char>((x * 3 + y * 5 + (x ^ y)) & 0xFF);
+        }
+    }
+    unsigned char* uv = buf->data() + width * height;
+    for (int y = 0; y < height / 2; y++) {
+        for (int x = 0; x < width; x++) {
+            uv[y * width + x] = static_cast<unsigned char>(((x & 1) ? y * 2 : x) & 0xFF);
+        }
+    }
+}
+
+bool decode(const unsigned char* data, int size, int width, int height,
+            std::vector<unsigned char>* luma, int* warnings) {
+    struct jpeg_decompress_struct cinfo;
+    DecodeError err;
+    cinfo.err = jpeg_std_error(&err.pub);
+    err.pub.error_exit = onDecodeError;
+    err.pub.emit_message = onDecodeMessage;
+    err.warnings = 0;
+    if (setjmp(err.jump)) {
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+
+    jpeg_create_decompress(&cinfo);
+    jpeg_mem_src(&cinfo, const_cast<unsigned char*>(data), size);
+    jpeg_read_header(&cinfo, TRUE);
+    cinfo.out_color_space = JCS_YCbCr;
+    jpeg_start_decompress(&cinfo);
+    if (static_cast<int>(cinfo.output_width) != width ||
+        static_cast<int>(cinfo.output_height) != height) {
+        fprintf(stderr, "decoded %ux%u, expected %dx%d\n", cinfo.output_width,
+                cinfo.output_height, width, height);
+        jpeg_destroy_decompress(&cinfo);
+        return false;
+    }
+
+    luma->resize(width * height);
+    std::vector<unsigned char> row(width * cinfo.output_components);
+    while (cinfo.output_scanline < cinfo.output_height) {
+        JSAMPROW rowPtr = row.data();
+        const int y = cinfo.output_scanline;
+        jpeg_read_scanlines(&cinfo, &rowPtr, 1);
+        for (int x = 0; x < width; x++) {
+            (*luma)[y * width + x] = row[x * cinfo.output_components];
+        }
+    }
+    jpeg_finish_decompress(&cinfo);
+    jpeg_destroy_decompress(&cinfo);
+    *warnings = err.warnings;
+    return true;
+}
+
+double lumaPsnr(const unsigned char* a, const unsigned char* b, int count) {
+    double sum = 0.0;
+    for (int i = 0; i < count; i++) {
+        const double d = static_cast<double>(a[i]) - b[i];
+        sum += d * d;
+    }
+    if (sum == 0.0) {
+        return 100.0;
+    }
+    return 10.0 * log10(255.0 * 255.0 * count / sum);
+}
+
+bool runCase(int width, int height, unsigned int threads) {
+    std::vector<unsigned char> input;
+    fillNV12(width, height, &input);
+    std::vector<unsigned char> output(width * height * 2);
+
+    EncodePackage package;
+    package.inputWidth = width;
+    package.inputHeight = height;
+    package.inputStride = width;
+    package.inputFormat = V4L2_PIX_FMT_NV12;
+    package.inputSize = input.size();
+    package.inputData = input.data();
+    package.outputWidth = width;
+    package.outputHeight = height;
+    package.outputSize = output.size();
+    package.outputData = output.data();
+    package.quality = 95;
+    package.exifDataSize = 0;
+
+    SWJpegEncoder encoder(threads);
+    if (!encoder.doJpegEncode(&package)) {
+        fprintf(stderr, "FAIL %dx%d, %u threads: encode failed\n", width, height, threads);
+        return false;
+    }
+
+    std::vector<unsigned char> luma;
+    int warnings = 0;
+    if (!decode(output.data(), package.encodedDataSize, width, height, &luma, &warnings)) {
+        fprintf(stderr, "FAIL %dx%d, %u threads: decode failed\n", width, height, threads);
+        return false;
+    }
+    const double psnr = lumaPsnr(input.data(), luma.data(), width * height);
+    if (warnings > 0 || psnr < 30.0) {
+        fprintf(stderr, "FAIL %dx%d, %u threads: %d warnings, psnr %.2f dB\n", width, height,
+                threads, warnings, psnr);
+        return false;
+    }
+    printf("ok %dx%d, %u threads: %u bytes, psnr %.2f dB\n", width, height, threads,
+           package.encodedDataSize, psnr);
+    return true;
+}
+
+}  // namespace
+
+int main() {
+    struct {
+        int width;
+        int height;
+    } sizes[] = {{1920, 1080}, {1920, 200}, {1920, 1088}, {1280, 960}, {1920, 40}, {2560, 1936}};
+    const unsigned int threads[] = {1, 2, 3, 4, 8};
+
+    int failures = 0;
+    for (const auto& size : sizes) {
+        for (unsigned int num : threads) {
+            if (!runCase(size.width, size.height, num)) {
+                failures++;
+            }
+        }
+    }
+    return (failures == 0) ? 0 : 1;
+}
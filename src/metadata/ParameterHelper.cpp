@@ -26,8 +26,16 @@ namespace icamera {
 
 void ParameterHelper::merge(const Parameters& src, Parameters* dst)
 {
-    AutoRLock rl(src.mData);
-    merge(getMetadata(src.mData), dst);
+    // The source metadata is not changed while the reference is held, see ParameterData
+    std::shared_ptr<CameraMetadata> metadata = getSharedMetadata(src.mData);
+    {
+        AutoWLock wl(dst->mData);
+        if (getMetadata(const_cast<const void*>(dst->mData)).isEmpty()) {
+            getInternalData(dst->mData).mMetadata.swap(metadata);
+            return;
+        }
+    }
+    merge(*metadata, dst);
 }
 
 void ParameterHelper::merge(const CameraMetadata& metadata, Parameters* dst)
@@ -74,7 +82,7 @@ void ParameterHelper::merge(const CameraMetadata& metadata, Parameters* dst)
 }
 
 const CameraMetadata& ParameterHelper::getMetadata(const Parameters& source) {
-    return getMetadata(source.mData);
+    return getMetadata(const_cast<const void*>(source.mData));
 }
 
 } // end of namespace icamera
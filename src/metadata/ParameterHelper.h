@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2017-2021 Intel Corporation.
+ * Copyright (C) 2017-2025 Intel Corporation.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include "iutils/RWLock.h"
 #include "CameraMetadata.h"
 
@@ -78,10 +81,14 @@ private:
      *
      * \brief The definition of Parameters' internal data structure used to hide implementation
      *        details of Parameters.
+     *
+     * The metadata is shared by the copies of a Parameters, so copying one only takes a
+     * reference. The first change to a shared metadata clones it (copy-on-write), so the
+     * other copies, and the readers holding a reference, never see the change.
      */
     class ParameterData {
     public:
-        ParameterData() {}
+        ParameterData() : mMetadata(std::make_shared<CameraMetadata>()) {}
         ~ParameterData() {}
 
         ParameterData(const ParameterData& other) : mMetadata(other.mMetadata) {}
@@ -90,7 +97,8 @@ private:
             return *this;
         }
 
-        CameraMetadata mMetadata; // The data structure to save all of the parameters.
+        // The data structure to save all of the parameters, shared with the copies.
+        std::shared_ptr<CameraMetadata> mMetadata;
         RWLock mRwLock;           // Read-write lock to make Parameters class thread-safe
     };
 
@@ -120,6 +128,7 @@ private:
     }
 
     static void* createParameterData(void* data) {
+        AutoRLock rl(data);
         return new ParameterData(getInternalData(data));
     }
 
@@ -127,16 +136,38 @@ private:
         delete &getInternalData(data);
     }
 
-    static void deepCopy(void* srcData, void* dstData) {
-        getInternalData(dstData) = getInternalData(srcData);
+    // Make dstData share the metadata of srcData, the caller must not hold any lock of them
+    static void copy(void* srcData, void* dstData) {
+        std::shared_ptr<CameraMetadata> metadata = getSharedMetadata(srcData);
+        AutoWLock wl(dstData);
+        getInternalData(dstData).mMetadata.swap(metadata);
     }
 
-    static CameraMetadata& getMetadata(void* data) {
+    static std::shared_ptr<CameraMetadata> getSharedMetadata(void* data) {
+        AutoRLock rl(data);
         return getInternalData(data).mMetadata;
     }
 
+    // For the readers, with the read lock held
+    static const CameraMetadata& getMetadata(const void* data) {
+        return *getInternalData(const_cast<void*>(data)).mMetadata;
+    }
+
+    // For the writers, with the write lock held. Clone the metadata if it is shared.
+    static CameraMetadata& getMetadata(void* data) {
+        std::shared_ptr<CameraMetadata>& metadata = getInternalData(data).mMetadata;
+        if (metadata.use_count() > 1) {
+            metadata = std::make_shared<CameraMetadata>(*metadata);
+        } else {
+            // use_count() is a relaxed load, so order the reads of the copy released last
+            // before the changes made in place.
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+        return *metadata;
+    }
+
     static icamera_metadata_ro_entry_t getMetadataEntry(void* data, uint32_t tag) {
-        return const_cast<const CameraMetadata*>(&getMetadata(data))->find(tag);
+        return getMetadata(const_cast<const void*>(data)).find(tag);
     }
 };
 
@@ -70,6 +70,8 @@ typedef uint32_t metadata_size_t;
  *   | free space for                                |
  *   | (entry_capacity-entry_count) entries          |
  *   |-----------------------------------------------|
+ *   | tag index of index_capacity slots, optional   |
+ *   |-----------------------------------------------|
  *   | start of camera_metadata.data                 |
  *   |                                               |
  *   |-----------------------------------------------|
@@ -93,9 +95,26 @@ struct icamera_metadata {
     metadata_size_t          data_count;
     metadata_size_t          data_capacity;
     metadata_uptrdiff_t      data_start; // Offset from camera_metadata
+    metadata_size_t          index_capacity;
+    metadata_uptrdiff_t      index_start; // Offset from camera_metadata
     uint8_t                  reserved[];
 };
 
+/**
+ * The tag index is an open addressing hash table of tag -> entry index, with linear
+ * probing. Its capacity is a power of 2 of at least twice the entry capacity, so the
+ * probe sequences stay short. It is only built for the buffers of at least
+ * INDEX_MIN_ENTRIES entries, the smaller ones are scanned.
+ *
+ * All the functions adding, moving or removing entries keep it in sync. When a tag
+ * has several entries, the index points to the first one, as the linear scan does.
+ */
+#define INDEX_ALIGNMENT (static_cast<size_t>(4))
+#define INDEX_MIN_ENTRIES (static_cast<size_t>(16))
+#define INDEX_MAX_ENTRIES (static_cast<size_t>(0xFFFE))
+#define INDEX_EMPTY_SLOT 0xFFFFU
+typedef uint16_t metadata_index_slot_t;
+
 /**
  * A datum of metadata. This corresponds to icamera_metadata_entry_t::data
  * with the difference that each element is not a pointer. We need to have a
@@ -157,6 +176,66 @@ static uint8_t *get_data(const icamera_metadata_t *metadata) {
     return (uint8_t*)metadata + metadata->data_start;
 }
 
+static metadata_index_slot_t *get_index(const icamera_metadata_t *metadata) {
+    return (metadata_index_slot_t*)((uint8_t*)metadata + metadata->index_start);
+}
+
+static size_t calculate_index_capacity(size_t entry_capacity) {
+    if ((entry_capacity < INDEX_MIN_ENTRIES) || (entry_capacity > INDEX_MAX_ENTRIES)) {
+        return 0U;
+    }
+
+    size_t capacity = 1U;
+    while (capacity < entry_capacity * 2U) {
+        capacity <<= 1;
+    }
+    return capacity;
+}
+
+static uint32_t index_hash(uint32_t tag, uint32_t mask) {
+    // The tags are dense per section, spread them over the whole table
+    uint32_t hash = tag * 0x9E3779B1U;
+    hash ^= hash >> 16;
+    return hash & mask;
+}
+
+/**
+ * Return the slot holding the tag, or the empty slot where it would be inserted.
+ */
+static metadata_index_slot_t *index_find_slot(const icamera_metadata_t *metadata,
+                                              uint32_t tag) {
+    const uint32_t mask = metadata->index_capacity - 1U;
+    const camera_metadata_buffer_entry_t *entries = get_entries(metadata);
+    metadata_index_slot_t *index = get_index(metadata);
+
+    uint32_t pos = index_hash(tag, mask);
+    // The table is never full, so an empty slot ends every probe sequence
+    while ((index[pos] != INDEX_EMPTY_SLOT) && (entries[index[pos]].tag != tag)) {
+        pos = (pos + 1U) & mask;
+    }
+    return &index[pos];
+}
+
+static void index_insert(icamera_metadata_t *metadata, size_t entry_index) {
+    metadata_index_slot_t *slot =
+        index_find_slot(metadata, get_entries(metadata)[entry_index].tag);
+    if (*slot == INDEX_EMPTY_SLOT) {
+        *slot = static_cast<metadata_index_slot_t>(entry_index);
+    }
+}
+
+static void index_rebuild(icamera_metadata_t *metadata) {
+    if (metadata->index_capacity == 0U) {
+        return;
+    }
+
+    (void)memset(get_index(metadata), 0xFF,
+                 sizeof(metadata_index_slot_t) * metadata->index_capacity);
+    for (size_t i = 0U; i < metadata->entry_count; i++) {
+        index_insert(metadata, i);
+    }
+}
+
 size_t get_icamera_metadata_alignment() {
     return METADATA_PACKET_ALIGNMENT;
 }
@@ -216,9 +295,14 @@ icamera_metadata_t *place_icamera_metadata(void *dst,
     metadata->data_count = 0U;
     metadata->data_capacity = data_capacity;
     metadata->size = memory_needed;
-    const size_t data_unaligned = (uint8_t*)(get_entries(metadata) +
+    const size_t index_unaligned = (uint8_t*)(get_entries(metadata) +
             metadata->entry_capacity) - (uint8_t*)metadata;
+    metadata->index_start = ALIGN_TO(index_unaligned, INDEX_ALIGNMENT);
+    metadata->index_capacity = calculate_index_capacity(entry_capacity);
+    const size_t data_unaligned = (uint8_t*)(get_index(metadata) +
+            metadata->index_capacity) - (uint8_t*)metadata;
     metadata->data_start = ALIGN_TO(data_unaligned, DATA_ALIGNMENT);
+    index_rebuild(metadata);
 
     assert(validate_icamera_metadata_structure(metadata, NULL) == icamera::OK);
     return metadata;
@@ -233,6 +317,9 @@ size_t calculate_icamera_metadata_size(size_t entry_count,
     // Start entry list at aligned boundary
     memory_needed = ALIGN_TO(memory_needed, ENTRY_ALIGNMENT);
     memory_needed += sizeof(camera_metadata_buffer_entry_t[entry_count]);
+    // Start tag index at aligned boundary
+    memory_needed = ALIGN_TO(memory_needed, INDEX_ALIGNMENT);
+    memory_needed += sizeof(metadata_index_slot_t) * calculate_index_capacity(entry_count);
     // Start buffer list at aligned boundary
     memory_needed = ALIGN_TO(memory_needed, DATA_ALIGNMENT);
     memory_needed += sizeof(uint8_t[data_count]);
@@ -298,6 +385,7 @@ icamera_metadata_t* copy_icamera_metadata(void *dst, size_t dst_size,
              get_entries(src), sizeof(camera_metadata_buffer_entry_t[metadata->entry_count]));
     MEMCPY_S(get_data(metadata), sizeof(uint8_t[metadata->data_count]),
              get_data(src), sizeof(uint8_t[metadata->data_count]));
+    index_rebuild(metadata);
 
     assert(validate_icamera_metadata_structure(metadata, NULL) == icamera::OK);
     return metadata;
@@ -375,6 +463,18 @@ int validate_icamera_metadata_structure(const icamera_metadata_t *metadata,
         return icamera::UNKNOWN_ERROR;
     }
 
+    const metadata_uptrdiff_t index_end = metadata->index_start +
+        sizeof(metadata_index_slot_t) * metadata->index_capacity;
+    if ((metadata->index_start < entries_end) || (index_end > metadata->data_start) ||
+        ((metadata->index_capacity & (metadata->index_capacity - 1U)) != 0U) ||
+        ((metadata->index_capacity != 0U) &&
+         (metadata->index_capacity <= metadata->entry_capacity))) {
+
+        LOGE("%s: Bad tag index, start %" PRIu32 ", capacity %" PRIu32,
+             __func__, metadata->index_start, metadata->index_capacity);
+        return icamera::UNKNOWN_ERROR;
+    }
+
     const metadata_uptrdiff_t data_end =
         metadata->data_start + metadata->data_capacity;
     if ((data_end < metadata->data_start) || // overflow check
@@ -492,8 +592,8 @@ int append_icamera_metadata(icamera_metadata_t *dst,
         }
     }
     if (dst->entry_count == 0U) {
-        // Appending onto empty buffer, keep sorted state
-        dst->flags |= src->flags & FLAG_SORTED;
+        // Appending onto empty buffer, take the sorted state of src
+        dst->flags = (dst->flags & ~FLAG_SORTED) | (src->flags & FLAG_SORTED);
     } else if (src->entry_count != 0U) {
         // Both src, dst are nonempty, cannot assume sort remains
         dst->flags &= ~FLAG_SORTED;
@@ -502,6 +602,11 @@ int append_icamera_metadata(icamera_metadata_t *dst,
     }
     dst->entry_count += src->entry_count;
     dst->data_count += src->data_count;
+    if (dst->index_capacity != 0U) {
+        for (size_t i = dst->entry_count - src->entry_count; i < dst->entry_count; i++) {
+            index_insert(dst, i);
+        }
+    }
 
     assert(validate_icamera_metadata_structure(dst, NULL) == icamera::OK);
     return icamera::OK;
@@ -574,6 +679,9 @@ static int add_camera_metadata_entry_raw(icamera_metadata_t *dst,
         dst->data_count += data_bytes;
     }
     dst->entry_count++;
+    if (dst->index_capacity != 0U) {
+        index_insert(dst, dst->entry_count - 1U);
+    }
     dst->flags &= ~FLAG_SORTED;
     assert(validate_icamera_metadata_structure(dst, NULL) == icamera::OK);
     return icamera::OK;
@@ -613,6 +721,7 @@ int sort_icamera_metadata(icamera_metadata_t *dst) {
             sizeof(camera_metadata_buffer_entry_t),
             compare_entry_tags);
     dst->flags |= FLAG_SORTED;
+    index_rebuild(dst);
 
     assert(validate_icamera_metadata_structure(dst, NULL) == icamera::OK);
     return icamera::OK;
@@ -658,7 +767,13 @@ int find_icamera_metadata_entry(icamera_metadata_t *src,
     }
 
     uint32_t index;
-    if ((src->flags & FLAG_SORTED) != 0U) {
+    if (src->index_capacity != 0U) {
+        const metadata_index_slot_t *slot = index_find_slot(src, tag);
+        if (*slot == INDEX_EMPTY_SLOT) {
+            return icamera::NAME_NOT_FOUND;
+        }
+        index = *slot;
+    } else if ((src->flags & FLAG_SORTED) != 0U) {
         // Sorted entries, do a binary search
         camera_metadata_buffer_entry_t *search_entry = NULL;
         camera_metadata_buffer_entry_t key;
@@ -734,6 +849,8 @@ int delete_icamera_metadata_entry(icamera_metadata_t *dst,
             sizeof(camera_metadata_buffer_entry_t) *
             (dst->entry_count - index - 1) );
     dst->entry_count -= 1;
+    // The following entries are moved, and a duplicate of the tag may become the first one
+    index_rebuild(dst);
 
     assert(validate_icamera_metadata_structure(dst, NULL) == icamera::OK);
     return icamera::OK;
@@ -212,6 +212,8 @@ void free_icamera_metadata(icamera_metadata_t *metadata);
 /**
  * Calculate the buffer size needed for a metadata structure of entry_count
  * metadata entries, needing a total of data_count bytes of extra data storage.
+ * It includes the tag index of the structure, if entry_count is large enough
+ * to have one.
  */
 size_t calculate_icamera_metadata_size(size_t entry_count,
         size_t data_count);
@@ -362,8 +364,10 @@ int get_icamera_metadata_ro_entry(const icamera_metadata_t *src,
  * returns entry contents like get_camera_metadata_entry.
  *
  * If multiple entries with the same tag exist, does not have any guarantees on
- * which is returned. To speed up searching for tags, sort the metadata
- * structure first by calling sort_camera_metadata().
+ * which is returned. Buffers with an entry capacity of at least 16 have a tag
+ * index and are searched in constant time. To speed up searching for tags in
+ * the smaller ones, sort the metadata structure first by calling
+ * sort_camera_metadata().
  */
 int find_icamera_metadata_entry(icamera_metadata_t *src,
         uint32_t tag,
@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times find, update and merge on a request of 200 tags, the way Parameters
+// and ParameterHelper::merge() use CameraMetadata, and the find against the
+// linear scan unsorted buffers had before the tag index. Prints ns per tag.
+//
+// Usage: IcameraMetadataBenchmark [rounds]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "CameraMetadata.h"
+#include "icamera_metadata_base.h"
+
+using icamera::CameraMetadata;
+
+namespace {
+
+const size_t kTagCount = 200;
+
+std::vector<uint32_t> gTags;
+
+void collectTags() {
+    for (uint32_t section = 0; section < CAMERA_SECTION_COUNT; section++) {
+        for (uint32_t index = 0; index < 256 && gTags.size() < kTagCount; index++) {
+            const uint32_t tag = (section << 16) | index;
+            if (get_icamera_metadata_tag_type(tag) >= 0) gTags.push_back(tag);
+        }
+    }
+}
+
+// One value of the tag type, as most of the request controls are
+void fillRequest(CameraMetadata* metadata, int seed) {
+    for (uint32_t tag : gTags) {
+        switch (get_icamera_metadata_tag_type(tag)) {
+            case ICAMERA_TYPE_BYTE: {
+                const uint8_t v = static_cast<uint8_t>(seed);
+                metadata->update(tag, &v, 1);
+                break;
+            }
+            case ICAMERA_TYPE_INT32: {
+                const int32_t v = seed;
+                metadata->update(tag, &v, 1);
+                break;
+            }
+            case ICAMERA_TYPE_FLOAT: {
+                const float v = static_cast<float>(seed);
+                metadata->update(tag, &v, 1);
+                break;
+            }
+            case ICAMERA_TYPE_INT64: {
+                const int64_t v = seed;
+                metadata->update(tag, &v, 1);
+                break;
+            }
+            case ICAMERA_TYPE_DOUBLE: {
+                const double v = seed;
+                metadata->update(tag, &v, 1);
+                break;
+            }
+            default: {
+                const icamera_metadata_rational_t v = {seed, 1};
+                metadata->update(tag, &v, 1);
+                break;
+            }
+        }
+    }
+}
+
+// What find_icamera_metadata_entry() did on an unsorted buffer
+bool scanFind(const icamera_metadata_t* metadata, uint32_t tag) {
+    const size_t count = get_icamera_metadata_entry_count(metadata);
+    icamera_metadata_ro_entry_t entry;
+    for (size_t i = 0; i < count; i++) {
+        get_icamera_metadata_ro_entry(metadata, i, &entry);
+        if (entry.tag == tag) return true;
+    }
+    return false;
+}
+
+// The body of ParameterHelper::merge(), without the Parameters locking
+void merge(CameraMetadata* src, CameraMetadata* dst) {
+    const icamera_metadata_t* buffer = src->getAndLock();
+    const size_t count = src->entryCount();
+    icamera_metadata_ro_entry_t entry;
+    for (size_t i = 0; i < count; i++) {
+        get_icamera_metadata_ro_entry(buffer, i, &entry);
+        switch (entry.type) {
+            case ICAMERA_TYPE_BYTE:
+                dst->update(entry.tag, entry.data.u8, entry.count);
+                break;
+            case ICAMERA_TYPE_INT32:
+                dst->update(entry.tag, entry.data.i32, entry.count);
+                break;
+            case ICAMERA_TYPE_FLOAT:
+                dst->update(entry.tag, entry.data.f, entry.count);
+                break;
+            case ICAMERA_TYPE_INT64:
+                dst->update(entry.tag, entry.data.i64, entry.count);
+                break;
+            case ICAMERA_TYPE_DOUBLE:
+                dst->update(entry.tag, entry.data.d, entry.count);
+                break;
+            default:
+                dst->update(entry.tag, entry.data.r, entry.count);
+                break;
+        }
+    }
+    src->unlock(buffer);
+}
+
+double nsPerTag(int rounds, const std::function<void()>& round) {
+    round();  // Warm up the caches
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        round();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / rounds / kTagCount;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int rounds = (argc > 1) ? atoi(argv[1]) : 2000;
+    if (rounds <= 0) {
+        fprintf(stderr, "Usage: %s [rounds]\n", argv[0]);
+        return 1;
+    }
+
+    collectTags();
+    CameraMetadata request;
+    CameraMetadata settings;
+    fillRequest(&request, 1);
+    fillRequest(&settings, 2);
+    printf("IcameraMetadataBenchmark, %zu tags\n", request.entryCount());
+
+    size_t found = 0;
+    const icamera_metadata_t* buffer = request.getAndLock();
+    const double indexedFind = nsPerTag(rounds, [&]() {
+        icamera_metadata_ro_entry_t entry;
+        for (uint32_t tag : gTags) {
+            if (find_icamera_metadata_ro_entry(buffer, tag, &entry) == 0) found++;
+        }
+    });
+    const double scannedFind = nsPerTag(rounds, [&]() {
+        for (uint32_t tag : gTags) {
+            if (scanFind(buffer, tag)) found++;
+        }
+    });
+    request.unlock(buffer);
+    if (found != static_cast<size_t>(rounds + 1) * kTagCount * 2) {
+        fprintf(stderr, "FAIL: found %zu tags\n", found);
+        return 1;
+    }
+
+    int seed = 0;
+    const double update = nsPerTag(rounds, [&]() { fillRequest(&request, seed++); });
+    const double merged = nsPerTag(rounds, [&]() { merge(&request, &settings); });
+
+    printf("%-8s %8.1f ns, scan %8.1f ns, x%.2f\n", "find", indexedFind, scannedFind,
+           scannedFind / indexedFind);
+    printf("%-8s %8.1f ns\n", "update", update);
+    printf("%-8s %8.1f ns\n", "merge", merged);
+    return 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Runs random add, update, delete, sort, append and copy sequences on
+// icamera metadata buffers, with and without a tag index, and checks after
+// each step that find_icamera_metadata_entry() returns the first entry of the
+// tag, as a linear scan of the entries does. Without the index, a sorted
+// buffer is bsearched and any entry of a duplicated tag may be returned.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <random>
+#include <vector>
+
+#include "icamera_metadata_base.h"
+#include "iutils/Errors.h"
+
+namespace {
+
+std::mt19937 gRng(1);
+int gFailures = 0;
+std::vector<uint32_t> gTags;
+
+void expect(bool cond, const char* what, int step) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s at step %d\n", what, step);
+        gFailures++;
+    }
+}
+
+void collectTags() {
+    for (uint32_t section = 0; section < CAMERA_SECTION_COUNT; section++) {
+        for (uint32_t index = 0; index < 256; index++) {
+            const uint32_t tag = (section << 16) | index;
+            if (get_icamera_metadata_tag_type(tag) >= 0) gTags.push_back(tag);
+        }
+    }
+}
+
+uint32_t randomTag(size_t tagCount) {
+    return gTags[gRng() % tagCount];
+}
+
+int linearFind(icamera_metadata_t* metadata, uint32_t tag) {
+    const size_t count = get_icamera_metadata_entry_count(metadata);
+    for (size_t i = 0; i < count; i++) {
+        icamera_metadata_entry_t entry;
+        get_icamera_metadata_entry(metadata, i, &entry);
+        if (entry.tag == tag) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+bool addRandomEntry(icamera_metadata_t* metadata, size_t tagCount) {
+    const uint32_t tag = randomTag(tagCount);
+    uint8_t data[64];
+    for (auto& v : data) v = static_cast<uint8_t>(gRng());
+    const size_t count = 1 + gRng() % 4;
+    return add_icamera_metadata_entry(metadata, tag, data, count) == icamera::OK;
+}
+
+// Every tag of the set, found or not, must give the same answer as the scan
+void checkFind(icamera_metadata_t* metadata, size_t tagCount, int step) {
+    // Copies are compact, their entry capacity may be under the index threshold
+    const bool indexed = get_icamera_metadata_entry_capacity(metadata) >= 16U;
+    expect(validate_icamera_metadata_structure(metadata, nullptr) == icamera::OK, "valid",
+           step);
+    for (size_t i = 0; i < tagCount; i++) {
+        const uint32_t tag = gTags[i];
+        const int expected = linearFind(metadata, tag);
+        icamera_metadata_entry_t entry;
+        const int ret = find_icamera_metadata_entry(metadata, tag, &entry);
+        if (expected < 0) {
+            expect(ret == icamera::NAME_NOT_FOUND, "missing tag is not found", step);
+        } else {
+            expect(ret == icamera::OK && entry.tag == tag, "found the tag", step);
+            expect(!indexed || entry.index == static_cast<size_t>(expected),
+                   "found the first entry of the tag", step);
+        }
+    }
+}
+
+// tagCount small makes duplicates of the same tag likely
+void runSequence(size_t entryCapacity, size_t tagCount, int steps) {
+    const size_t dataCapacity = entryCapacity * 64;
+    icamera_metadata_t* metadata = allocate_icamera_metadata(entryCapacity, dataCapacity);
+    icamera_metadata_t* other = allocate_icamera_metadata(entryCapacity, dataCapacity);
+
+    for (int step = 0; step < steps; step++) {
+        const size_t count = get_icamera_metadata_entry_count(metadata);
+        switch (gRng() % 8) {
+            case 0:
+            case 1:
+            case 2:
+                if (count < entryCapacity) addRandomEntry(metadata, tagCount);
+                break;
+            case 3:
+                if (count > 0) {
+                    uint8_t data[64] = {};
+                    update_icamera_metadata_entry(metadata, gRng() % count, data,
+                                                  1 + gRng() % 4, nullptr);
+                }
+                break;
+            case 4:
+                if (count > 0) delete_icamera_metadata_entry(metadata, gRng() % count);
+                break;
+            case 5:
+                sort_icamera_metadata(metadata);
+                break;
+            case 6: {
+                free_icamera_metadata(other);
+                other = allocate_icamera_metadata(entryCapacity, dataCapacity);
+                const size_t room = entryCapacity - count;
+                const size_t adds = room ? gRng() % (room + 1) : 0;
+                for (size_t i = 0; i < adds; i++) addRandomEntry(other, tagCount);
+                expect(append_icamera_metadata(metadata, other) == icamera::OK, "append", step);
+                break;
+            }
+            default: {
+                std::vector<uint8_t> buffer(get_icamera_metadata_size(metadata));
+                icamera_metadata_t* copy =
+                    copy_icamera_metadata(buffer.data(), buffer.size(), metadata);
+                expect(copy != nullptr, "copy", step);
+                if (copy != nullptr) {
+                    checkFind(copy, tagCount, step);
+                }
+                break;
+            }
+        }
+        checkFind(metadata, tagCount, step);
+
+        // Start over when full, so adds keep being tested
+        if (get_icamera_metadata_entry_count(metadata) == entryCapacity) {
+            free_icamera_metadata(metadata);
+            metadata = allocate_icamera_metadata(entryCapacity, dataCapacity);
+        }
+    }
+
+    free_icamera_metadata(other);
+    free_icamera_metadata(metadata);
+}
+
+}  // namespace
+
+int main() {
+    collectTags();
+    if (gTags.size() < 200U) {
+        fprintf(stderr, "FAIL: only %zu tags\n", gTags.size());
+        return 1;
+    }
+
+    // Below the index threshold, scanned or bsearched
+    runSequence(8, 12, 3000);
+    // Indexed, with many duplicates and with mostly distinct tags
+    runSequence(16, 10, 3000);
+    runSequence(64, 40, 3000);
+    runSequence(300, 200, 500);
+
+    if (gFailures == 0) {
+        printf("IcameraMetadataTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
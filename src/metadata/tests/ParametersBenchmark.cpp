@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Times the Parameters work of one request: the app settings are built and
+// merged into the HAL parameters, which are copied to the context and to the
+// result, merged back and read by getters. The copies share the metadata,
+// the "cloned" run changes every copy so it is cloned, as all copies were
+// before the copy-on-write. Prints us per request.
+//
+// Usage: ParametersBenchmark [requests]
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+
+#include "CameraMetadata.h"
+#include "ParameterHelper.h"
+#include "Parameters.h"
+
+using icamera::CameraMetadata;
+using icamera::ParameterHelper;
+using icamera::Parameters;
+using icamera::camera_ae_mode_t;
+using icamera::camera_af_mode_t;
+using icamera::camera_awb_mode_t;
+
+namespace {
+
+const size_t kRequestTags = 200;
+
+volatile int gSink = 0;  // Keeps the getters
+
+// The controls an app sets on each request
+void buildSettings(Parameters* settings, int request) {
+    settings->setAeMode(icamera::AE_MODE_AUTO);
+    settings->setAeLock(false);
+    settings->setExposureTime(request);
+    settings->setSensitivityGain(1.0f);
+    settings->setAeCompensation(request % 3);
+    settings->setFrameRate(30.0f);
+    settings->setAntiBandingMode(icamera::ANTIBANDING_MODE_AUTO);
+    settings->setAwbMode(icamera::AWB_MODE_AUTO);
+    settings->setAwbLock(false);
+    settings->setAfMode(icamera::AF_MODE_AUTO);
+    settings->setDigitalZoomRatio(1.0f);
+    settings->setJpegRotation(0);
+    settings->setFocusDistance(0.0f);
+    settings->setVideoStabilizationMode(icamera::VIDEO_STABILIZATION_MODE_OFF);
+}
+
+// The HAL parameters hold a whole request, one value for each of the first 200 tags
+void fillRequest(Parameters* param) {
+    CameraMetadata metadata;
+    size_t tags = 0;
+    for (uint32_t section = 0; section < CAMERA_SECTION_COUNT; section++) {
+        for (uint32_t index = 0; index < 256 && tags < kRequestTags; index++) {
+            const uint32_t tag = (section << 16) | index;
+            const int type = get_icamera_metadata_tag_type(tag);
+            const int32_t i32 = 1;
+            const int64_t i64 = 1;
+            const float f = 1.0f;
+            const double d = 1.0;
+            const icamera_metadata_rational_t r = {1, 1};
+            const uint8_t u8 = 1;
+            if (type == ICAMERA_TYPE_INT32) {
+                metadata.update(tag, &i32, 1);
+            } else if (type == ICAMERA_TYPE_INT64) {
+                metadata.update(tag, &i64, 1);
+            } else if (type == ICAMERA_TYPE_FLOAT) {
+                metadata.update(tag, &f, 1);
+            } else if (type == ICAMERA_TYPE_DOUBLE) {
+                metadata.update(tag, &d, 1);
+            } else if (type == ICAMERA_TYPE_RATIONAL) {
+                metadata.update(tag, &r, 1);
+            } else if (type == ICAMERA_TYPE_BYTE) {
+                metadata.update(tag, &u8, 1);
+            } else {
+                continue;
+            }
+            tags++;
+        }
+    }
+    ParameterHelper::merge(metadata, param);
+}
+
+// Makes a copy own its metadata, the cost each copy had before
+void ownCopy(Parameters* copy, bool cloned) {
+    if (cloned) copy->setAeLock(false);
+}
+
+int readSettings(const Parameters& param) {
+    int64_t exposure = 0;
+    float gain = 0;
+    int ev = 0;
+    float fps = 0;
+    float ratio = 0;
+    camera_ae_mode_t aeMode = icamera::AE_MODE_AUTO;
+    camera_awb_mode_t awbMode = icamera::AWB_MODE_AUTO;
+    camera_af_mode_t afMode = icamera::AF_MODE_AUTO;
+    bool aeLock = false;
+    bool awbLock = false;
+    param.getAeMode(aeMode);
+    param.getAeLock(aeLock);
+    param.getExposureTime(exposure);
+    param.getSensitivityGain(gain);
+    param.getAeCompensation(ev);
+    param.getFrameRate(fps);
+    param.getAwbMode(awbMode);
+    param.getAwbLock(awbLock);
+    param.getAfMode(afMode);
+    param.getDigitalZoomRatio(ratio);
+    return static_cast<int>(exposure) + ev + static_cast<int>(fps) + (aeLock ? 1 : 0);
+}
+
+double usPerRequest(int requests, bool cloned) {
+    Parameters halParam;
+    fillRequest(&halParam);
+    buildSettings(&halParam, 0);
+    int sum = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < requests; i++) {
+        Parameters settings;
+        buildSettings(&settings, i);
+        halParam.merge(settings);
+
+        Parameters context(halParam);
+        ownCopy(&context, cloned);
+        Parameters result;
+        result = context;
+        ownCopy(&result, cloned);
+
+        Parameters appResult;
+        appResult.merge(result);
+        sum += readSettings(appResult);
+    }
+    const auto end = std::chrono::steady_clock::now();
+    gSink = sum;
+    return std::chrono::duration<double, std::micro>(end - start).count() / requests;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const int requests = (argc > 1) ? atoi(argv[1]) : 20000;
+    if (requests <= 0) {
+        fprintf(stderr, "Usage: %s [requests]\n", argv[0]);
+        return 1;
+    }
+
+    // The best of a few runs, alternated so both see the same load
+    usPerRequest(requests / 10 + 1, false);
+    double shared = 0;
+    double cloned = 0;
+    for (int run = 0; run < 3; run++) {
+        const double s = usPerRequest(requests, false);
+        const double c = usPerRequest(requests, true);
+        shared = (run == 0 || s < shared) ? s : shared;
+        cloned = (run == 0 || c < cloned) ? c : cloned;
+    }
+    printf("ParametersBenchmark: shared copies %.2f us, cloned copies %.2f us, x%.2f\n", shared,
+           cloned, cloned / shared);
+    return 0;
+}
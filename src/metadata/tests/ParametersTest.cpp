@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Checks the copy-on-write of Parameters: a copy keeps its values when the
+// original or another copy is changed. Then writers publish whole settings
+// into a shared Parameters by assignment and merge while readers copy it and
+// re-read their copies, which must always hold the values of one settings.
+
+#include <stdio.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Parameters.h"
+#include "iutils/Errors.h"
+
+using icamera::Parameters;
+
+namespace {
+
+const int kWriters = 2;
+const int kReaders = 3;
+const int kRounds = 20000;
+
+int gFailures = 0;
+std::atomic<int> gThreadFailures(0);
+
+void expect(bool cond, const char* what) {
+    if (!cond) {
+        fprintf(stderr, "FAIL: %s\n", what);
+        gFailures++;
+    }
+}
+
+// The settings of round k, all of its values are derived from k
+void fillSettings(Parameters* param, int k) {
+    param->setExposureTime(k);
+    param->setSensitivityIso(k);
+    param->setFrameRate(static_cast<float>(k));
+}
+
+// Returns the round of the settings, or -1 if the values come from different rounds
+int readSettings(const Parameters& param) {
+    int64_t exposure = 0;
+    int iso = 0;
+    float fps = 0;
+    if (param.getExposureTime(exposure) != icamera::OK ||
+        param.getSensitivityIso(iso) != icamera::OK || param.getFrameRate(fps) != icamera::OK) {
+        return -1;
+    }
+    if (exposure != iso || static_cast<float>(iso) != fps) return -1;
+    return iso;
+}
+
+void testCopyOnWrite() {
+    Parameters original;
+    fillSettings(&original, 1);
+
+    Parameters copy(original);
+    Parameters assigned;
+    assigned = original;
+    expect(readSettings(copy) == 1, "the copy has the values of the original");
+    expect(readSettings(assigned) == 1, "the assigned copy has the values of the original");
+
+    fillSettings(&original, 2);
+    expect(readSettings(original) == 2, "the original is changed");
+    expect(readSettings(copy) == 1, "the copy is not changed with the original");
+    expect(readSettings(assigned) == 1, "the assigned copy is not changed with the original");
+
+    fillSettings(&copy, 3);
+    expect(readSettings(copy) == 3, "the copy is changed");
+    expect(readSettings(assigned) == 1, "a copy is not changed with another copy");
+
+    // Merging into an empty Parameters shares the metadata too
+    Parameters merged;
+    merged.merge(assigned);
+    fillSettings(&assigned, 4);
+    expect(readSettings(merged) == 1, "the merged copy is not changed with the source");
+
+    Parameters update;
+    update.setExposureTime(5);
+    merged.merge(update);
+    int64_t exposure = 0;
+    merged.getExposureTime(exposure);
+    expect(exposure == 5, "the merge updates the existing values");
+    expect(readSettings(assigned) == 4, "the merge does not change the source of the copy");
+
+    Parameters& self = merged;
+    merged = self;
+    merged.getExposureTime(exposure);
+    expect(exposure == 5, "self assignment keeps the values");
+}
+
+void testConcurrentCopies() {
+    Parameters shared;
+    fillSettings(&shared, 0);
+    std::atomic<bool> running(true);
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < kWriters; w++) {
+        writers.emplace_back([&shared, w]() {
+            Parameters settings;
+            for (int k = 1; k <= kRounds; k++) {
+                fillSettings(&settings, k);
+                if ((k + w) % 3 == 0) {
+                    shared.merge(settings);
+                } else {
+                    shared = settings;
+                }
+                // Changing the published settings must not be seen through shared
+                settings.setExposureTime(-1);
+                if (k % 100 == 0) {
+                    Parameters& self = shared;
+                    shared = self;
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < kReaders; r++) {
+        readers.emplace_back([&shared, &running]() {
+            while (running) {
+                Parameters snapshot(shared);
+                const int k = readSettings(snapshot);
+                Parameters again;
+                again = snapshot;
+                if (k < 0 || readSettings(again) != k || readSettings(snapshot) != k) {
+                    gThreadFailures++;
+                }
+            }
+        });
+    }
+
+    for (auto& t : writers) t.join();
+    running = false;
+    for (auto& t : readers) t.join();
+
+    expect(gThreadFailures == 0, "the readers always see whole settings");
+    expect(readSettings(shared) == kRounds, "the last settings are kept");
+}
+
+}  // namespace
+
+int main() {
+    testCopyOnWrite();
+    testConcurrentCopies();
+
+    if (gFailures == 0) {
+        printf("ParametersTest passed\n");
+    }
+    return (gFailures == 0) ? 0 : 1;
+}
@@ -104,6 +104,16 @@ std::vector<std::pair<std::string, SensorInfo>> CameraParserInvoker::getAvailabl
 
     std::vector<std::pair<std::string, SensorInfo>> availableSensors;
     for (const auto& sensor : sensorsList) {
+        // FILE_SOURCE_S
+        if ((mMediaCtl == nullptr) && PlatformData::isFileSourceEnabled()) {
+            // The frames are injected from files, take the sensor without probing it
+            std::string sensorOutName = sensor.substr(0, sensor.find_last_of('-'));
+            SensorInfo sensorInfo = {sensorOutName, true};
+            availableSensors.push_back({sensorOutName, sensorInfo});
+            LOG1("@%s, use %s for file source", __func__, sensorOutName.c_str());
+            continue;
+        }
+        // FILE_SOURCE_E
         if (sensor.find("-") == std::string::npos) {
             // sensors without suffix port number
             if (mMediaCtl && mMediaCtl->checkAvailableSensor(sensor)) {
@@ -47,15 +47,18 @@ static bool isSameRatio(const HalStream* s1, float ratio) {
 
 Mutex GraphConfig::sLock;
 std::map<int32_t, StaticReaderBinaryData> GraphConfig::mGraphConfigBinaries;
+std::map<int32_t, StaticGraphReader> GraphConfig::mGraphReaders;
 
 GraphConfig::GraphConfig(int32_t camId, ConfigMode mode) : mCameraId(camId), mSensorRatio(0.0f) {
     AutoMutex l(sLock);
     CheckAndLogError(mGraphConfigBinaries.find(mCameraId) == mGraphConfigBinaries.end(), VOID_VALUE,
                      "<id%d>No graph bin loaded", mCameraId);
 
-    const StaticGraphStatus sRet = mGraphReader.Init(mGraphConfigBinaries[mCameraId]);
-    CheckAndLogError(sRet != StaticGraphStatus::SG_OK, VOID_VALUE,
-                      "%s: failed to init graph reader", __func__);
+    // The reader is initialized (with its header index) once when the binary is loaded
+    auto reader = mGraphReaders.find(mCameraId);
+    CheckAndLogError(reader == mGraphReaders.end(), VOID_VALUE,
+                     "%s: failed to init graph reader", __func__);
+    mGraphReader = reader->second;
 }
 
 GraphConfig::GraphConfig() : mCameraId(-1) { }
@@ -78,6 +81,7 @@ void GraphConfig::releaseGraphNodes() {
         item.second.data = nullptr;
     }
     mGraphConfigBinaries.clear();
+    mGraphReaders.clear();
 }
 
 uint32_t GraphConfig::createQueryKeyAttribute(int cameraId) {
@@ -625,8 +629,18 @@ int32_t GraphConfig::loadStaticGraphConfig(const std::string& name) {
         return BAD_VALUE;
     }
 
+    StaticGraphReader reader;
+    const StaticGraphStatus sRet = reader.Init(binData);
+    if (sRet != StaticGraphStatus::SG_OK) {
+        LOGE("%s, failed to init graph reader with %s", __func__, fileName);
+        free(binData.data);
+        binData.data = nullptr;
+        return BAD_VALUE;
+    }
+
     AutoMutex l(sLock);
     mGraphConfigBinaries[mCameraId] = binData;
+    mGraphReaders[mCameraId] = reader;
     return OK;
 }
 
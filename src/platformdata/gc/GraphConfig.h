@@ -207,6 +207,8 @@ class GraphConfig {
     // TODO: Save different bin data (depends on use case, ...) for one camera?
     static Mutex sLock;
     static std::map<int32_t, StaticReaderBinaryData> mGraphConfigBinaries;
+    // <camera id, reader initialized with the binary>, copied by each GraphConfig
+    static std::map<int32_t, StaticGraphReader> mGraphReaders;
 
     StaticGraphReader mGraphReader;
 
@@ -18,6 +18,10 @@
 
 #include "src/scheduler/CameraScheduler.h"
 
+#include <inttypes.h>
+
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <utility>
 
@@ -52,7 +56,15 @@ int32_t CameraScheduler::createExecutors() {
     int32_t exeNumber = mPolicy->getExecutors(&executors);
     CheckAndLogError(exeNumber <= 0, UNKNOWN_ERROR, "Can't get Executors' names");
 
+    uint32_t poolThreads = 0U;
+    std::vector<int32_t> poolCpus;
+    bool poolMode = mPolicy->getThreadPoolConfig(&poolThreads, &poolCpus);
+
     std::lock_guard<std::mutex> l(mLock);
+    if (poolMode) {
+        LOG1("%s: use thread pool, %u threads", __func__, poolThreads);
+        mThreadPool = std::make_shared<SchedulerThreadPool>(poolThreads, poolCpus);
+    }
     for (auto& exe : executors) {
         ExecutorGroup group;
         if (mMsAlignWithSystem) {
@@ -69,7 +81,8 @@ int32_t CameraScheduler::createExecutors() {
                 source->addListener(group.executor);
             }
         }
-        mPolicy->getNodeList(exe.first, &group.nodeList);
+        group.executor->setThreadPool(mThreadPool);
+        mPolicy->getNodeList(exe.first, &group.nodeList, &group.nodeStages);
 
         mExeGroups.push_back(group);
     }
@@ -80,23 +93,29 @@ void CameraScheduler::destroyExecutors() {
     std::lock_guard<std::mutex> l(mLock);
     mRegisteredNodes.clear();
     mExeGroups.clear();
+    mThreadPool = nullptr;
 }
 
 int32_t CameraScheduler::registerNode(ISchedulerNode* node) {
     std::lock_guard<std::mutex> l(mLock);
 
     ExecutorGroup* group = nullptr;
+    int32_t stage = 0;
     for (size_t i = 0U; i < mExeGroups.size(); i++) {
-        for (auto& nodeName : mExeGroups[i].nodeList) {
-            if (strcmp(nodeName.c_str(), node->getName()) == 0) {
+        for (size_t j = 0U; j < mExeGroups[i].nodeList.size(); j++) {
+            if (strcmp(mExeGroups[i].nodeList[j].c_str(), node->getName()) == 0) {
                 group = &mExeGroups[i];
+                // Keep the registration order if nodes run in executor threads
+                if (mThreadPool && j < group->nodeStages.size()) {
+                    stage = group->nodeStages[j];
+                }
                 break;
             }
         }
     }
     CheckWarning(!group, BAD_VALUE, "register node %s fail", node->getName());
 
-    group->executor->addNode(node);
+    group->executor->addNode(node, stage);
     mRegisteredNodes[node] = group;
     return OK;
 }
@@ -110,6 +129,9 @@ void CameraScheduler::unregisterNode(ISchedulerNode* node) {
 }
 
 void CameraScheduler::start() {
+    if (mThreadPool) {
+        mThreadPool->start();
+    }
     for (auto& group : mExeGroups) {
         group.executor->start();
     }
@@ -119,6 +141,9 @@ void CameraScheduler::stop() {
     for (auto& group : mExeGroups) {
         group.executor->stop();
     }
+    if (mThreadPool) {
+        mThreadPool->stop();
+    }
 }
 
 int32_t CameraScheduler::executeNode(std::string triggerSource, int64_t triggerId) {
@@ -152,20 +177,32 @@ std::shared_ptr<CameraScheduler::Executor> CameraScheduler::findExecutor(const c
 CameraScheduler::Executor::Executor(const char* name)
         : mName(name ? name : "unknown"),
           mActive(false),
-          mTriggerTick(0) {}
+          mPendingHead(0U),
+          mPendingCount(0U),
+          mCurrentTickTime(0),
+          mTriggerTick(0) {
+    CLEAR(mPendingTicks);
+    CLEAR(mStats);
+}
 
 CameraScheduler::Executor::~Executor() {
     LOG1("%s: destroy", getName());
     CameraScheduler::Executor::stop();
 }
 
-void CameraScheduler::Executor::addNode(ISchedulerNode* node) {
+void CameraScheduler::Executor::addNode(ISchedulerNode* node, int32_t stage) {
     std::lock_guard<std::mutex> l(mNodeLock);
     if (mActive) {
         return;
     }
-    mNodes.push_back(node);
-    LOG1("%s: %s added to %s, pos %d", __func__, node->getName(), getName(), mNodes.size());
+    size_t pos = mNodes.size();
+    while (pos > 0U && mNodeStages[pos - 1U] > stage) {
+        pos--;
+    }
+    mNodes.insert(mNodes.begin() + pos, node);
+    mNodeStages.insert(mNodeStages.begin() + pos, stage);
+    LOG1("%s: %s added to %s, pos %zu, stage %d", __func__, node->getName(), getName(), pos,
+         stage);
 }
 
 void CameraScheduler::Executor::removeNode(ISchedulerNode* node) {
@@ -177,6 +214,7 @@ void CameraScheduler::Executor::removeNode(ISchedulerNode* node) {
         if (mNodes[i] == node) {
             LOG1("%s: %s moved from %s", __func__, node->getName(), getName());
             mNodes.erase(mNodes.begin() + i);
+            mNodeStages.erase(mNodeStages.begin() + i);
             break;
         }
     }
@@ -188,6 +226,10 @@ void CameraScheduler::Executor::start() {
         std::lock_guard<std::mutex> l(mNodeLock);
         mActive = true;
         mTriggerTick = 0;
+        mPendingHead = 0U;
+        mPendingCount = 0U;
+        mCurrentTickTime = 0;
+        CLEAR(mStats);
     }
     Thread::start();
 }
@@ -201,37 +243,92 @@ void CameraScheduler::Executor::stop() {
         mTriggerSignal.notify_one();
     }
     Thread::wait();
+    dumpStats();
+}
+
+void CameraScheduler::Executor::dumpStats() {
+    std::lock_guard<std::mutex> l(mNodeLock);
+    if (mStats.runCount == 0U) {
+        return;
+    }
+
+    LOG1("%s: runs %" PRIu64 ", overflow %" PRIu64 ", max queue depth %u, wake latency avg %" PRId64
+         " us max %" PRId64 " us, process avg %" PRId64 " us max %" PRId64 " us",
+         getName(), mStats.runCount, mStats.overflowCount, mStats.maxQueueDepth,
+         mStats.totalWakeLatency / mStats.runCount / 1000, mStats.maxWakeLatency / 1000,
+         mStats.totalProcessTime / mStats.runCount / 1000, mStats.maxProcessTime / 1000);
+    CLEAR(mStats);
 }
 
 void CameraScheduler::Executor::trigger(int64_t tick) {
     PERF_CAMERA_ATRACE_PARAM1(getName(), tick);
     std::lock_guard<std::mutex> l(mNodeLock);
     mTriggerTick = tick;
+
+    // Queue the trigger instead of overwriting, so each trigger gets one process pass
+    if (mPendingCount == kMaxPendingTicks) {
+        LOGW("%s: pending trigger queue full, drop tick %" PRId64, getName(),
+             mPendingTicks[mPendingHead].tick);
+        mPendingHead = (mPendingHead + 1U) % kMaxPendingTicks;
+        mPendingCount--;
+        mStats.overflowCount++;
+    }
+    PendingTick& pending = mPendingTicks[(mPendingHead + mPendingCount) % kMaxPendingTicks];
+    pending.tick = tick;
+    pending.time = CameraUtils::systemTime();
+    mPendingCount++;
+    mStats.maxQueueDepth = std::max(mStats.maxQueueDepth, mPendingCount);
+
     mTriggerSignal.notify_one();
 }
 
-int CameraScheduler::Executor::waitTrigger() {
+int64_t CameraScheduler::Executor::waitTrigger() {
     std::unique_lock<std::mutex> lock(mNodeLock);
-    std::cv_status ret = mTriggerSignal.wait_for(
-        lock, std::chrono::nanoseconds(kWaitDuration * SLOWLY_MULTIPLIER));
-    CheckWarning(ret == std::cv_status::timeout, true, "%s: wait trigger time out", getName());
-    return mTriggerTick;
+    if (mPendingCount == 0U) {
+        std::cv_status ret = mTriggerSignal.wait_for(
+            lock, std::chrono::nanoseconds(kWaitDuration * SLOWLY_MULTIPLIER));
+        CheckWarning(ret == std::cv_status::timeout && mPendingCount == 0U, mTriggerTick,
+                     "%s: wait trigger time out", getName());
+    }
+    if (mPendingCount == 0U) {
+        return mTriggerTick;
+    }
+
+    const PendingTick& pending = mPendingTicks[mPendingHead];
+    mPendingHead = (mPendingHead + 1U) % kMaxPendingTicks;
+    mPendingCount--;
+    mCurrentTickTime = pending.time;
+    return pending.tick;
 }
 
 bool CameraScheduler::Executor::threadLoop() {
     int64_t tick = waitTrigger();
+    nsecs_t tickTime = 0;
 
     {
         std::lock_guard<std::mutex> l(mNodeLock);
         if (!mActive) {
             return false;
         }
+        tickTime = mCurrentTickTime;
+        mCurrentTickTime = 0;
     }
 
-    LOG3("%s process, tick %d", getName(), tick);
-    for (auto& node : mNodes) {
-        bool ret = node->process(tick);
-        CheckAndLogError(!ret, true, "%s: node %s process error", getName(), node->getName());
+    const nsecs_t startTime = CameraUtils::systemTime();
+    LOG3("%s process, tick %" PRId64, getName(), tick);
+    if (!processNodes(tick)) {
+        return true;
+    }
+
+    {
+        const nsecs_t processTime = CameraUtils::systemTime() - startTime;
+        const nsecs_t wakeLatency = (tickTime != 0) ? (startTime - tickTime) : 0;
+        std::lock_guard<std::mutex> l(mNodeLock);
+        mStats.runCount++;
+        mStats.totalWakeLatency += wakeLatency;
+        mStats.maxWakeLatency = std::max(mStats.maxWakeLatency, wakeLatency);
+        mStats.totalProcessTime += processTime;
+        mStats.maxProcessTime = std::max(mStats.maxProcessTime, processTime);
     }
 
     for (auto listener : mListeners) {
@@ -241,12 +338,52 @@ bool CameraScheduler::Executor::threadLoop() {
     return true;
 }
 
+bool CameraScheduler::Executor::processNodes(int64_t tick) {
+    if (!mThreadPool) {
+        for (auto& node : mNodes) {
+            bool ret = node->process(tick);
+            CheckAndLogError(!ret, false, "%s: node %s process error", getName(),
+                             node->getName());
+        }
+        return true;
+    }
+
+    // Stages run one by one, the nodes of one stage run on the thread pool.
+    // The executor waits for each stage, so one node never runs concurrently
+    // with itself and handles the ticks in order, the same as the serial mode.
+    size_t begin = 0U;
+    while (begin < mNodes.size()) {
+        size_t end = begin + 1U;
+        while (end < mNodes.size() && mNodeStages[end] == mNodeStages[begin]) {
+            end++;
+        }
+
+        std::atomic<bool> success(true);
+        std::vector<SchedulerThreadPool::Task> tasks;
+        for (size_t i = begin; i < end; i++) {
+            ISchedulerNode* node = mNodes[i];
+            tasks.push_back([this, node, tick, &success] {
+                if (!node->process(tick)) {
+                    LOGE("%s: node %s process error", getName(), node->getName());
+                    success = false;
+                }
+            });
+        }
+        mThreadPool->runTasks(tasks);
+        if (!success) {
+            return false;
+        }
+        begin = end;
+    }
+    return true;
+}
+
 void CameraScheduler::SystemTimerExecutor::trigger(int64_t tick) {
     // Ignore external trigger
     UNUSED(tick);
 }
 
-int CameraScheduler::SystemTimerExecutor::waitTrigger() {
+int64_t CameraScheduler::SystemTimerExecutor::waitTrigger() {
 // Allow +/- 3ms delay
 // TODO: check and ignore repeating without sleep (if no task to be handled)
 #define SYS_TRIGGER_DELTA    (3)
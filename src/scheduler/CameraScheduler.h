@@ -26,6 +26,7 @@
 #include "CameraEvent.h"
 #include "CameraSchedulerPolicy.h"
 #include "ISchedulerNode.h"
+#include "SchedulerThreadPool.h"
 
 namespace icamera {
 
@@ -78,26 +79,57 @@ class CameraScheduler {
         }
         bool threadLoop();
 
-        void addNode(ISchedulerNode*);
+        // Nodes are kept in stage order, the ones of the same stage may run concurrently
+        void addNode(ISchedulerNode* node, int32_t stage);
         void removeNode(ISchedulerNode* node);
+        void setThreadPool(std::shared_ptr<SchedulerThreadPool> pool) { mThreadPool = pool; }
         void addListener(std::shared_ptr<Executor> executor) { mListeners.push_back(executor); }
         virtual void trigger(int64_t tick);
 
         const char* getName() { return mName.c_str(); }
 
      protected:
-        virtual int waitTrigger();
+        virtual int64_t waitTrigger();
+        bool processNodes(int64_t tick);
+        void dumpStats();
 
      private:
         static const nsecs_t kWaitDuration = 2000000000;  // 2s
+        // Triggers which are not handled yet, the oldest one is dropped on overflow
+        static const uint32_t kMaxPendingTicks = 16U;
+
+        struct PendingTick {
+            int64_t tick;
+            nsecs_t time;  // When the trigger arrived
+        };
+
+        // Profiling data, for tuning the policies in pipe_scheduler_profiles.json
+        struct ExecutorStats {
+            uint64_t runCount;
+            uint64_t overflowCount;
+            uint32_t maxQueueDepth;
+            nsecs_t totalWakeLatency;
+            nsecs_t maxWakeLatency;
+            nsecs_t totalProcessTime;
+            nsecs_t maxProcessTime;
+        };
 
         std::string mName;
 
         std::vector<ISchedulerNode*> mNodes;
+        std::vector<int32_t> mNodeStages;
         std::vector<std::shared_ptr<Executor>> mListeners;
+        std::shared_ptr<SchedulerThreadPool> mThreadPool;
         std::condition_variable mTriggerSignal;
         bool mActive;
 
+        // Ring of pending triggers, protected by mNodeLock
+        PendingTick mPendingTicks[kMaxPendingTicks];
+        uint32_t mPendingHead;
+        uint32_t mPendingCount;
+        nsecs_t mCurrentTickTime;
+        ExecutorStats mStats;
+
     protected:
         std::mutex mNodeLock;
         int64_t mTriggerTick;
@@ -118,7 +150,7 @@ class CameraScheduler {
 
      private:
         // Executor
-        virtual int waitTrigger();
+        virtual int64_t waitTrigger();
 
      private:
         int32_t mMsAlignWithSystem;
@@ -135,6 +167,7 @@ class CameraScheduler {
         std::shared_ptr<Executor> executor;
         std::string triggerSource;  //  empty string means no designated source
         std::vector<std::string> nodeList;
+        std::vector<int32_t> nodeStages;
     };
 
     int mCameraId;
@@ -142,6 +175,8 @@ class CameraScheduler {
     std::vector<ExecutorGroup> mExeGroups;
     // Record owner exe of nodes (after policy switch)
     std::unordered_map<ISchedulerNode*, ExecutorGroup*> mRegisteredNodes;
+    // Shared by all executors in thread pool mode, otherwise nullptr
+    std::shared_ptr<SchedulerThreadPool> mThreadPool;
 
     int64_t mTriggerCount;
 
@@ -28,6 +28,7 @@
 namespace icamera {
 
 #define SCHEDULER_POLICY_FILE_NAME "pipe_scheduler_profiles.json"
+#define DEFAULT_POOL_THREADS 2U
 
 CameraSchedulerPolicy* CameraSchedulerPolicy::sInstance = nullptr;
 std::mutex CameraSchedulerPolicy::sLock;
@@ -89,19 +90,33 @@ int32_t CameraSchedulerPolicy::getExecutors(std::map<const char*, const char*>*
 }
 
 int32_t CameraSchedulerPolicy::getNodeList(const char* exeName,
-                                           std::vector<std::string>* nodeList) const {
+                                           std::vector<std::string>* nodeList,
+                                           std::vector<int32_t>* nodeStages) const {
     CheckAndLogError(!nodeList, BAD_VALUE, "nullptr input");
     CheckAndLogError(!mActiveConfig, BAD_VALUE, "No config");
 
     for (auto& exe : mActiveConfig->exeList) {
         if (strcmp(exe.exeName.c_str(), exeName) == 0) {
             *nodeList = exe.nodeList;
+            if (nodeStages) {
+                *nodeStages = exe.nodeStages;
+            }
             return OK;
         }
     }
     return BAD_VALUE;
 }
 
+bool CameraSchedulerPolicy::getThreadPoolConfig(uint32_t* threadNumber,
+                                                std::vector<int32_t>* cpus) const {
+    CheckAndLogError(!threadNumber || !cpus, false, "nullptr input");
+    CheckAndLogError(!mActiveConfig, false, "No config");
+
+    *threadNumber = mActiveConfig->poolThreads;
+    *cpus = mActiveConfig->poolCpus;
+    return mActiveConfig->threadPoolMode;
+}
+
 void CameraSchedulerPolicy::parseExecutorsObject(const Json::Value& node,
                                                  PolicyConfigDesc* desc) {
     for (Json::Value::ArrayIndex i = 0; i < node.size(); i++) {
@@ -115,14 +130,40 @@ void CameraSchedulerPolicy::parseExecutorsObject(const Json::Value& node,
             exe.triggerName = ele["trigger"].asString();
         }
         if (ele.isMember("nodes")) {
-            for (Json::Value::ArrayIndex j = 0; j < ele["nodes"].size(); j++)
-                exe.nodeList.push_back(ele["nodes"][j].asString());
+            // One entry is one stage, which is a node name or an array of node names
+            for (Json::Value::ArrayIndex j = 0; j < ele["nodes"].size(); j++) {
+                const Json::Value& stage = ele["nodes"][j];
+                if (stage.isArray()) {
+                    for (Json::Value::ArrayIndex k = 0; k < stage.size(); k++) {
+                        exe.nodeList.push_back(stage[k].asString());
+                        exe.nodeStages.push_back(j);
+                    }
+                } else {
+                    exe.nodeList.push_back(stage.asString());
+                    exe.nodeStages.push_back(j);
+                }
+            }
         }
 
         desc->exeList.push_back(exe);
     }
 }
 
+void CameraSchedulerPolicy::parseThreadPoolObject(const Json::Value& node,
+                                                 PolicyConfigDesc* desc) {
+    desc->threadPoolMode = true;
+    if (node.isMember("threads")) {
+        desc->poolThreads = node["threads"].asUInt();
+    }
+    if (node.isMember("cpus")) {
+        for (Json::Value::ArrayIndex i = 0; i < node["cpus"].size(); i++)
+            desc->poolCpus.push_back(node["cpus"][i].asInt());
+    }
+    if (desc->poolThreads == 0U) {
+        desc->poolThreads = desc->poolCpus.empty() ? DEFAULT_POOL_THREADS : desc->poolCpus.size();
+    }
+}
+
 bool CameraSchedulerPolicy::run(const std::string& filename) {
     auto root = openJsonFile(filename);
     if (root.empty()) {
@@ -149,6 +190,9 @@ bool CameraSchedulerPolicy::run(const std::string& filename) {
             if (ele.isMember("pipe_executors")) {
                 parseExecutorsObject(ele["pipe_executors"], &desc);
             }
+            if (ele.isMember("thread_pool")) {
+                parseThreadPoolObject(ele["thread_pool"], &desc);
+            }
 
             mPolicyConfigs.push_back(desc);
         }
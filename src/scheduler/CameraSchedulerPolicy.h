@@ -39,6 +39,8 @@ class CameraSchedulerPolicy : public JsonParserBase {
         std::string exeName;
         std::string triggerName;
         std::vector<std::string> nodeList;
+        // Stage index of each node, nodes of the same stage can run concurrently
+        std::vector<int32_t> nodeStages;
     };
 
     struct PolicyConfigDesc {
@@ -46,21 +48,31 @@ class CameraSchedulerPolicy : public JsonParserBase {
         uint32_t configId;
         uint32_t graphId;
         std::vector<ExecutorDesc> exeList;
+        // Run nodes on the shared thread pool instead of in executor threads
+        bool threadPoolMode;
+        uint32_t poolThreads;
+        std::vector<int32_t> poolCpus;
 
         PolicyConfigDesc() {
             configId = 0;
             graphId = 0;
+            threadPoolMode = false;
+            poolThreads = 0;
         }
     };
 
     bool run(const std::string& filename) final override;
     void parseExecutorsObject(const Json::Value& node, PolicyConfigDesc* desc);
+    void parseThreadPoolObject(const Json::Value& node, PolicyConfigDesc* desc);
 
  public:
     int32_t setConfig(uint32_t graphId);
     // Return <exeName, trigger source name>
     int32_t getExecutors(std::map<const char*, const char*>* executors) const;
-    int32_t getNodeList(const char* exeName, std::vector<std::string>* nodeList) const;
+    int32_t getNodeList(const char* exeName, std::vector<std::string>* nodeList,
+                        std::vector<int32_t>* nodeStages = nullptr) const;
+    // Return true if the active config uses the thread pool
+    bool getThreadPoolConfig(uint32_t* threadNumber, std::vector<int32_t>* cpus) const;
 
  private:
     static CameraSchedulerPolicy* sInstance;
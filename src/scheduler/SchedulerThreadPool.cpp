@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define LOG_TAG SchedThreadPool
+
+#include "src/scheduler/SchedulerThreadPool.h"
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <string>
+#include <utility>
+
+#include "CameraLog.h"
+#include "Errors.h"
+
+namespace icamera {
+
+SchedulerThreadPool::SchedulerThreadPool(uint32_t threadNumber, const std::vector<int32_t>& cpus)
+        : mThreadNumber(threadNumber),
+          mCpus(cpus),
+          mActive(false),
+          mQueuedTasks(0U),
+          mNextWorker(0U),
+          mRunCount(0U),
+          mStealCount(0U) {
+    LOG1("%s: %u threads, %zu cpus", __func__, mThreadNumber, mCpus.size());
+}
+
+SchedulerThreadPool::~SchedulerThreadPool() {
+    stop();
+}
+
+void SchedulerThreadPool::start() {
+    std::lock_guard<std::mutex> l(mLock);
+    if (mActive) {
+        return;
+    }
+
+    mActive = true;
+    mQueuedTasks = 0U;
+    mNextWorker = 0U;
+    mRunCount = 0U;
+    mStealCount = 0U;
+    mWorkers.clear();
+    for (uint32_t i = 0U; i < mThreadNumber; i++) {
+        mWorkers.push_back(std::unique_ptr<Worker>(new Worker(this, i)));
+        mWorkers.back()->start();
+    }
+}
+
+void SchedulerThreadPool::stop() {
+    {
+        std::lock_guard<std::mutex> l(mLock);
+        if (!mActive) {
+            return;
+        }
+        mActive = false;
+        mWorkSignal.notify_all();
+    }
+
+    // The workers exit by themselves once the queued tasks are done
+    for (auto& worker : mWorkers) {
+        worker->join();
+    }
+    mWorkers.clear();
+    LOG1("%s: tasks run %" PRIu64 ", stolen %" PRIu64, __func__, mRunCount.load(),
+         mStealCount.load());
+}
+
+void SchedulerThreadPool::runTasks(const std::vector<Task>& tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+
+    bool active = false;
+    {
+        std::lock_guard<std::mutex> l(mLock);
+        active = mActive && !mWorkers.empty();
+    }
+    if (!active || tasks.size() == 1U) {
+        for (auto& task : tasks) {
+            task();
+        }
+        return;
+    }
+
+    std::shared_ptr<TaskBatch> batch = std::make_shared<TaskBatch>();
+    batch->remaining = tasks.size() - 1U;
+
+    // Spread the tasks over the workers, idle workers steal them if unbalanced
+    for (size_t i = 1U; i < tasks.size(); i++) {
+        Worker* worker = mWorkers[mNextWorker++ % mWorkers.size()].get();
+        std::lock_guard<std::mutex> l(worker->mQueueLock);
+        worker->mQueue.push_back({tasks[i], batch});
+        // Count under the queue lock after pushing, so a woken worker always finds the task,
+        // and popTask() can't decrease the counter before it's increased
+        mQueuedTasks++;
+    }
+    {
+        std::lock_guard<std::mutex> l(mLock);
+        mWorkSignal.notify_all();
+    }
+
+    tasks[0]();
+    mRunCount++;
+
+    std::unique_lock<std::mutex> lock(batch->lock);
+    batch->done.wait(lock, [&batch] { return batch->remaining == 0U; });
+}
+
+bool SchedulerThreadPool::popTask(uint32_t index, TaskItem* item) {
+    {
+        Worker* worker = mWorkers[index].get();
+        std::lock_guard<std::mutex> l(worker->mQueueLock);
+        if (!worker->mQueue.empty()) {
+            *item = std::move(worker->mQueue.back());
+            worker->mQueue.pop_back();
+            mQueuedTasks--;
+            return true;
+        }
+    }
+
+    for (size_t i = 1U; i < mWorkers.size(); i++) {
+        Worker* victim = mWorkers[(index + i) % mWorkers.size()].get();
+        std::lock_guard<std::mutex> l(victim->mQueueLock);
+        if (!victim->mQueue.empty()) {
+            *item = std::move(victim->mQueue.front());
+            victim->mQueue.pop_front();
+            mQueuedTasks--;
+            mStealCount++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void SchedulerThreadPool::runTask(TaskItem* item) {
+    item->task();
+    mRunCount++;
+
+    std::shared_ptr<TaskBatch> batch = std::move(item->batch);
+    item->task = nullptr;
+    std::lock_guard<std::mutex> l(batch->lock);
+    if (--batch->remaining == 0U) {
+        batch->done.notify_one();
+    }
+}
+
+void SchedulerThreadPool::setAffinity() {
+    if (mCpus.empty()) {
+        return;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (auto cpu : mCpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+    CheckWarningNoReturn(ret != 0, "%s: set cpu affinity failed %d", __func__, ret);
+}
+
+SchedulerThreadPool::Worker::Worker(SchedulerThreadPool* pool, uint32_t index)
+        : mPool(pool),
+          mIndex(index),
+          mAffinitySet(false) {}
+
+void SchedulerThreadPool::Worker::start() {
+    Thread::run("CamSchedPool" + std::to_string(mIndex), PRIORITY_NORMAL);
+}
+
+bool SchedulerThreadPool::Worker::threadLoop() {
+    if (!mAffinitySet) {
+        mPool->setAffinity();
+        mAffinitySet = true;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mPool->mLock);
+        mPool->mWorkSignal.wait(lock,
+                                [this] { return !mPool->mActive || mPool->mQueuedTasks > 0U; });
+        // Finish the queued tasks before exiting, their callers are waiting
+        if (!mPool->mActive && mPool->mQueuedTasks == 0U) {
+            return false;
+        }
+    }
+
+    TaskItem item;
+    if (mPool->popTask(mIndex, &item)) {
+        mPool->runTask(&item);
+    }
+    return true;
+}
+
+}  // namespace icamera
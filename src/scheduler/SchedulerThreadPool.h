@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2025 Intel Corporation.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "iutils/Thread.h"
+#include "iutils/Utils.h"
+
+namespace icamera {
+
+/**
+ * \class SchedulerThreadPool
+ *
+ * Work-stealing worker threads shared by all executors of one CameraScheduler.
+ * Each worker owns a task deque: it takes its own tasks from the back and
+ * steals from the front of the other workers' deques when it runs out of work.
+ *
+ * runTasks() blocks until all the given tasks are done, so the caller keeps the
+ * ordering between task batches.
+ */
+class SchedulerThreadPool {
+ public:
+    typedef std::function<void()> Task;
+
+    /**
+     * threadNumber: number of worker threads.
+     * cpus: CPUs the workers are bound to, empty means no affinity.
+     */
+    SchedulerThreadPool(uint32_t threadNumber, const std::vector<int32_t>& cpus);
+    ~SchedulerThreadPool();
+
+    void start();
+    void stop();
+
+    /**
+     * Run the tasks concurrently, the first one is run by the calling thread.
+     * The tasks are run by the calling thread only if the pool isn't started.
+     */
+    void runTasks(const std::vector<Task>& tasks);
+
+ private:
+    struct TaskBatch {
+        uint32_t remaining;
+        std::mutex lock;
+        std::condition_variable done;
+    };
+
+    struct TaskItem {
+        Task task;
+        std::shared_ptr<TaskBatch> batch;
+    };
+
+    class Worker : public Thread {
+     public:
+        Worker(SchedulerThreadPool* pool, uint32_t index);
+        virtual ~Worker() {}
+
+        void start();
+
+        std::mutex mQueueLock;
+        std::deque<TaskItem> mQueue;
+
+     private:
+        virtual bool threadLoop();
+
+        SchedulerThreadPool* mPool;
+        uint32_t mIndex;
+        bool mAffinitySet;
+
+     private:
+        DISALLOW_COPY_AND_ASSIGN(Worker);
+    };
+
+    // Take the own task first, then steal from the other workers
+    bool popTask(uint32_t index, TaskItem* item);
+    void runTask(TaskItem* item);
+    void setAffinity();
+
+ private:
+    uint32_t mThreadNumber;
+    std::vector<int32_t> mCpus;
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+
+    // Protect mActive, and wake up the idle workers
+    std::mutex mLock;
+    std::condition_variable mWorkSignal;
+    bool mActive;
+
+    std::atomic<uint32_t> mQueuedTasks;
+    std::atomic<uint32_t> mNextWorker;
+    std::atomic<uint64_t> mRunCount;
+    std::atomic<uint64_t> mStealCount;
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(SchedulerThreadPool);
+};
+
+}  // namespace icamera
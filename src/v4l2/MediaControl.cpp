@@ -854,6 +854,8 @@ int MediaControl::setRouting(int cameraId, MediaCtlConf* mc, bool enableRouting)
 
 int MediaControl::mediaCtlSetup(int cameraId, MediaCtlConf* mc, int width, int height, int field) {
     LOG1("<id%d> %s", cameraId, __func__);
+    AutoMutex lock(mMediaCtlLock);
+
     /* Setup controls in format Configuration */
     setMediaMcCtl(cameraId, mc->ctls);
 
@@ -900,6 +902,7 @@ int MediaControl::getVCMI2CAddr(const char* vcmName, string* vcmI2CAddr) {
 
 void MediaControl::mediaCtlClear(int cameraId, MediaCtlConf* mc) {
     LOG1("<id%d> %s", cameraId, __func__);
+    AutoMutex lock(mMediaCtlLock);
 
     // VIRTUAL_CHANNEL_S
     (void)setRouting(cameraId, mc, false);
@@ -322,6 +322,9 @@ class MediaControl {
 
     static MediaControl* sInstance;
     static Mutex sLock;
+
+    // The media graph is shared by all cameras, serialize the setup and clear of their pipes
+    Mutex mMediaCtlLock;
 };
 
 }  // namespace icamera
@@ -92,6 +92,9 @@ int SysCall::ioctl(int fd, int request, struct media_links_enum* arg) {
 int SysCall::ioctl(int fd, int request, struct media_entity_desc* arg) {
     return ioctl(fd, request, reinterpret_cast<void*>(arg));
 }
+int SysCall::ioctl(int fd, int request, struct v4l2_ext_controls* arg) {
+    return ioctl(fd, request, reinterpret_cast<void*>(arg));
+}
 
 #ifdef MODULE_TEST
 int SysCall::ioctl(int fd, int request, struct media_links_desc* arg) {
@@ -128,10 +131,6 @@ int SysCall::ioctl(int fd, int request, struct v4l2_streamon_info* arg) {
     return ioctl(fd, request, reinterpret_cast<void*>(arg));
 }
 
-int SysCall::ioctl(int fd, int request, struct v4l2_ext_controls* arg) {
-    return ioctl(fd, request, reinterpret_cast<void*>(arg));
-}
-
 int SysCall::ioctl(int fd, int request, struct v4l2_control* arg) {
     return ioctl(fd, request, reinterpret_cast<void*>(arg));
 }
@@ -45,6 +45,7 @@ class SysCall {
     virtual int ioctl(int fd, int request, struct media_link_desc* arg);
     virtual int ioctl(int fd, int request, struct media_links_enum* arg);
     virtual int ioctl(int fd, int request, struct media_entity_desc* arg);
+    virtual int ioctl(int fd, int request, struct v4l2_ext_controls* arg);
 
 #ifdef MODULE_TEST
     virtual int ioctl(int fd, int request, struct media_links_desc* arg);
@@ -58,7 +59,6 @@ class SysCall {
     virtual int ioctl(int fd, int request, struct v4l2_subdev_format* arg);
     virtual int ioctl(int fd, int request, struct v4l2_subdev_stream* arg);
     virtual int ioctl(int fd, int request, struct v4l2_streamon_info* arg);
-    virtual int ioctl(int fd, int request, struct v4l2_ext_controls* arg);
     virtual int ioctl(int fd, int request, struct v4l2_control* arg);
     virtual int ioctl(int fd, int request, struct v4l2_queryctrl* arg);
     virtual int ioctl(int fd, int request, struct v4l2_subdev_selection* arg);